@@ -22,6 +22,7 @@
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/IncrementalModelBuilder.h"
 
 #include "storm/models/ModelBase.h"
 
@@ -366,7 +367,10 @@ namespace storm {
             if (!output.properties.empty()) {
                 output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
             }
-            ensureNoUndefinedPropertyConstants(output.properties);
+            if (!ioSettings.isConstantSweepSet()) {
+                // The properties may still refer to the constants of a sweep, which are substituted for each model.
+                ensureNoUndefinedPropertyConstants(output.properties);
+            }
             auto transformedJani = std::make_shared<SymbolicInput>();
             ModelProcessingInformation mpi = getModelProcessingInformation(output, transformedJani);
 
@@ -438,8 +442,7 @@ namespace storm {
             return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), buildSettings.isBuildFullModelSet(), !buildSettings.isApplyNoMaximumProgressAssumptionSet());
         }
         
-        template <typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings, bool useJit) {
+        storm::builder::BuilderOptions createBuilderOptions(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
             storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
             options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
             options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
@@ -473,8 +476,12 @@ namespace storm {
             if (buildSettings.isAddOverlappingGuardsLabelSet()) {
                 options.setAddOverlappingGuardsLabel(true);
             }
+            return options;
+        }
 
-            return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
+        template <typename ValueType>
+        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings, bool useJit) {
+            return storm::api::buildSparseModel<ValueType>(input.model.get(), createBuilderOptions(input, buildSettings), useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
         template <typename ValueType>
@@ -485,7 +492,10 @@ namespace storm {
             } else if (ioSettings.isExplicitDRNSet()) {
                 storm::parser::DirectEncodingParserOptions options;
                 options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+                options.numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -506,7 +516,7 @@ namespace storm {
                 } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
                     result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
             }
@@ -591,11 +601,14 @@ namespace storm {
             
             if (ioSettings.isExportBuildSet()) {
                 switch(ioSettings.getExportBuildFormat()) {
+                    case storm::exporter::ModelExportFormat::Binary:
+                        storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBuildFilename());
+                        break;
                     case storm::exporter::ModelExportFormat::Dot:
                         storm::api::exportSparseModelAsDot(model, ioSettings.getExportBuildFilename(), ioSettings.getExportDotMaxWidth());
                         break;
                     case storm::exporter::ModelExportFormat::Drn:
-                        storm::api::exportSparseModelAsDrn(model, ioSettings.getExportBuildFilename(),  input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled());
+                        storm::api::exportSparseModelAsDrn(model, ioSettings.getExportBuildFilename(),  input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled(), storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads());
                         break;
                     case storm::exporter::ModelExportFormat::Json:
                         storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
@@ -608,7 +621,7 @@ namespace storm {
             // TODO: The following options are depreciated and shall be removed at some point:
             
             if (ioSettings.isExportExplicitSet()) {
-                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled());
+                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled(), storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads());
             }
 
             if (ioSettings.isExportDdSet()) {
@@ -908,41 +921,49 @@ namespace storm {
             }
         };
         
+        typedef std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> VerificationCallback;
+        typedef std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> PostprocessingCallback;
+        
         template<typename ValueType>
-        void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+        void verifyProperty(storm::jani::Property const& property, VerificationCallback const& verificationCallback, PostprocessingCallback const& postprocessingCallback = PostprocessingIdentity()) {
             auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
-            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
-            for (auto const& property : properties) {
-                printModelCheckingProperty(property);
-                bool ignored = false;
-                storm::utility::Stopwatch watch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result;
-                try {
-                    auto rawFormula = property.getRawFormula();
-                    if (transformationSettings.isChainEliminationSet() &&
-                        !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
-                        STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                        ignored = true;
-                    } else if (transformationSettings.isToDiscreteTimeModelSet()) {
-                        auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
-                        auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
-                        if (propertyFormula && filterFormula) {
-                            result = verificationCallback(propertyFormula, filterFormula);
-                        } else {
-                            ignored = true;
-                        }
+            printModelCheckingProperty(property);
+            bool ignored = false;
+            storm::utility::Stopwatch watch(true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            try {
+                auto rawFormula = property.getRawFormula();
+                if (transformationSettings.isChainEliminationSet() &&
+                    !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
+                    STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
+                    ignored = true;
+                } else if (transformationSettings.isToDiscreteTimeModelSet()) {
+                    auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
+                    auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
+                    if (propertyFormula && filterFormula) {
+                        result = verificationCallback(propertyFormula, filterFormula);
                     } else {
-                        result = verificationCallback(property.getRawFormula(),
-                                                      property.getFilter().getStatesFormula());
+                        ignored = true;
                     }
-                } catch (storm::exceptions::BaseException const& ex) {
-                    STORM_LOG_WARN("Cannot handle property: " << ex.what());
-                }
-                watch.stop();
-                if (!ignored) {
-                    postprocessingCallback(result);
-                    printResult<ValueType>(result, property, &watch);
+                } else {
+                    result = verificationCallback(property.getRawFormula(),
+                                                  property.getFilter().getStatesFormula());
                 }
+            } catch (storm::exceptions::BaseException const& ex) {
+                STORM_LOG_WARN("Cannot handle property: " << ex.what());
+            }
+            watch.stop();
+            if (!ignored) {
+                postprocessingCallback(result);
+                printResult<ValueType>(result, property, &watch);
+            }
+        }
+        
+        template<typename ValueType>
+        void verifyProperties(SymbolicInput const& input, VerificationCallback const& verificationCallback, PostprocessingCallback const& postprocessingCallback = PostprocessingIdentity()) {
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            for (auto const& property : properties) {
+                verifyProperty<ValueType>(property, verificationCallback, postprocessingCallback);
             }
         }
         
@@ -1038,17 +1059,76 @@ namespace storm {
             });
         }
         
+        /*!
+         * Retrieves whether the given formula is of the form P=? [phi U<=t psi] and can thus be checked for several
+         * time bounds at once.
+         */
+        bool isTimeBoundedUntilFormula(storm::logic::Formula const& formula) {
+            if (!formula.isProbabilityOperatorFormula() || formula.asProbabilityOperatorFormula().hasBound() || !formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+                return false;
+            }
+            storm::logic::BoundedUntilFormula const& untilFormula = formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+            return !untilFormula.isMultiDimensional() && untilFormula.getTimeBoundReference().isTimeBound() && !untilFormula.hasLowerBound();
+        }
+        
+        template <typename ValueType>
+        void verifyForTimeBoundsWithSparseEngine(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, SymbolicInput const& input, ModelProcessingInformation const& mpi, std::vector<double> const& timeBounds, VerificationCallback const& verificationCallback, PostprocessingCallback const& postprocessingCallback) {
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            for (auto const& property : properties) {
+                if (!isTimeBoundedUntilFormula(*property.getRawFormula())) {
+                    STORM_LOG_INFO("Property " << *property.getRawFormula() << " is not a time-bounded until property and is checked without the given time bounds.");
+                    verifyProperty<ValueType>(property, verificationCallback, postprocessingCallback);
+                    continue;
+                }
+                printModelCheckingProperty(property);
+                storm::utility::Stopwatch watch(true);
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+                try {
+                    auto states = property.getFilter().getStatesFormula();
+                    bool filterForInitialStates = states->isInitialFormula();
+                    results = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, ctmc, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates), timeBounds);
+                    
+                    std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                    if (filterForInitialStates) {
+                        filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(ctmc->getInitialStates());
+                    } else {
+                        filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, ctmc, storm::api::createTask<ValueType>(states, false));
+                    }
+                    for (auto& result : results) {
+                        result->filter(filter->asQualitativeCheckResult());
+                    }
+                } catch (storm::exceptions::BaseException const& ex) {
+                    STORM_LOG_WARN("Cannot handle property: " << ex.what());
+                    results.clear();
+                }
+                watch.stop();
+                if (results.empty()) {
+                    printResult<ValueType>(nullptr, property);
+                    continue;
+                }
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    // Each time bound is exported like a separate property.
+                    postprocessingCallback(results[boundIndex]);
+                    STORM_PRINT("Time bound " << timeBounds[boundIndex] << ": ");
+                    printResult<ValueType>(results[boundIndex], property);
+                }
+                STORM_PRINT("Time for model checking: " << watch << "." << std::endl);
+            }
+        }
+        
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-            auto verificationCallback = [&sparseModel,&ioSettings,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            // The properties share the data that the model checkers reuse across queries on this model.
+            auto cache = std::make_shared<storm::modelchecker::helper::SparseModelCheckerCache<ValueType>>();
+            auto verificationCallback = [&sparseModel,&ioSettings,&mpi,&cache] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                                             if (ioSettings.isExportSchedulerSet()) {
                                                 task.setProduceSchedulers(true);
                                             }
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task, cache);
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
@@ -1089,7 +1169,12 @@ namespace storm {
                                             }
                                             ++exportCount;
                                         };
-            verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            if (ioSettings.isTimeBoundsSet()) {
+                STORM_LOG_THROW(sparseModel->isOfType(storm::models::ModelType::Ctmc), storm::exceptions::NotSupportedException, "Checking properties for several time bounds is only supported for CTMCs.");
+                verifyForTimeBoundsWithSparseEngine<ValueType>(sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>(), input, mpi, ioSettings.getTimeBounds(), verificationCallback, postprocessingCallback);
+            } else {
+                verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            }
             if (ioSettings.isComputeSteadyStateDistributionSet()) {
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1231,6 +1316,83 @@ namespace storm {
             return model;
         }
         
+        typedef std::function<std::shared_ptr<storm::models::ModelBase>(std::map<storm::expressions::Variable, storm::expressions::Expression> const&)> ConstantSweepBuilder;
+
+        template <typename ValueType>
+        ConstantSweepBuilder createConstantSweepBuilder(SymbolicInput const&, storm::builder::BuilderOptions const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Constant sweeps are not supported for this data-type.");
+        }
+
+        template <>
+        ConstantSweepBuilder createConstantSweepBuilder<double>(SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+            auto builder = std::make_shared<storm::builder::IncrementalModelBuilder<double>>(input.model.get(), options);
+            return [builder] (std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) { return builder->build(constantDefinitions); };
+        }
+
+#ifdef STORM_HAVE_CARL
+        template <>
+        ConstantSweepBuilder createConstantSweepBuilder<storm::RationalNumber>(SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+            auto builder = std::make_shared<storm::builder::IncrementalModelBuilder<storm::RationalNumber>>(input.model.get(), options);
+            return [builder] (std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) { return builder->build(constantDefinitions); };
+        }
+#endif
+
+        void ensureNoSweptConstantsInStateFormulas(SymbolicInput const& input) {
+            // The model of a sweep is labeled with the state formulas of the properties before the swept constants are
+            // substituted, so the labels would not match the instantiated properties.
+            std::vector<storm::expressions::Variable> sweptConstants = input.model.get().getUndefinedConstants();
+            for (auto const& property : input.properties) {
+                std::vector<std::shared_ptr<storm::logic::AtomicExpressionFormula const>> atomicExpressionFormulas;
+                property.getRawFormula()->gatherAtomicExpressionFormulas(atomicExpressionFormulas);
+                property.getFilter().getStatesFormula()->gatherAtomicExpressionFormulas(atomicExpressionFormulas);
+                for (auto const& atomicExpressionFormula : atomicExpressionFormulas) {
+                    std::set<storm::expressions::Variable> variables = atomicExpressionFormula->getExpression().getVariables();
+                    for (auto const& constant : sweptConstants) {
+                        STORM_LOG_THROW(variables.count(constant) == 0, storm::exceptions::NotSupportedException, "The state formula '" << *atomicExpressionFormula << "' of property '" << property << "' refers to the swept constant " << constant.getName() << ", which is not supported for constant sweeps.");
+                    }
+                }
+            }
+        }
+
+        template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
+        void processInputWithConstantSweep(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Constant sweeps require the sparse engine.");
+            STORM_LOG_THROW(input.model, storm::exceptions::InvalidSettingsException, "Constant sweeps require a symbolic input model.");
+            ensureNoSweptConstantsInStateFormulas(input);
+
+            // The structure of the model is shared by all models of the sweep (if possible).
+            storm::utility::Stopwatch modelBuildingWatch(true);
+            ConstantSweepBuilder builder = createConstantSweepBuilder<BuildValueType>(input, createBuilderOptions(input, buildSettings));
+            modelBuildingWatch.stop();
+            STORM_PRINT("Time for preparing the constant sweep: " << modelBuildingWatch << "." << std::endl << std::endl);
+
+            for (auto const& constantDefinitionString : ioSettings.getConstantSweepDefinitionStrings()) {
+                STORM_PRINT("Constants: " << constantDefinitionString << std::endl);
+                std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions = input.model.get().parseConstantDefinitions(constantDefinitionString);
+                SymbolicInput instantiatedInput = input;
+                instantiatedInput.properties = storm::api::substituteConstantsInProperties(input.properties, constantDefinitions);
+                if (input.preprocessedProperties) {
+                    instantiatedInput.preprocessedProperties = storm::api::substituteConstantsInProperties(input.preprocessedProperties.get(), constantDefinitions);
+                }
+                ensureNoUndefinedPropertyConstants(instantiatedInput.properties);
+
+                modelBuildingWatch.restart();
+                std::shared_ptr<storm::models::ModelBase> model = builder(constantDefinitions);
+                modelBuildingWatch.stop();
+                STORM_PRINT("Time for model construction: " << modelBuildingWatch << "." << std::endl << std::endl);
+                model->printModelInformationToStream(std::cout);
+
+                auto preprocessingResult = preprocessModel<DdType, BuildValueType, VerificationValueType>(model, instantiatedInput, mpi);
+                if (preprocessingResult.second) {
+                    model = preprocessingResult.first;
+                    model->printModelInformationToStream(std::cout);
+                }
+                verifyModel<DdType, VerificationValueType>(model, instantiatedInput, mpi);
+            }
+        }
+
         template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
         void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto abstractionSettings = storm::settings::getModule<storm::settings::modules::AbstractionSettings>();
@@ -1241,6 +1403,8 @@ namespace storm {
                 verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
             } else if (mpi.engine == storm::utility::Engine::Exploration) {
                 verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+            } else if (storm::settings::getModule<storm::settings::modules::IOSettings>().isConstantSweepSet()) {
+                processInputWithConstantSweep<DdType, BuildValueType, VerificationValueType>(input, mpi);
             } else {
                 std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
                 if (model) {
@@ -0,0 +1,191 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <boost/endian/conversion.hpp>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            /*!
+             * Reads the components of a model in the binary encoding from memory.
+             */
+            class BinaryEncodingReader {
+            public:
+                BinaryEncodingReader(char const* data, char const* dataEnd, std::string const& filename) : position(data), dataEnd(dataEnd), filename(filename) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Retrieves a pointer to the given number of elements at the current position and moves behind them
+                 * (and their padding).
+                 */
+                template<typename ElementType>
+                ElementType const* readArray(uint64_t size) {
+                    uint64_t remainingBytes = static_cast<uint64_t>(dataEnd - position);
+                    STORM_LOG_THROW(size <= remainingBytes / sizeof(ElementType), storm::exceptions::WrongFormatException, "Unexpected end of file " << filename << ".");
+                    uint64_t numberOfBytes = std::min<uint64_t>((size * sizeof(ElementType) + 7) / 8 * 8, remainingBytes);
+                    ElementType const* result = reinterpret_cast<ElementType const*>(position);
+                    position += numberOfBytes;
+                    return result;
+                }
+
+                uint64_t readNumber() {
+                    return *readArray<uint64_t>(1);
+                }
+
+                template<typename ElementType>
+                std::vector<ElementType> readVector() {
+                    uint64_t size = readNumber();
+                    ElementType const* data = readArray<ElementType>(size);
+                    return std::vector<ElementType>(data, data + size);
+                }
+
+                std::string readString() {
+                    uint64_t size = readNumber();
+                    char const* data = readArray<char>(size);
+                    return std::string(data, size);
+                }
+
+                storm::storage::BitVector readBitVector() {
+                    uint64_t size = readNumber();
+                    STORM_LOG_THROW(size / 64 <= static_cast<uint64_t>(dataEnd - position) / 8, storm::exceptions::WrongFormatException, "Unexpected end of file " << filename << ".");
+                    storm::storage::BitVector result(size);
+                    for (uint64_t bit = 0; bit < size; bit += 64) {
+                        result.setFromInt(bit, std::min<uint64_t>(64, size - bit), readNumber());
+                    }
+                    return result;
+                }
+
+                template<typename ValueType>
+                storm::storage::SparseMatrix<ValueType> readMatrix() {
+                    uint64_t rowCount = readNumber();
+                    uint64_t columnCount = readNumber();
+                    uint64_t entryCount = readNumber();
+
+                    STORM_LOG_THROW(rowCount < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException, "Inconsistent matrix in file " << filename << ".");
+                    uint64_t const* rowIndicationData = readArray<uint64_t>(rowCount + 1);
+                    std::vector<uint64_t> rowIndications(rowIndicationData, rowIndicationData + rowCount + 1);
+                    STORM_LOG_THROW(rowIndications.front() == 0 && std::is_sorted(rowIndications.begin(), rowIndications.end()) && rowIndications.back() == entryCount, storm::exceptions::WrongFormatException, "Inconsistent row indications of matrix in file " << filename << ".");
+                    auto const* entryData = readArray<storm::storage::MatrixEntry<uint64_t, ValueType>>(entryCount);
+                    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues(entryData, entryData + entryCount);
+                    for (auto const& entry : columnsAndValues) {
+                        STORM_LOG_THROW(entry.getColumn() < columnCount, storm::exceptions::WrongFormatException, "Column " << entry.getColumn() << " of matrix in file " << filename << " exceeds the number of columns (" << columnCount << ").");
+                    }
+
+                    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+                    if (readNumber() != 0) {
+                        rowGroupIndices = readVector<uint64_t>();
+                        STORM_LOG_THROW(!rowGroupIndices->empty() && rowGroupIndices->front() == 0 && std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()) && rowGroupIndices->back() == rowCount, storm::exceptions::WrongFormatException, "Inconsistent row groups of matrix in file " << filename << ".");
+                    }
+                    return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+                }
+
+                template<typename LabelingType>
+                LabelingType readLabeling(uint64_t itemCount) {
+                    LabelingType labeling(itemCount);
+                    uint64_t numberOfLabels = readNumber();
+                    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                        std::string name = readString();
+                        storm::storage::BitVector items = readBitVector();
+                        STORM_LOG_THROW(items.size() == itemCount, storm::exceptions::WrongFormatException, "Label '" << name << "' in file " << filename << " has an unexpected size.");
+                        labeling.addLabel(name, std::move(items));
+                    }
+                    return labeling;
+                }
+
+                bool isAtEnd() const {
+                    return position == dataEnd;
+                }
+
+            private:
+                char const* position;
+                char const* dataEnd;
+                std::string const& filename;
+            };
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            STORM_LOG_INFO("Reading from file " << filename);
+            MappedFile file(filename.c_str());
+            BinaryEncodingReader reader(file.getData(), file.getDataEnd(), filename);
+
+            // Header
+            std::string const& magic = storm::exporter::BinaryEncoding::magic;
+            STORM_LOG_THROW(file.getDataSize() >= magic.size() && std::memcmp(reader.readArray<char>(magic.size()), magic.data(), magic.size()) == 0, storm::exceptions::WrongFormatException, "File " << filename << " is not in the binary encoding.");
+            uint64_t byteOrderMark = reader.readNumber();
+            STORM_LOG_THROW(byteOrderMark != boost::endian::endian_reverse(storm::exporter::BinaryEncoding::byteOrderMark), storm::exceptions::WrongFormatException, "File " << filename << " was written with a different byte order.");
+            STORM_LOG_THROW(byteOrderMark == storm::exporter::BinaryEncoding::byteOrderMark, storm::exceptions::WrongFormatException, "File " << filename << " has an invalid header.");
+            uint64_t version = reader.readNumber();
+            STORM_LOG_THROW(version == storm::exporter::BinaryEncoding::version, storm::exceptions::WrongFormatException, "File " << filename << " has version " << version << " of the binary encoding, but only version " << storm::exporter::BinaryEncoding::version << " is supported.");
+            storm::models::ModelType type = storm::models::getModelType(reader.readString());
+
+            // Transitions and labels
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(reader.readMatrix<ValueType>());
+            uint64_t stateCount = components.transitionMatrix.getRowGroupCount();
+            uint64_t choiceCount = components.transitionMatrix.getRowCount();
+            STORM_LOG_THROW(components.transitionMatrix.getColumnCount() <= stateCount, storm::exceptions::WrongFormatException, "The transition matrix in file " << filename << " has more columns than states.");
+            components.stateLabeling = reader.readLabeling<storm::models::sparse::StateLabeling>(stateCount);
+
+            // Reward models
+            uint64_t numberOfRewardModels = reader.readNumber();
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                std::string name = reader.readString();
+                boost::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+                boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+                if (reader.readNumber() != 0) {
+                    stateRewards = reader.readVector<ValueType>();
+                    STORM_LOG_THROW(stateRewards->size() == stateCount, storm::exceptions::WrongFormatException, "The state rewards of reward model '" << name << "' in file " << filename << " have an unexpected size.");
+                }
+                if (reader.readNumber() != 0) {
+                    stateActionRewards = reader.readVector<ValueType>();
+                    STORM_LOG_THROW(stateActionRewards->size() == choiceCount, storm::exceptions::WrongFormatException, "The state-action rewards of reward model '" << name << "' in file " << filename << " have an unexpected size.");
+                }
+                if (reader.readNumber() != 0) {
+                    transitionRewards = reader.readMatrix<ValueType>();
+                    STORM_LOG_THROW(transitionRewards->getRowCount() == choiceCount && transitionRewards->getColumnCount() <= stateCount, storm::exceptions::WrongFormatException, "The transition rewards of reward model '" << name << "' in file " << filename << " have an unexpected size.");
+                }
+                components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+            }
+
+            // Model-specific components
+            if (reader.readNumber() != 0) {
+                components.choiceLabeling = reader.readLabeling<storm::models::sparse::ChoiceLabeling>(choiceCount);
+            }
+            if (reader.readNumber() != 0) {
+                components.exitRates = reader.readVector<ValueType>();
+                STORM_LOG_THROW(components.exitRates->size() == stateCount, storm::exceptions::WrongFormatException, "The exit rates in file " << filename << " have an unexpected size.");
+                // The transition matrix of CTMCs holds the rates and is stored as it is.
+                components.rateTransitions = type == storm::models::ModelType::Ctmc;
+            }
+            if (reader.readNumber() != 0) {
+                components.markovianStates = reader.readBitVector();
+                STORM_LOG_THROW(components.markovianStates->size() == stateCount, storm::exceptions::WrongFormatException, "The Markovian states in file " << filename << " have an unexpected size.");
+            }
+            if (reader.readNumber() != 0) {
+                components.observabilityClasses = reader.readVector<uint32_t>();
+                STORM_LOG_THROW(components.observabilityClasses->size() == stateCount, storm::exceptions::WrongFormatException, "The observations in file " << filename << " have an unexpected size.");
+            }
+            STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of file " << filename << ".");
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+
+        // Template instantiations.
+        template class BinaryEncodingParser<double>;
+
+    } // namespace parser
+} // namespace storm
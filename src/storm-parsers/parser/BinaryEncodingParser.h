@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for models in the binary encoding (see storm::exporter::BinaryEncoding).
+         *
+         * The file is mapped into memory and the arrays of the model components are taken over with a single copy each,
+         * so loading a model is essentially bounded by the time needed to read the file.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryEncodingParser {
+        public:
+
+            /*!
+             * Loads a model in the binary encoding from a file.
+             *
+             * @param filename The file to load.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+        };
+
+    } // namespace parser
+} // namespace storm
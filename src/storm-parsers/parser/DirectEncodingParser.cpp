@@ -1,11 +1,14 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <regex>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include "storm-parsers/parser/MappedFile.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -23,21 +26,58 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/builder.h"
+#include "storm/io/compression.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/SignalHandler.h"
 
 
 namespace storm {
     namespace parser {
 
+        namespace {
+            /*!
+             * A stream buffer that reads from a range of memory without copying it.
+             */
+            class MemoryBuffer : public std::streambuf {
+            public:
+                MemoryBuffer(char const* begin, char const* end) {
+                    char* data = const_cast<char*>(begin);
+                    setg(data, data, data + (end - begin));
+                }
+
+            protected:
+                pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override {
+                    // Only the current position is needed (for tellg).
+                    if (offset != 0 || direction != std::ios_base::cur || !(which & std::ios_base::in)) {
+                        return pos_type(off_type(-1));
+                    }
+                    return pos_type(gptr() - eback());
+                }
+            };
+        }
+
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename, DirectEncodingParserOptions const& options) {
 
-            // Load file
+            // Load file. Compressed files are decompressed while they are read.
             STORM_LOG_INFO("Reading from file " << filename);
-            std::ifstream file;
-            storm::utility::openFile(filename, file);
+            MappedFile mappedFile(filename.c_str());
+            char const* dataBegin = mappedFile.getData();
+            char const* dataEnd = mappedFile.getDataEnd();
+            bool compressed = storm::utility::isGzipCompressed(dataBegin, dataEnd);
+            std::unique_ptr<std::streambuf> buffer;
+            std::unique_ptr<std::istream> fileStream;
+            if (compressed) {
+                STORM_LOG_INFO("Decompressing file " << filename);
+                fileStream = std::make_unique<storm::utility::GzipInputFileStream>(filename);
+            } else {
+                buffer = std::make_unique<MemoryBuffer>(dataBegin, dataEnd);
+                fileStream = std::make_unique<std::istream>(buffer.get());
+            }
+            std::istream& file = *fileStream;
             std::string line;
 
             // Initialize
@@ -118,40 +158,240 @@ namespace storm {
                     STORM_LOG_THROW(nrStates != 0, storm::exceptions::WrongFormatException, "No. of states has to be declared before model.");
                     STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException, "No. of actions (@nr_choices) has to be declared before model.");
                     STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
-                    // Construct model components
-                    modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    // Construct model components from the remainder of the file.
+                    if (compressed) {
+                        modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    } else {
+                        std::streamoff statesOffset = file.tellg();
+                        char const* statesBegin = statesOffset < 0 ? dataEnd : dataBegin + statesOffset;
+                        modelComponents = parseStates(statesBegin, dataEnd, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    }
                     break;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
                 }
             }
             // Done parsing
-            storm::utility::closeFile(file);
-
             // Build model
             return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
         }
 
+        template<typename ValueType, typename RewardModelType>
+        struct DirectEncodingParser<ValueType, RewardModelType>::StateChunk {
+            // The id of the first state of the chunk as given in the file.
+            uint64_t firstStateId = 0;
+            uint64_t stateCount = 0;
+            uint64_t rowCount = 0;
+
+            // The transitions of the chunk.
+            storm::storage::SparseMatrix<ValueType> transitions;
+
+            // The labels (in the order of their first occurrence) together with the states or choices they are assigned to.
+            std::vector<std::pair<std::string, std::vector<uint64_t>>> stateLabels;
+            std::vector<std::pair<std::string, std::vector<uint64_t>>> choiceLabels;
+
+            // The rewards of the chunk. Vectors are only as large as needed for the last non-zero reward.
+            std::vector<std::vector<ValueType>> stateRewards;
+            std::vector<std::vector<ValueType>> actionRewards;
+            std::vector<ValueType> exitRates;
+            std::vector<uint32_t> observations;
+        };
+
+        namespace {
+            /*!
+             * Splits the given characters into (at most) the given number of chunks of roughly equal size such that
+             * every chunk except the first one starts with a state.
+             *
+             * @return The beginnings of the chunks followed by the end.
+             */
+            std::vector<char const*> getChunkBoundaries(char const* begin, char const* end, uint64_t numberOfChunks) {
+                static const std::string stateStart = "\nstate ";
+                std::vector<char const*> boundaries = {begin};
+                uint64_t size = static_cast<uint64_t>(end - begin);
+                for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+                    char const* position = std::max(boundaries.back(), begin + size / numberOfChunks * chunk);
+                    position = std::search(position, end, stateStart.begin(), stateStart.end());
+                    if (position == end) {
+                        break;
+                    }
+                    // Skip the line break.
+                    boundaries.push_back(position + 1);
+                }
+                boundaries.push_back(end);
+                return boundaries;
+            }
+
+            /*!
+             * Returns the number of threads that are used to parse the states.
+             */
+            template<typename ValueType>
+            uint64_t getNumberOfParsingThreads(DirectEncodingParserOptions const& options) {
+                uint64_t numberOfThreads = std::max<uint64_t>(1, options.numberOfThreads);
+                if (numberOfThreads > 1 && storm::NumberTraits<ValueType>::IsExact) {
+                    // Exact numbers may share (reference counted) state that is not thread-safe.
+                    STORM_LOG_INFO("Parsing the states sequentially as parallel parsing is only supported for floating point numbers.");
+                    numberOfThreads = 1;
+                }
+                return numberOfThreads;
+            }
+
+            /*!
+             * Assigns the label to the given item, where the index of the labels is used to find the label.
+             */
+            void addLabelToItem(std::vector<std::pair<std::string, std::vector<uint64_t>>>& labels, std::unordered_map<std::string, uint64_t>& labelIndices, std::string const& label, uint64_t item) {
+                auto labelIndexIt = labelIndices.find(label);
+                if (labelIndexIt == labelIndices.end()) {
+                    labelIndexIt = labelIndices.emplace(label, labels.size()).first;
+                    labels.emplace_back(label, std::vector<uint64_t>());
+                }
+                labels[labelIndexIt->second].second.push_back(item);
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+        DirectEncodingParser<ValueType, RewardModelType>::parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+                                                                      std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                                                      std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+            uint64_t numberOfThreads = getNumberOfParsingThreads<ValueType>(options);
+            std::vector<StateChunk> chunks;
+            parseStateChunks(begin, end, type, stateSize, placeholders, valueParser, options, numberOfThreads, chunks);
+            STORM_LOG_TRACE("Finished parsing");
+            return buildModelComponents(chunks, type, stateSize, nrChoices, rewardModelNames, options, numberOfThreads);
+        }
+
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
         DirectEncodingParser<ValueType, RewardModelType>::parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
                                                                       std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
                                                                       std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+            static const std::string stateStart = "\nstate ";
+            // The number of characters that are read at once.
+            uint64_t const blockSize = 1ull << 26;
+
+            uint64_t numberOfThreads = getNumberOfParsingThreads<ValueType>(options);
+            std::vector<StateChunk> chunks;
+            // The characters that are read but not yet parsed.
+            std::string block;
+            bool endOfFile = false;
+            while (!endOfFile) {
+                uint64_t oldSize = block.size();
+                block.resize(oldSize + blockSize);
+                file.read(&block[oldSize], blockSize);
+                block.resize(oldSize + file.gcount());
+                endOfFile = !file;
+
+                // Only complete states are parsed, the last (possibly incomplete) one is kept for the next block.
+                char const* begin = block.data();
+                char const* end = begin + block.size();
+                if (!endOfFile) {
+                    char const* lastStateStart = std::find_end(begin, end, stateStart.begin(), stateStart.end());
+                    if (lastStateStart == end) {
+                        // The block does not yet contain a complete state.
+                        continue;
+                    }
+                    // Keep the line break.
+                    end = lastStateStart + 1;
+                }
+                parseStateChunks(begin, end, type, stateSize, placeholders, valueParser, options, numberOfThreads, chunks);
+                block.erase(0, end - begin);
+            }
+            STORM_LOG_TRACE("Finished parsing");
+            return buildModelComponents(chunks, type, stateSize, nrChoices, rewardModelNames, options, numberOfThreads);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void DirectEncodingParser<ValueType, RewardModelType>::parseStateChunks(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize,
+                                                                                std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                                                                DirectEncodingParserOptions const& options, uint64_t numberOfThreads, std::vector<StateChunk>& chunks) {
+            // Split the states into chunks that are parsed independently. Having more chunks than threads balances the load.
+            std::vector<char const*> chunkBoundaries = getChunkBoundaries(begin, end, numberOfThreads == 1 ? 1 : 8 * numberOfThreads);
+            uint64_t firstChunk = chunks.size();
+            chunks.resize(firstChunk + chunkBoundaries.size() - 1);
+            STORM_LOG_DEBUG("Parsing the states in " << chunkBoundaries.size() - 1 << " chunks with " << numberOfThreads << " threads.");
+            storm::utility::parallel::execute(numberOfThreads, chunkBoundaries.size() - 1, [&] (uint64_t chunk) {
+                parseStateChunk(chunkBoundaries[chunk], chunkBoundaries[chunk + 1], type, stateSize, placeholders, valueParser, options, chunks[firstChunk + chunk]);
+            });
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+        DirectEncodingParser<ValueType, RewardModelType>::buildModelComponents(std::vector<StateChunk>& chunks, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+                                                                               std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options, uint64_t numberOfThreads) {
             // Initialize
             auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
             bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
             bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-            storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
+
+            // Compute the offsets of the chunks.
+            std::vector<uint64_t> stateOffsets(chunks.size() + 1, 0);
+            std::vector<uint64_t> rowOffsets(chunks.size() + 1, 0);
+            std::vector<uint64_t> entryOffsets(chunks.size() + 1, 0);
+            for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                STORM_LOG_ASSERT(chunks[chunk].stateCount == 0 || chunks[chunk].firstStateId == stateOffsets[chunk], "State ids do not correspond.");
+                stateOffsets[chunk + 1] = stateOffsets[chunk] + chunks[chunk].stateCount;
+                rowOffsets[chunk + 1] = rowOffsets[chunk] + chunks[chunk].rowCount;
+                entryOffsets[chunk + 1] = entryOffsets[chunk] + chunks[chunk].transitions.getEntryCount();
+            }
+            uint64_t rowCount = rowOffsets.back();
+            STORM_LOG_THROW(stateOffsets.back() == stateSize, storm::exceptions::WrongFormatException, "Found " << stateOffsets.back() << " states, but expected " << stateSize << " states.");
+
+            // Build transition matrix
+            if (chunks.size() == 1) {
+                modelComponents->transitionMatrix = std::move(chunks.front().transitions);
+            } else {
+                // Copy the transitions of the chunks to their final positions.
+                std::vector<uint64_t> rowIndications(rowCount + 1, entryOffsets.back());
+                std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues(entryOffsets.back());
+                boost::optional<std::vector<uint64_t>> rowGroupIndices;
+                if (nonDeterministic) {
+                    rowGroupIndices = std::vector<uint64_t>(stateSize + 1, rowCount);
+                }
+                storm::utility::parallel::execute(numberOfThreads, chunks.size(), [&] (uint64_t chunk) {
+                    auto& transitions = chunks[chunk].transitions;
+                    for (uint64_t row = 0; row < chunks[chunk].rowCount; ++row) {
+                        rowIndications[rowOffsets[chunk] + row] = entryOffsets[chunk] + std::distance(transitions.begin(), transitions.begin(row));
+                    }
+                    std::copy(transitions.begin(), transitions.end(), columnsAndValues.begin() + entryOffsets[chunk]);
+                    if (nonDeterministic) {
+                        for (uint64_t state = 0; state < chunks[chunk].stateCount; ++state) {
+                            rowGroupIndices.get()[stateOffsets[chunk] + state] = rowOffsets[chunk] + transitions.getRowGroupIndices()[state];
+                        }
+                    }
+                    transitions = storm::storage::SparseMatrix<ValueType>();
+                });
+                modelComponents->transitionMatrix = storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+            }
+            STORM_LOG_TRACE("Built matrix");
+
+            // Build labelings
             modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
-            modelComponents->observabilityClasses = std::vector<uint32_t>();
-            modelComponents->observabilityClasses->resize(stateSize);
             if (options.buildChoiceLabeling) {
                 modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
             }
-            std::vector<std::vector<ValueType>> stateRewards;
-            std::vector<std::vector<ValueType>> actionRewards;
+            for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                for (auto const& labelAndStates : chunks[chunk].stateLabels) {
+                    if (!modelComponents->stateLabeling.containsLabel(labelAndStates.first)) {
+                        modelComponents->stateLabeling.addLabel(labelAndStates.first);
+                    }
+                    for (auto const& state : labelAndStates.second) {
+                        modelComponents->stateLabeling.addLabelToState(labelAndStates.first, stateOffsets[chunk] + state);
+                    }
+                }
+                for (auto const& labelAndChoices : chunks[chunk].choiceLabels) {
+                    if (!modelComponents->choiceLabeling.get().containsLabel(labelAndChoices.first)) {
+                        modelComponents->choiceLabeling.get().addLabel(labelAndChoices.first);
+                    }
+                    for (auto const& choice : labelAndChoices.second) {
+                        modelComponents->choiceLabeling.get().addLabelToChoice(labelAndChoices.first, rowOffsets[chunk] + choice);
+                    }
+                }
+            }
+
+            // Build the vectors of the states
+            modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize, 0);
             if (continuousTime) {
-                modelComponents->exitRates = std::vector<ValueType>(stateSize);
+                modelComponents->exitRates = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
                 if (type == storm::models::ModelType::MarkovAutomaton) {
                     modelComponents->markovianStates = storm::storage::BitVector(stateSize);
                 }
@@ -160,6 +400,75 @@ namespace storm {
             if (type == storm::models::ModelType::Ctmc) {
                 modelComponents->rateTransitions = true;
             }
+            uint64_t numStateRewardModels = 0;
+            uint64_t numActionRewardModels = 0;
+            for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                std::copy(chunks[chunk].observations.begin(), chunks[chunk].observations.end(), modelComponents->observabilityClasses.get().begin() + stateOffsets[chunk]);
+                if (continuousTime) {
+                    std::copy(chunks[chunk].exitRates.begin(), chunks[chunk].exitRates.end(), modelComponents->exitRates.get().begin() + stateOffsets[chunk]);
+                }
+                numStateRewardModels = std::max<uint64_t>(numStateRewardModels, chunks[chunk].stateRewards.size());
+                numActionRewardModels = std::max<uint64_t>(numActionRewardModels, chunks[chunk].actionRewards.size());
+            }
+            if (type == storm::models::ModelType::MarkovAutomaton) {
+                for (uint64_t state = 0; state < stateSize; ++state) {
+                    if (!storm::utility::isZero<ValueType>(modelComponents->exitRates.get()[state])) {
+                        modelComponents->markovianStates.get().set(state);
+                    }
+                }
+            }
+
+            // Build reward models
+            uint64_t numRewardModels = std::max(numStateRewardModels, numActionRewardModels);
+            for (uint64_t i = 0; i < numRewardModels; ++i) {
+                std::string rewardModelName;
+                if (rewardModelNames.size() <= i) {
+                    rewardModelName = "rew" + std::to_string(i);
+                } else {
+                    rewardModelName = rewardModelNames[i];
+                }
+                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+                for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                    if (i < chunks[chunk].stateRewards.size() && !chunks[chunk].stateRewards[i].empty()) {
+                        if (!stateRewardVector) {
+                            stateRewardVector = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+                        }
+                        std::move(chunks[chunk].stateRewards[i].begin(), chunks[chunk].stateRewards[i].end(), stateRewardVector.get().begin() + stateOffsets[chunk]);
+                    }
+                    if (i < chunks[chunk].actionRewards.size() && !chunks[chunk].actionRewards[i].empty()) {
+                        if (!actionRewardVector) {
+                            actionRewardVector = std::vector<ValueType>(rowCount, storm::utility::zero<ValueType>());
+                        }
+                        std::move(chunks[chunk].actionRewards[i].begin(), chunks[chunk].actionRewards[i].end(), actionRewardVector.get().begin() + rowOffsets[chunk]);
+                    }
+                }
+                modelComponents->rewardModels.emplace(rewardModelName,
+                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+            }
+            STORM_LOG_TRACE("Built reward models");
+            return modelComponents;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void DirectEncodingParser<ValueType, RewardModelType>::parseStateChunk(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize,
+                                                                               std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                                                               DirectEncodingParserOptions const& options, StateChunk& chunk) {
+            // Initialize
+            bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+            bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+            storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
+            std::unordered_map<std::string, uint64_t> stateLabelIndices;
+            std::unordered_map<std::string, uint64_t> choiceLabelIndices;
+
+            // Labels are separated by whitespace and can optionally be enclosed in quotation marks
+            // Regex for labels with two cases:
+            // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+            //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+            //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
+            // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+            //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+            //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+            std::regex const labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
 
             // Iterate over all lines
             std::string line;
@@ -167,7 +476,16 @@ namespace storm {
             size_t state = 0;
             bool firstState = true;
             bool firstActionForState = true;
-            while (storm::utility::getline(file, line)) {
+            char const* position = begin;
+            while (position != end) {
+                char const* lineEnd = std::find(position, end, '\n');
+                line.assign(position, lineEnd);
+                position = lineEnd == end ? end : lineEnd + 1;
+                // Remove linebreaks
+                while (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+
                 if (boost::starts_with(line, "//")) {
                     continue;
                 }
@@ -194,7 +512,10 @@ namespace storm {
                         line = "";
                     }
                     size_t parsedId = parseNumber<size_t>(curString);
-                    STORM_LOG_ASSERT(state == parsedId, "State ids do not correspond.");
+                    if (state == 0) {
+                        chunk.firstStateId = parsedId;
+                    }
+                    STORM_LOG_ASSERT(chunk.firstStateId + state == parsedId, "State ids do not correspond.");
                     if (nonDeterministic) {
                         STORM_LOG_TRACE("new Row Group starts at " << row << ".");
                         builder.newRowGroup(row);
@@ -213,11 +534,9 @@ namespace storm {
                             line = "";
                         }
                         ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                        if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                            modelComponents->markovianStates.get().set(state);
-                        }
                         STORM_LOG_TRACE("Exit rate " << exitRate);
-                        modelComponents->exitRates.get()[state] = exitRate;
+                        chunk.exitRates.resize(state + 1, storm::utility::zero<ValueType>());
+                        chunk.exitRates[state] = exitRate;
                     }
 
                     if (boost::starts_with(line, "[")) {
@@ -228,15 +547,15 @@ namespace storm {
                         STORM_LOG_TRACE("State rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (stateRewards.size() < rewards.size()) {
-                            stateRewards.resize(rewards.size());
+                        if (chunk.stateRewards.size() < rewards.size()) {
+                            chunk.stateRewards.resize(rewards.size());
                         }
-                        auto stateRewardsIt = stateRewards.begin();
+                        auto stateRewardsIt = chunk.stateRewards.begin();
                         for (auto const& rew : rewards) {
                             auto rewardValue = parseValue(rew, placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
-                                if (stateRewardsIt->empty()) {
-                                    stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
+                                if (stateRewardsIt->size() <= state) {
+                                    stateRewardsIt->resize(state + 1, storm::utility::zero<ValueType>());
                                 }
                                 (*stateRewardsIt)[state] = std::move(rewardValue);
                             }
@@ -251,26 +570,17 @@ namespace storm {
                             size_t posEndObservation = line.find("}");
                             std::string observation = line.substr(1, posEndObservation - 1);
                             STORM_LOG_TRACE("State observation " << observation);
-                            modelComponents->observabilityClasses.get()[state] = std::stoi(observation);
+                            chunk.observations.resize(state + 1, 0);
+                            chunk.observations[state] = std::stoi(observation);
                             line = line.substr(posEndObservation + 1);
                         } else {
-                            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << ".");
+                            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << chunk.firstStateId + state << ".");
                         }
                     }
 
                     // Parse labels
                     if (!line.empty()) {
                         std::vector<std::string> labels;
-                        // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                        // Regex for labels with two cases:
-                        // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                        //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                        //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
-                        // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                        //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                        //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                        std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
                         // Iterate over matches
                         auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
                         auto match_end = std::sregex_iterator();
@@ -285,10 +595,7 @@ namespace storm {
                         }
 
                         for (std::string const& label : labels) {
-                            if (!modelComponents->stateLabeling.containsLabel(label)) {
-                                modelComponents->stateLabeling.addLabel(label);
-                            }
-                            modelComponents->stateLabeling.addLabelToState(label, state);
+                            addLabelToItem(chunk.stateLabels, stateLabelIndices, label, state);
                             STORM_LOG_TRACE("New label: '" << label << "'");
                         }
                     }
@@ -314,10 +621,7 @@ namespace storm {
                     // curString contains action name.
                     if (options.buildChoiceLabeling) {
                         if (curString != "__NOLABEL__") {
-                            if (!modelComponents->choiceLabeling.get().containsLabel(curString)) {
-                                modelComponents->choiceLabeling.get().addLabel(curString);
-                            }
-                            modelComponents->choiceLabeling.get().addLabelToChoice(curString, row);
+                            addLabelToItem(chunk.choiceLabels, choiceLabelIndices, curString, row);
                         }
                     }
                     // Check for rewards
@@ -329,15 +633,15 @@ namespace storm {
                         STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (actionRewards.size() < rewards.size()) {
-                            actionRewards.resize(rewards.size());
+                        if (chunk.actionRewards.size() < rewards.size()) {
+                            chunk.actionRewards.resize(rewards.size());
                         }
-                        auto actionRewardsIt = actionRewards.begin();
+                        auto actionRewardsIt = chunk.actionRewards.begin();
                         for (auto const& rew : rewards) {
                             auto rewardValue = parseValue(rew, placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
                                 if (actionRewardsIt->size() <= row) {
-                                    actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
+                                    actionRewardsIt->resize(row + 1, storm::utility::zero<ValueType>());
                                 }
                                 (*actionRewardsIt)[row] = std::move(rewardValue);
                             }
@@ -359,40 +663,18 @@ namespace storm {
                 }
 
                 if (storm::utility::resources::isTerminate()) {
-                    std::cout << "Parsed " << state << "/" << stateSize << " states before abort." << std::endl;
                     STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
                     break;
                 }
 
             } // end state iteration
-            STORM_LOG_TRACE("Finished parsing");
-
-            // Build transition matrix
-            modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-            STORM_LOG_TRACE("Built matrix");
 
-            // Build reward models
-            uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-            for (uint64_t i = 0; i < numRewardModels; ++i) {
-                std::string rewardModelName;
-                if (rewardModelNames.size() <= i) {
-                    rewardModelName = "rew" + std::to_string(i);
-                } else {
-                    rewardModelName = rewardModelNames[i];
-                }
-                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-                if (i < stateRewards.size() && !stateRewards[i].empty()) {
-                    stateRewardVector = std::move(stateRewards[i]);
-                }
-                if (i < actionRewards.size() && !actionRewards[i].empty()) {
-                    actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-                    actionRewardVector = std::move(actionRewards[i]);
-                }
-                modelComponents->rewardModels.emplace(rewardModelName,
-                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+            // Build the transitions of the chunk
+            if (!firstState) {
+                chunk.stateCount = state + 1;
+                chunk.rowCount = row + 1;
             }
-            STORM_LOG_TRACE("Built reward models");
-            return modelComponents;
+            chunk.transitions = builder.build(chunk.rowCount, stateSize, nonDeterministic ? chunk.stateCount : 0);
         }
 
         template<typename ValueType, typename RewardModelType>
@@ -11,6 +11,8 @@ namespace storm {
 
         struct DirectEncodingParserOptions {
             bool buildChoiceLabeling = false;
+            // The number of threads used to parse the states (only for floating point numbers).
+            uint64_t numberOfThreads = 1;
         };
         /*!
          *	Parser for models in the DRN format with explicit encoding.
@@ -31,9 +33,16 @@ namespace storm {
         private:
 
             /*!
-             * Parse states and return transition matrix.
+             * The components of the model that are parsed from a consecutive range of states.
+             */
+            struct StateChunk;
+
+            /*!
+             * Parse states and return transition matrix. The states are split into chunks that are parsed in parallel
+             * if more than one thread is requested.
              *
-             * @param file Input file stream.
+             * @param begin The first character of the states.
+             * @param end The position behind the last character of the states.
              * @param type Model type.
              * @param stateSize No. of states
              * @param placeholders Placeholders for values.
@@ -43,9 +52,43 @@ namespace storm {
              * @return Transition matrix.
              */
             static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+            parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
+                        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+            /*!
+             * Parse states from the remainder of the given stream and return transition matrix. The stream is read in
+             * blocks of bounded size whose states are parsed before the next block is read.
+             *
+             * @param file The stream whose remainder contains the states.
+             */
+            static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
             parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
                         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+            /*!
+             * Splits the given range of states into chunks and parses them (in parallel if more than one thread is given).
+             * The chunks are appended to the given ones.
+             */
+            static void parseStateChunks(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                                         ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options, uint64_t numberOfThreads, std::vector<StateChunk>& chunks);
+
+            /*!
+             * Joins the given chunks of consecutive states into the model components.
+             */
+            static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+            buildModelComponents(std::vector<StateChunk>& chunks, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::vector<std::string> const& rewardModelNames,
+                                 DirectEncodingParserOptions const& options, uint64_t numberOfThreads);
+
+            /*!
+             * Parse a consecutive range of states. States, rows and row groups are numbered relative to the chunk.
+             *
+             * @param begin The first character of the chunk, which is the beginning of a line.
+             * @param end The position behind the last character of the chunk.
+             * @param chunk The chunk that is filled with the parsed components.
+             */
+            static void parseStateChunk(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                                        ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options, StateChunk& chunk);
+
             /*!
              * Parse value from string while using placeholders.
              * @param valueStr String.
@@ -2,7 +2,9 @@
 
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/io/BinaryEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
+#include "storm/io/compression.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
@@ -23,13 +25,33 @@ namespace storm {
         void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& filename);
 
         template <typename ValueType>
-        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders=true) {
-            std::ofstream stream;
-            storm::utility::openFile(filename, stream);
+        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders=true, uint64_t numberOfThreads = 1) {
             storm::exporter::DirectEncodingOptions options;
             options.allowPlaceholders = allowPlaceholders;
-            storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
-            storm::utility::closeFile(stream);
+            options.numberOfThreads = numberOfThreads;
+            if (storm::utility::isGzipFilename(filename)) {
+                // Files ending with .gz are compressed while they are written.
+                STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+                storm::utility::GzipOutputFileStream stream(filename);
+                stream.precision(std::cout.precision());
+                storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+                stream.close();
+            } else {
+                std::ofstream stream;
+                storm::utility::openFile(filename, stream);
+                storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+                storm::utility::closeFile(stream);
+            }
+        }
+
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting exact or parametric models in the binary format is not supported.");
+        }
+
+        template <>
+        inline void exportSparseModelAsBinary<double>(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            storm::exporter::binaryExportSparseModel(filename, model);
         }
 
         template<storm::dd::DdType Type, typename ValueType>
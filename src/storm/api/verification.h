@@ -10,6 +10,7 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseModelCheckerCache.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
@@ -161,7 +162,7 @@ namespace storm {
         // Verifying with Sparse engine
         //
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseModelCheckerCache<ValueType>> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
                 storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
@@ -169,7 +170,7 @@ namespace storm {
                     result = modelchecker.check(env, task);
                 }
             } else {
-                storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc, cache);
                 if (modelchecker.canHandle(task)) {
                     result = modelchecker.check(env, task);
                 }
@@ -199,10 +200,24 @@ namespace storm {
             return verifyWithSparseEngine(env, ctmc, task);
         }
 
+        /*!
+         * Checks a property of the form P=? [phi U<=t psi] (or P=? [F<=t psi]) for each of the given time bounds t
+         * (instead of the time bound of the property). All time bounds are treated in a single pass.
+         *
+         * @return The result for each time bound.
+         */
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperTimeBounds) {
+            storm::logic::Formula const& formula = task.getFormula();
+            STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && !formula.asProbabilityOperatorFormula().hasBound() && formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(), storm::exceptions::NotSupportedException, "Checking several time bounds requires a property of the form P=? [phi U<=t psi], but got " << formula << ".");
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            return modelchecker.computeBoundedUntilProbabilities(env, task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula()), upperTimeBounds);
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseModelCheckerCache<ValueType>> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
-            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp, cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -210,7 +225,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseModelCheckerCache<ValueType>> const& = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
             if (modelchecker.canHandle(task)) {
@@ -275,13 +290,19 @@ namespace storm {
         }
 
 
+        /*!
+         * Checks the given task on the given model.
+         *
+         * @param cache If given, DTMCs and MDPs are checked with this cache, which holds data that can be reused by
+         * later tasks on the same model (e.g. equation systems). Pass the same cache for all tasks on the model.
+         */
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseModelCheckerCache<ValueType>> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (model->getType() == storm::models::ModelType::Dtmc) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::Mdp) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::Ctmc) {
                 result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
@@ -1,7 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
 #include <map>
-
+#include <mutex>
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
@@ -20,7 +24,9 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Automaton.h"
@@ -32,7 +38,9 @@
 #include "storm/utility/prism.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 
 
 namespace storm {
@@ -54,7 +62,7 @@ namespace storm {
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads()) {
             // Intentionally left empty.
         }
 
@@ -135,6 +143,24 @@ namespace storm {
                 stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
             }
 
+            // Explore the model in parallel if requested and possible.
+            if (options.numberOfThreads > 1) {
+                std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generatorCopy;
+                if (options.explorationOrder != ExplorationOrder::Bfs) {
+                    STORM_LOG_INFO("Exploring the model sequentially as the parallel exploration requires the breadth-first exploration order.");
+                } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                    STORM_LOG_INFO("Exploring the model sequentially as the parallel exploration does not support labeling states with overlapping guards.");
+                } else if (storm::NumberTraits<ValueType>::IsExact) {
+                    // Exact numbers may share (reference counted) state that is not thread-safe.
+                    STORM_LOG_INFO("Exploring the model sequentially as the parallel exploration is only supported for floating point numbers.");
+                } else if (!(generatorCopy = generator->clone())) {
+                    STORM_LOG_INFO("Exploring the model sequentially as the parallel exploration is not supported by the next-state generator.");
+                } else {
+                    buildMatricesInParallel(generatorCopy, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                    return;
+                }
+            }
+
             // Create a callback for the next-state generator to enable it to request the index of states.
             std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
 
@@ -181,100 +207,7 @@ namespace storm {
                 }
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
 
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        // This state shall be Markovian (to not introduce Zeno behavior)
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-                        // Other state-based information does not need to be treated, in particular:
-                        // * StateValuations have already been set above
-                        // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-
-                    // Now add all choices.
-                    bool firstChoiceOfState = true;
-                    for (auto const& choice : behavior) {
-
-                        // add the generated choice information
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                            stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                            STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
-                            if (firstChoiceOfState) {
-                                stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                        firstChoiceOfState = false;
-                    }
-
-                    ++currentRowGroup;
-                }
+                addStateBehaviorToMatrices(currentState, currentIndex, behavior, 0, nullptr, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
 
                 ++numberOfExploredStates;
                 if (generator->getOptions().isShowProgressSet()) {
@@ -327,6 +260,256 @@ namespace storm {
             }
         }
 
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesInParallel(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generatorCopy, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            STORM_LOG_DEBUG("Exploring the model with " << options.numberOfThreads << " threads.");
+
+            // Let the generator create all initial states.
+            std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+            this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+            STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+
+            // The states are taken from the queue in batches of bounded size. The states of a batch are split into
+            // chunks that are expanded in parallel. Meanwhile, the state storage is only read: states that are not yet
+            // stored get temporary indices (from the number of stored states on) from a map that is shared by all
+            // chunks of the batch. Afterwards, the new states are added to the storage in the order of the sequential
+            // search, which yields their final indices, and the behaviors of the batch are added to the matrices.
+            struct ChunkData {
+                // The temporary indices of the new states in the order in which they are requested by the chunk.
+                std::vector<StateType> requestedTemporaryIndices;
+                // The new states that were inserted into the shared map by this chunk and their temporary indices.
+                std::vector<std::pair<StateType, CompressedState>> newStates;
+            };
+            uint64_t const maximalChunkSize = 256;
+            uint64_t const maximalBatchSize = 8 * options.numberOfThreads * maximalChunkSize;
+            std::vector<std::pair<CompressedState, StateType>> batch;
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+            std::vector<CompressedState> temporaryStates;
+            std::vector<StateType> temporaryToFinalIndex;
+
+            // The generators that are currently not used by any thread.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> availableGenerators = {generator, generatorCopy};
+            std::mutex generatorMutex;
+
+            uint_fast64_t currentRowGroup = 0;
+            uint_fast64_t currentRow = 0;
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+            while (!statesToExplore.empty()) {
+                // The queue holds the states ordered by their final index.
+                uint64_t batchSize = std::min<uint64_t>(maximalBatchSize, statesToExplore.size());
+                batch.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.begin() + batchSize));
+                statesToExplore.erase(statesToExplore.begin(), statesToExplore.begin() + batchSize);
+                StateType const firstTemporaryIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+
+                // Expand the states of the batch in parallel. Small chunks balance the load among the threads.
+                uint64_t chunkSize = std::max<uint64_t>(1, std::min<uint64_t>(maximalChunkSize, batchSize / (8 * options.numberOfThreads)));
+                std::vector<ChunkData> chunks((batchSize + chunkSize - 1) / chunkSize);
+                storm::storage::ConcurrentBitVectorHashMap<StateType> temporaryStateToId(generator->getStateSize(), batchSize);
+                std::atomic<StateType> numberOfTemporaryStates(0);
+                behaviors.clear();
+                behaviors.resize(batchSize);
+                storm::utility::parallel::execute(options.numberOfThreads, chunks.size(), [&] (uint64_t chunk) {
+                    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> chunkGenerator;
+                    {
+                        std::lock_guard<std::mutex> lock(generatorMutex);
+                        if (availableGenerators.empty()) {
+                            chunkGenerator = generator->clone();
+                        } else {
+                            chunkGenerator = availableGenerators.back();
+                            availableGenerators.pop_back();
+                        }
+                    }
+                    ChunkData& chunkData = chunks[chunk];
+                    std::function<StateType (CompressedState const&)> chunkStateToIdCallback = [&] (CompressedState const& state) {
+                        boost::optional<StateType> index = stateStorage.stateToId.find(state);
+                        if (index) {
+                            return index.get();
+                        }
+                        // Only the thread that inserts the state draws a temporary index, so the indices are dense.
+                        StateType temporaryIndex = temporaryStateToId.findOrAdd(state, [&] () {
+                            StateType newIndex = numberOfTemporaryStates.fetch_add(1, std::memory_order_relaxed);
+                            chunkData.newStates.emplace_back(newIndex, state);
+                            return newIndex;
+                        }).first;
+                        chunkData.requestedTemporaryIndices.push_back(temporaryIndex);
+                        return static_cast<StateType>(firstTemporaryIndex + temporaryIndex);
+                    };
+                    for (uint64_t position = chunk * chunkSize, positionEnd = std::min<uint64_t>(batchSize, position + chunkSize); position < positionEnd; ++position) {
+                        chunkGenerator->load(batch[position].first);
+                        behaviors[position] = chunkGenerator->expand(chunkStateToIdCallback);
+                    }
+                    std::lock_guard<std::mutex> lock(generatorMutex);
+                    availableGenerators.push_back(chunkGenerator);
+                });
+
+                // Add the new states in the order of the sequential search, i.e., in the order of their first request
+                // when the chunks are processed one after another. As the states are added to the queue of states to
+                // explore, this also determines the next batches.
+                StateType const noIndex = std::numeric_limits<StateType>::max();
+                temporaryStates.assign(numberOfTemporaryStates.load(), CompressedState());
+                temporaryToFinalIndex.assign(numberOfTemporaryStates.load(), noIndex);
+                for (auto& chunkData : chunks) {
+                    for (auto& indexStatePair : chunkData.newStates) {
+                        temporaryStates[indexStatePair.first] = std::move(indexStatePair.second);
+                    }
+                }
+                for (auto const& chunkData : chunks) {
+                    for (auto const& temporaryIndex : chunkData.requestedTemporaryIndices) {
+                        if (temporaryToFinalIndex[temporaryIndex] == noIndex) {
+                            temporaryToFinalIndex[temporaryIndex] = getOrAddStateIndex(temporaryStates[temporaryIndex]);
+                        }
+                    }
+                }
+
+                // Add the behaviors to the matrices in the order of the sequential search.
+                for (uint64_t position = 0; position < batchSize; ++position) {
+                    CompressedState const& currentState = batch[position].first;
+                    StateType currentIndex = batch[position].second;
+                    STORM_LOG_ASSERT(currentIndex == currentRowGroup, "Unexpected index of explored state.");
+                    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                        generator->load(currentState);
+                        generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                    }
+                    addStateBehaviorToMatrices(currentState, currentIndex, behaviors[position], firstTemporaryIndex, &temporaryToFinalIndex, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                }
+
+                if (generator->getOptions().isShowProgressSet()) {
+                    numberOfExploredStatesSinceLastMessage += batchSize;
+
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / std::max<int64_t>(1, durationSinceLastMessage);
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesSinceLastMessage = 0;
+                    }
+                }
+
+                if (storm::utility::resources::isTerminate()) {
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                    std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+                }
+            }
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehaviorToMatrices(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, StateType firstTemporaryIndex, std::vector<StateType> const* temporaryToFinalIndex, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+                    }
+
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+
+                    transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    // This state shall be Markovian (to not introduce Zeno behavior)
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+                    // Other state-based information does not need to be treated, in particular:
+                    // * StateValuations have already been set by the caller
+                    // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+
+                // Now add all choices.
+                bool firstChoiceOfState = true;
+                std::vector<std::pair<StateType, ValueType>> remappedEntries;
+                for (auto const& choice : behavior) {
+
+                    // add the generated choice information
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                        stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                        STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
+                        if (firstChoiceOfState) {
+                            stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+
+                    // Add the probabilistic behavior to the matrix.
+                    if (temporaryToFinalIndex) {
+                        // As the order of the states changes, the entries need to be sorted again.
+                        remappedEntries.clear();
+                        for (auto const& stateProbabilityPair : choice) {
+                            StateType index = stateProbabilityPair.first < firstTemporaryIndex ? stateProbabilityPair.first : (*temporaryToFinalIndex)[stateProbabilityPair.first - firstTemporaryIndex];
+                            remappedEntries.emplace_back(index, stateProbabilityPair.second);
+                        }
+                        std::sort(remappedEntries.begin(), remappedEntries.end(), [] (std::pair<StateType, ValueType> const& first, std::pair<StateType, ValueType> const& second) { return first.first < second.first; });
+                        for (auto const& stateProbabilityPair : remappedEntries) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                    firstChoiceOfState = false;
+                }
+
+                ++currentRowGroup;
+            }
+        }
+
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
 
@@ -78,6 +78,10 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads used to explore the model. Using more than one thread requires the breadth-first
+                // exploration order and a generator that can be copied. Otherwise, the model is explored sequentially.
+                uint64_t numberOfThreads;
             };
             
             /*!
@@ -137,6 +141,36 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+            /*!
+             * Builds the transition matrix and the transition reward matrix by exploring batches of states of the
+             * breadth-first search in parallel, where each thread uses its own copy of the generator. Afterwards, the
+             * states are numbered exactly as in the sequential breadth-first search, so the result does not depend on
+             * the number of threads. Compared to the sequential exploration, the behaviors and the new states of one
+             * batch (whose size is bounded) are additionally kept in memory.
+             *
+             * @param generatorCopy A copy of the generator.
+             * @param transitionMatrixBuilder The builder of the transition matrix.
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+             */
+            void buildMatricesInParallel(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generatorCopy, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+            /*!
+             * Adds the given behavior of the given state to the matrix builders.
+             *
+             * @param state The state whose behavior is added.
+             * @param stateIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param firstTemporaryIndex The smallest index of a state in the behavior that is temporary (if the temporary indices are given).
+             * @param temporaryToFinalIndex If given, the temporary indices of states in the behavior are mapped to the indices in this vector (shifted by the first temporary index).
+             * @param currentRow The index of the first row of the state, which is advanced to the next free row.
+             * @param currentRowGroup The index of the row group of the state, which is advanced to the next row group.
+             * @param transitionMatrixBuilder The builder of the transition matrix.
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+             */
+            void addStateBehaviorToMatrices(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, StateType firstTemporaryIndex, std::vector<StateType> const* temporaryToFinalIndex, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
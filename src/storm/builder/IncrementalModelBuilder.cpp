@@ -0,0 +1,235 @@
+#include "storm/builder/IncrementalModelBuilder.h"
+
+#include <sstream>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/transformer/SubsystemBuilder.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace builder {
+
+        template<typename ValueType>
+        IncrementalModelBuilder<ValueType>::IncrementalModelBuilder(storm::storage::SymbolicModelDescription const& modelDescription, BuilderOptions const& options) : modelDescription(modelDescription), options(options) {
+            buildParametricModel();
+        }
+
+        template<typename ValueType>
+        void IncrementalModelBuilder<ValueType>::buildParametricModel() {
+            if (!modelDescription.hasUndefinedConstants()) {
+                return;
+            }
+
+            // Substituting the formulas (or functions) first reveals all places in which the constants occur.
+            storm::storage::SymbolicModelDescription preprocessedDescription = modelDescription.preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression>());
+            bool graphPreserving = preprocessedDescription.isPrismProgram() ? preprocessedDescription.asPrismProgram().undefinedConstantsAreGraphPreserving() : preprocessedDescription.asJaniModel().undefinedConstantsAreGraphPreserving();
+            if (!graphPreserving) {
+                STORM_LOG_INFO("The undefined constants influence the structure of the model, which is therefore built anew for all values of the constants.");
+                return;
+            }
+
+            try {
+                if (preprocessedDescription.isPrismProgram()) {
+                    parametricModel = ExplicitModelBuilder<storm::RationalFunction>(preprocessedDescription.asPrismProgram(), options).build();
+                } else {
+                    parametricModel = ExplicitModelBuilder<storm::RationalFunction>(preprocessedDescription.asJaniModel(), options).build();
+                }
+            } catch (storm::exceptions::InvalidArgumentException const& e) {
+                // This happens for example if a constant occurs in the condition of an if-then-else expression.
+                STORM_LOG_INFO("The undefined constants can not be treated as parameters (" << e.what() << "). The model is built anew for all values of the constants.");
+                return;
+            }
+
+            storm::models::ModelType type = parametricModel->getType();
+            bool supportedType = type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp;
+            for (auto const& rewardModel : parametricModel->getRewardModels()) {
+                supportedType &= !rewardModel.second.hasTransitionRewards();
+            }
+            if (!supportedType) {
+                STORM_LOG_INFO("Reusing the structure of models of type " << type << " is not supported. The model is built anew for all values of the constants.");
+                parametricModel = nullptr;
+                return;
+            }
+
+            for (auto const& parameter : storm::models::sparse::getAllParameters(*parametricModel)) {
+                std::stringstream parameterName;
+                parameterName << parameter;
+                parameters.emplace(parameterName.str(), parameter);
+            }
+
+            // Connect the values of the model with the distinct functions.
+            auto const& matrix = parametricModel->getTransitionMatrix();
+            transitionPlaceholders.reserve(matrix.getEntryCount());
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    transitionPlaceholders.push_back(getPlaceholder(entry.getValue()));
+                }
+            }
+            if (type == storm::models::ModelType::MarkovAutomaton) {
+                exitRatePlaceholders = getPlaceholders(parametricModel->template as<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>>()->getExitRates());
+            }
+            for (auto const& rewardModel : parametricModel->getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    stateRewardPlaceholders.emplace(rewardModel.first, getPlaceholders(rewardModel.second.getStateRewardVector()));
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    stateActionRewardPlaceholders.emplace(rewardModel.first, getPlaceholders(rewardModel.second.getStateActionRewardVector()));
+                }
+            }
+            STORM_LOG_INFO("Built the structure of the model once with " << parameters.size() << " constants as parameters and " << functions.size() << " distinct functions.");
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalModelBuilder<ValueType>::build(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+            if (isReusingStructure()) {
+                std::shared_ptr<storm::models::sparse::Model<ValueType>> model = instantiate(constantDefinitions);
+                if (model) {
+                    return model;
+                }
+                STORM_LOG_INFO("The values of the constants remove all transitions of a state. The model is built anew.");
+            }
+
+            storm::storage::SymbolicModelDescription preprocessedDescription = modelDescription.preprocess(constantDefinitions);
+            if (preprocessedDescription.isPrismProgram()) {
+                return ExplicitModelBuilder<ValueType>(preprocessedDescription.asPrismProgram(), options).build();
+            } else {
+                return ExplicitModelBuilder<ValueType>(preprocessedDescription.asJaniModel(), options).build();
+            }
+        }
+
+        template<typename ValueType>
+        bool IncrementalModelBuilder<ValueType>::isReusingStructure() const {
+            return parametricModel != nullptr;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalModelBuilder<ValueType>::instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            for (auto const& definition : constantDefinitions) {
+                auto parameterIt = parameters.find(definition.first.getName());
+                if (parameterIt != parameters.end()) {
+                    valuation.emplace(parameterIt->second, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(definition.second.evaluateAsRational()));
+                }
+            }
+            STORM_LOG_THROW(valuation.size() == parameters.size(), storm::exceptions::InvalidArgumentException, "Not all undefined constants of the model are given a value.");
+
+            // Evaluate every distinct function once.
+            for (auto& function : functions) {
+                function.second = storm::utility::convertNumber<ValueType>(function.first.evaluate(valuation));
+            }
+
+            // Assemble the transition matrix from the values without the entries that became zero.
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+            auto const& parametricMatrix = parametricModel->getTransitionMatrix();
+            std::vector<IndexType> rowIndications;
+            rowIndications.reserve(parametricMatrix.getRowCount() + 1);
+            rowIndications.push_back(0);
+            std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> columnsAndValues;
+            columnsAndValues.reserve(parametricMatrix.getEntryCount());
+            auto placeholderIt = transitionPlaceholders.begin();
+            for (uint64_t row = 0; row < parametricMatrix.getRowCount(); ++row) {
+                for (auto const& entry : parametricMatrix.getRow(row)) {
+                    ValueType const& value = **placeholderIt;
+                    ++placeholderIt;
+                    if (!storm::utility::isZero(value)) {
+                        columnsAndValues.emplace_back(entry.getColumn(), value);
+                    }
+                }
+                if (columnsAndValues.size() == rowIndications.back()) {
+                    return nullptr;
+                }
+                rowIndications.push_back(columnsAndValues.size());
+            }
+            boost::optional<std::vector<IndexType>> rowGroupIndices;
+            if (!parametricMatrix.hasTrivialRowGrouping()) {
+                rowGroupIndices = parametricMatrix.getRowGroupIndices();
+            }
+            storm::storage::sparse::ModelComponents<ValueType> components(storm::storage::SparseMatrix<ValueType>(parametricMatrix.getColumnCount(), std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices)), storm::models::sparse::StateLabeling(parametricModel->getStateLabeling()));
+
+            for (auto const& rewardModel : parametricModel->getRewardModels()) {
+                boost::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+                auto stateRewardIt = stateRewardPlaceholders.find(rewardModel.first);
+                if (stateRewardIt != stateRewardPlaceholders.end()) {
+                    stateRewards = getValues(stateRewardIt->second);
+                }
+                auto stateActionRewardIt = stateActionRewardPlaceholders.find(rewardModel.first);
+                if (stateActionRewardIt != stateActionRewardPlaceholders.end()) {
+                    stateActionRewards = getValues(stateActionRewardIt->second);
+                }
+                components.rewardModels.emplace(rewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards)));
+            }
+
+            components.choiceLabeling = parametricModel->getOptionalChoiceLabeling();
+            components.stateValuations = parametricModel->getOptionalStateValuations();
+            components.choiceOrigins = parametricModel->getOptionalChoiceOrigins();
+            storm::models::ModelType type = parametricModel->getType();
+            if (type == storm::models::ModelType::Ctmc) {
+                // The transition matrix of CTMCs holds the rates.
+                components.rateTransitions = true;
+            } else if (type == storm::models::ModelType::MarkovAutomaton) {
+                components.exitRates = getValues(exitRatePlaceholders);
+                components.markovianStates = parametricModel->template as<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>>()->getMarkovianStates();
+            } else if (type == storm::models::ModelType::Pomdp) {
+                auto const& pomdp = *parametricModel->template as<storm::models::sparse::Pomdp<storm::RationalFunction>>();
+                components.observabilityClasses = pomdp.getObservations();
+                components.observationValuations = pomdp.getOptionalObservationValuations();
+            }
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> model = storm::utility::builder::buildModelFromComponents(type, std::move(components));
+
+            // Removing the transitions that became zero can make states unreachable, which a fresh exploration would not find.
+            uint64_t numberOfStates = model->getNumberOfStates();
+            storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(model->getTransitionMatrix(), model->getInitialStates(), storm::storage::BitVector(numberOfStates, true), storm::storage::BitVector(numberOfStates, false));
+            if (!reachableStates.full()) {
+                STORM_LOG_INFO("Removing " << (numberOfStates - reachableStates.getNumberOfSetBits()) << " states that are unreachable for the given constants.");
+                storm::transformer::SubsystemBuilderOptions subsystemOptions;
+                subsystemOptions.checkTransitionsOutside = false;
+                subsystemOptions.buildStateMapping = false;
+                subsystemOptions.buildKeptActions = false;
+                model = storm::transformer::buildSubsystem(*model, reachableStates, storm::storage::BitVector(model->getTransitionMatrix().getRowCount(), true), true, subsystemOptions).model;
+            }
+            return model;
+        }
+
+        template<typename ValueType>
+        ValueType const* IncrementalModelBuilder<ValueType>::getPlaceholder(storm::RationalFunction const& function) {
+            // The elements of the map (and therefore the placeholders) keep their address when the map grows.
+            return &functions.emplace(function, storm::utility::zero<ValueType>()).first->second;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType const*> IncrementalModelBuilder<ValueType>::getPlaceholders(std::vector<storm::RationalFunction> const& vector) {
+            std::vector<ValueType const*> result;
+            result.reserve(vector.size());
+            for (auto const& function : vector) {
+                result.push_back(getPlaceholder(function));
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> IncrementalModelBuilder<ValueType>::getValues(std::vector<ValueType const*> const& placeholders) {
+            std::vector<ValueType> result;
+            result.reserve(placeholders.size());
+            for (auto const& placeholder : placeholders) {
+                result.push_back(*placeholder);
+            }
+            return result;
+        }
+
+        template class IncrementalModelBuilder<double>;
+#ifdef STORM_HAVE_CARL
+        template class IncrementalModelBuilder<storm::RationalNumber>;
+#endif
+
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Builds sparse models of a model description for several values of its undefined constants.
+         *
+         * If the undefined constants only occur in update probabilities (or rates) and reward values, i.e. they do not
+         * influence the state space or the graph of the model, the model is explored only once with the constants as
+         * parameters. Each call to build then evaluates every distinct transition (or reward) function of this
+         * parametric model once and assembles the model from the values. Transitions whose value is zero for the
+         * given constants are removed, as are the states that become unreachable this way. The remaining states keep the
+         * order of the parametric model, which may differ from the order of a fresh exploration.
+         * Otherwise, the model is explored anew for every call to build.
+         */
+        template<typename ValueType>
+        class IncrementalModelBuilder {
+        public:
+            /*!
+             * Creates a builder for the given model description.
+             *
+             * @param modelDescription The model description. Its undefined constants are defined in each call to build.
+             * @param options The options used for exploring the model.
+             */
+            IncrementalModelBuilder(storm::storage::SymbolicModelDescription const& modelDescription, BuilderOptions const& options);
+
+            /*!
+             * Builds the model for the given values of the undefined constants.
+             *
+             * @param constantDefinitions A value for each undefined constant of the model description.
+             * @return The model.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> build(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+            /*!
+             * Retrieves whether the state space and the graph of the model are built only once.
+             */
+            bool isReusingStructure() const;
+
+        private:
+            /*!
+             * Explores the model with the undefined constants as parameters, if these do not influence the structure.
+             */
+            void buildParametricModel();
+
+            /*!
+             * Evaluates the functions of the parametric model for the given constants and assembles the model.
+             *
+             * @return The model or nullptr if a state has no transitions for the given constants.
+             */
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+            /*!
+             * Retrieves a placeholder that holds the value of the given function after evaluating all functions.
+             */
+            ValueType const* getPlaceholder(storm::RationalFunction const& function);
+
+            /*!
+             * Retrieves the placeholders of all entries of the given vector.
+             */
+            std::vector<ValueType const*> getPlaceholders(std::vector<storm::RationalFunction> const& vector);
+
+            /*!
+             * Retrieves the values of the given placeholders.
+             */
+            static std::vector<ValueType> getValues(std::vector<ValueType const*> const& placeholders);
+
+            // The model description and the options used for exploring the model.
+            storm::storage::SymbolicModelDescription modelDescription;
+            BuilderOptions options;
+
+            // The model with the undefined constants as parameters (if it is built only once).
+            std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+
+            // The parameters of the parametric model by name.
+            std::map<std::string, storm::RationalFunctionVariable> parameters;
+
+            // Every distinct function of the parametric model together with its value for the last constants.
+            std::unordered_map<storm::RationalFunction, ValueType> functions;
+
+            // The placeholders of the entries of the transition matrix, the exit rates and the reward vectors.
+            std::vector<ValueType const*> transitionPlaceholders;
+            std::vector<ValueType const*> exitRatePlaceholders;
+            std::unordered_map<std::string, std::vector<ValueType const*>> stateRewardPlaceholders;
+            std::unordered_map<std::string, std::vector<ValueType const*>> stateActionRewardPlaceholders;
+        };
+
+    }
+}
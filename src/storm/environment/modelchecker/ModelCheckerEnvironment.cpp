@@ -17,6 +17,7 @@ namespace storm {
         if (mcSettings.isLtl2daToolSet()) {
             ltl2daTool = mcSettings.getLtl2daTool();
         }
+        analysisCacheSize = mcSettings.getAnalysisCacheSize();
     }
     
     ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -47,6 +48,14 @@ namespace storm {
         ltl2daTool = boost::none;
     }
 
+    uint64_t ModelCheckerEnvironment::getAnalysisCacheSize() const {
+        return analysisCacheSize;
+    }
+
+    void ModelCheckerEnvironment::setAnalysisCacheSize(uint64_t value) {
+        analysisCacheSize = value;
+    }
+
 
 
 }
@@ -27,10 +27,17 @@ namespace storm {
         void setLtl2daTool(std::string const& value);
         void unsetLtl2daTool();
 
+        /*!
+         * Retrieves the memory (in MB) that may be used to cache the analysis results of until properties (0 disables the cache).
+         */
+        uint64_t getAnalysisCacheSize() const;
+        void setAnalysisCacheSize(uint64_t value);
+
 
     private:
         SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
         boost::optional<std::string> ltl2daTool;
+        uint64_t analysisCacheSize;
     };
 }
 
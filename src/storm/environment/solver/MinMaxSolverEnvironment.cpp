@@ -22,6 +22,8 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+        mixedPrecisionSwitchThreshold = storm::utility::convertNumber<storm::RationalNumber>(minMaxSettings.getMixedPrecisionSwitchThreshold());
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +83,20 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
+    storm::RationalNumber const& MinMaxSolverEnvironment::getMixedPrecisionSwitchThreshold() const {
+        return mixedPrecisionSwitchThreshold;
+    }
+    
+    void MinMaxSolverEnvironment::setMixedPrecisionSwitchThreshold(storm::RationalNumber value) {
+        mixedPrecisionSwitchThreshold = value;
+    }
+    
 }
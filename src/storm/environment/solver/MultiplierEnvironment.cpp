@@ -2,15 +2,22 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MultiplierSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     
     MultiplierEnvironment::MultiplierEnvironment() {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        structureOfArrays = multiplierSettings.isStructureOfArraysSet();
+        instructionSet = multiplierSettings.getInstructionSet();
+        multicolorGaussSeidel = multiplierSettings.isMulticolorGaussSeidelSet();
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +37,37 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool MultiplierEnvironment::isStructureOfArraysSet() const {
+        return structureOfArrays;
+    }
+    
+    void MultiplierEnvironment::setStructureOfArrays(bool value) {
+        structureOfArrays = value;
+    }
+    
+    uint64_t const& MultiplierEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void MultiplierEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
+    
+    storm::utility::simd::InstructionSet const& MultiplierEnvironment::getInstructionSet() const {
+        return instructionSet;
+    }
+    
+    void MultiplierEnvironment::setInstructionSet(storm::utility::simd::InstructionSet value) {
+        instructionSet = value;
+    }
+    
+    bool MultiplierEnvironment::isMulticolorGaussSeidelSet() const {
+        return multicolorGaussSeidel;
+    }
+    
+    void MultiplierEnvironment::setMulticolorGaussSeidel(bool value) {
+        multicolorGaussSeidel = value;
+    }
+    
 }
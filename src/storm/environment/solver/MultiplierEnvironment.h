@@ -2,6 +2,7 @@
 
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     
@@ -14,10 +15,22 @@ namespace storm {
         storm::solver::MultiplierType const& getType() const;
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+        bool isStructureOfArraysSet() const;
+        void setStructureOfArrays(bool value);
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        storm::utility::simd::InstructionSet const& getInstructionSet() const;
+        void setInstructionSet(storm::utility::simd::InstructionSet value);
+        bool isMulticolorGaussSeidelSet() const;
+        void setMulticolorGaussSeidel(bool value);
         
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool structureOfArrays;
+        uint64_t numberOfThreads;
+        storm::utility::simd::InstructionSet instructionSet;
+        bool multicolorGaussSeidel;
     };
 }
 
@@ -23,6 +23,8 @@ namespace storm {
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        mixedPrecision = nativeSettings.isMixedPrecisionSet();
+        mixedPrecisionSwitchThreshold = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getMixedPrecisionSwitchThreshold());
 
     }
 
@@ -90,5 +92,21 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    bool NativeSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void NativeSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
+    storm::RationalNumber const& NativeSolverEnvironment::getMixedPrecisionSwitchThreshold() const {
+        return mixedPrecisionSwitchThreshold;
+    }
+    
+    void NativeSolverEnvironment::setMixedPrecisionSwitchThreshold(storm::RationalNumber value) {
+        mixedPrecisionSwitchThreshold = value;
+    }
   
 }
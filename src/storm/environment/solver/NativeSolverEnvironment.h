@@ -29,6 +29,10 @@ namespace storm {
         void setSorOmega(storm::RationalNumber const& value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        storm::RationalNumber const& getMixedPrecisionSwitchThreshold() const;
+        void setMixedPrecisionSwitchThreshold(storm::RationalNumber value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -39,6 +43,8 @@ namespace storm {
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
         bool symmetricUpdates;
+        bool mixedPrecision;
+        storm::RationalNumber mixedPrecisionSwitchThreshold;
     };
 }
 
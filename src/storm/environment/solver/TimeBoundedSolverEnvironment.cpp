@@ -11,6 +11,7 @@ namespace storm {
         auto const& tbSettings = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>();
         maMethod = tbSettings.getMaMethod();
         maMethodSetFromDefault = tbSettings.isMaMethodSetFromDefaultValue();
+        ctmcMethod = tbSettings.getCtmcMethod();
         precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
         relative = tbSettings.isRelativePrecision();
         unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
@@ -33,6 +34,14 @@ namespace storm {
         maMethodSetFromDefault = isSetFromDefault;
     }
     
+    storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+        return ctmcMethod;
+    }
+    
+    void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+        ctmcMethod = value;
+    }
+    
     storm::RationalNumber const& TimeBoundedSolverEnvironment::getPrecision() const {
         return precision;
     }
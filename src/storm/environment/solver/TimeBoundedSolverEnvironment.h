@@ -15,6 +15,9 @@ namespace storm {
         bool const& isMaMethodSetFromDefault() const;
         void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
 
+        storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+        void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+
         storm::RationalNumber const& getPrecision() const;
         void setPrecision(storm::RationalNumber value);
         bool const& getRelativeTerminationCriterion() const;
@@ -27,6 +30,8 @@ namespace storm {
         storm::solver::MaBoundedReachabilityMethod maMethod;
         bool maMethodSetFromDefault;
         
+        storm::solver::CtmcTransientMethod ctmcMethod;
+        
         storm::RationalNumber precision;
         bool relative;
         
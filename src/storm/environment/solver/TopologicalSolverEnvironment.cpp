@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -15,6 +16,8 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +52,15 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
+    
 
 
 }
@@ -0,0 +1,471 @@
+#include "storm/generator/BytecodeExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        bool BytecodeExpression::evaluateAsBool(CompressedState const& state, Registers& registers) const {
+            STORM_LOG_ASSERT(!resultIsRational, "Unable to evaluate numerical expression as boolean.");
+            execute(state, registers);
+            return registers.integers[resultRegister] != 0;
+        }
+
+        int64_t BytecodeExpression::evaluateAsInt(CompressedState const& state, Registers& registers) const {
+            execute(state, registers);
+            if (resultIsRational) {
+                return static_cast<int64_t>(registers.rationals[resultRegister]);
+            } else {
+                return registers.integers[resultRegister];
+            }
+        }
+
+        double BytecodeExpression::evaluateAsDouble(CompressedState const& state, Registers& registers) const {
+            execute(state, registers);
+            if (resultIsRational) {
+                return registers.rationals[resultRegister];
+            } else {
+                return static_cast<double>(registers.integers[resultRegister]);
+            }
+        }
+
+        uint64_t BytecodeExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        void BytecodeExpression::execute(CompressedState const& state, Registers& registers) const {
+            if (registers.integers.size() < numberOfIntegerRegisters) {
+                registers.integers.resize(numberOfIntegerRegisters);
+            }
+            if (registers.rationals.size() < numberOfRationalRegisters) {
+                registers.rationals.resize(numberOfRationalRegisters);
+            }
+            int64_t* integers = registers.integers.data();
+            double* rationals = registers.rationals.data();
+
+            uint64_t const numberOfInstructions = instructions.size();
+            uint64_t programCounter = 0;
+            while (programCounter < numberOfInstructions) {
+                Instruction const& instruction = instructions[programCounter];
+                ++programCounter;
+                switch (instruction.opcode) {
+                    case Opcode::LoadBoolean: integers[instruction.target] = state.get(instruction.first) ? 1 : 0; break;
+                    case Opcode::LoadInteger: integers[instruction.target] = static_cast<int64_t>(state.getAsInt(instruction.first, instruction.second)) + instruction.integer; break;
+                    case Opcode::ConstantInteger: integers[instruction.target] = instruction.integer; break;
+                    case Opcode::ConstantRational: rationals[instruction.target] = instruction.rational; break;
+                    case Opcode::IntegerToRational: rationals[instruction.target] = static_cast<double>(integers[instruction.first]); break;
+
+                    case Opcode::Jump: programCounter = instruction.integer; break;
+                    case Opcode::JumpIfZero: if (integers[instruction.target] == 0) { programCounter = instruction.integer; } break;
+                    case Opcode::JumpIfNotZero: if (integers[instruction.target] != 0) { programCounter = instruction.integer; } break;
+
+                    case Opcode::Not: integers[instruction.target] = integers[instruction.first] == 0 ? 1 : 0; break;
+                    case Opcode::Xor: integers[instruction.target] = (integers[instruction.first] != 0) != (integers[instruction.second] != 0) ? 1 : 0; break;
+                    case Opcode::Iff: integers[instruction.target] = (integers[instruction.first] != 0) == (integers[instruction.second] != 0) ? 1 : 0; break;
+
+                    case Opcode::IntegerPlus: integers[instruction.target] = integers[instruction.first] + integers[instruction.second]; break;
+                    case Opcode::IntegerMinus: integers[instruction.target] = integers[instruction.first] - integers[instruction.second]; break;
+                    case Opcode::IntegerTimes: integers[instruction.target] = integers[instruction.first] * integers[instruction.second]; break;
+                    case Opcode::IntegerMin: integers[instruction.target] = std::min(integers[instruction.first], integers[instruction.second]); break;
+                    case Opcode::IntegerMax: integers[instruction.target] = std::max(integers[instruction.first], integers[instruction.second]); break;
+                    case Opcode::IntegerNegate: integers[instruction.target] = -integers[instruction.first]; break;
+                    case Opcode::IntegerEqual: integers[instruction.target] = integers[instruction.first] == integers[instruction.second] ? 1 : 0; break;
+                    case Opcode::IntegerNotEqual: integers[instruction.target] = integers[instruction.first] != integers[instruction.second] ? 1 : 0; break;
+                    case Opcode::IntegerLess: integers[instruction.target] = integers[instruction.first] < integers[instruction.second] ? 1 : 0; break;
+                    case Opcode::IntegerLessOrEqual: integers[instruction.target] = integers[instruction.first] <= integers[instruction.second] ? 1 : 0; break;
+                    case Opcode::IntegerGreater: integers[instruction.target] = integers[instruction.first] > integers[instruction.second] ? 1 : 0; break;
+                    case Opcode::IntegerGreaterOrEqual: integers[instruction.target] = integers[instruction.first] >= integers[instruction.second] ? 1 : 0; break;
+
+                    case Opcode::RationalPlus: rationals[instruction.target] = rationals[instruction.first] + rationals[instruction.second]; break;
+                    case Opcode::RationalMinus: rationals[instruction.target] = rationals[instruction.first] - rationals[instruction.second]; break;
+                    case Opcode::RationalTimes: rationals[instruction.target] = rationals[instruction.first] * rationals[instruction.second]; break;
+                    case Opcode::RationalDivide: rationals[instruction.target] = rationals[instruction.first] / rationals[instruction.second]; break;
+                    case Opcode::RationalMin: rationals[instruction.target] = std::min(rationals[instruction.first], rationals[instruction.second]); break;
+                    case Opcode::RationalMax: rationals[instruction.target] = std::max(rationals[instruction.first], rationals[instruction.second]); break;
+                    case Opcode::RationalPower: rationals[instruction.target] = std::pow(rationals[instruction.first], rationals[instruction.second]); break;
+                    case Opcode::RationalModulo: rationals[instruction.target] = std::fmod(rationals[instruction.first], rationals[instruction.second]); break;
+                    case Opcode::RationalNegate: rationals[instruction.target] = -rationals[instruction.first]; break;
+                    case Opcode::RationalFloor: integers[instruction.target] = static_cast<int64_t>(std::floor(rationals[instruction.first])); break;
+                    case Opcode::RationalCeil: integers[instruction.target] = static_cast<int64_t>(std::ceil(rationals[instruction.first])); break;
+                    case Opcode::RationalEqual: integers[instruction.target] = rationals[instruction.first] == rationals[instruction.second] ? 1 : 0; break;
+                    case Opcode::RationalNotEqual: integers[instruction.target] = rationals[instruction.first] != rationals[instruction.second] ? 1 : 0; break;
+                    case Opcode::RationalLess: integers[instruction.target] = rationals[instruction.first] < rationals[instruction.second] ? 1 : 0; break;
+                    case Opcode::RationalLessOrEqual: integers[instruction.target] = rationals[instruction.first] <= rationals[instruction.second] ? 1 : 0; break;
+                    case Opcode::RationalGreater: integers[instruction.target] = rationals[instruction.first] > rationals[instruction.second] ? 1 : 0; break;
+                    case Opcode::RationalGreaterOrEqual: integers[instruction.target] = rationals[instruction.first] >= rationals[instruction.second] ? 1 : 0; break;
+                }
+            }
+        }
+
+        namespace {
+            typedef BytecodeExpression::Opcode Opcode;
+            typedef BytecodeExpression::Instruction Instruction;
+
+            /*!
+             * Emits the instructions for an expression. Registers are allocated like a stack (separately for integers
+             * and rationals): the result of each subexpression is stored in the topmost register of its kind that was
+             * free when the translation of the subexpression started, and all registers above are free again afterwards.
+             */
+            template<typename VariableLocation>
+            class BytecodeEmitter : public storm::expressions::ExpressionVisitor {
+            public:
+                BytecodeEmitter(std::unordered_map<storm::expressions::Variable, VariableLocation> const& variableToLocation) : supported(true), variableToLocation(variableToLocation), integerTop(0), rationalTop(0), maximalIntegerTop(0), maximalRationalTop(0) {
+                    // Intentionally left empty.
+                }
+
+                std::vector<Instruction> instructions;
+                bool supported;
+
+                uint32_t getNumberOfIntegerRegisters() const {
+                    return maximalIntegerTop;
+                }
+
+                uint32_t getNumberOfRationalRegisters() const {
+                    return maximalRationalTop;
+                }
+
+                /*!
+                 * Emits the instructions for the given expression.
+                 *
+                 * @return The register that holds the result and whether it is a rational register.
+                 */
+                std::pair<uint32_t, bool> emit(storm::expressions::BaseExpression const& expression) {
+                    bool isRational = isRationalValued(expression);
+                    uint32_t result = isRational ? rationalTop : integerTop;
+                    expression.accept(*this, boost::none);
+                    return std::make_pair(result, isRational);
+                }
+
+                /*!
+                 * Emits the instructions for the given expression such that the result is stored in a rational
+                 * register (converting integer results).
+                 */
+                uint32_t emitAsRational(storm::expressions::BaseExpression const& expression) {
+                    if (isRationalValued(expression)) {
+                        return emit(expression).first;
+                    }
+                    uint32_t integerRegister = emit(expression).first;
+                    freeIntegerRegistersFrom(integerRegister);
+                    uint32_t result = allocateRationalRegister();
+                    push(Opcode::IntegerToRational, result, integerRegister);
+                    return result;
+                }
+
+                virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+                    uint32_t conditionRegister = emit(*expression.getCondition()).first;
+                    freeIntegerRegistersFrom(conditionRegister);
+                    uint64_t conditionalJump = push(Opcode::JumpIfZero, conditionRegister);
+                    uint64_t jumpToEnd;
+                    if (isRationalValued(expression)) {
+                        uint32_t savedTop = rationalTop;
+                        emitAsRational(*expression.getThenExpression());
+                        rationalTop = savedTop;
+                        jumpToEnd = push(Opcode::Jump, 0);
+                        instructions[conditionalJump].integer = instructions.size();
+                        emitAsRational(*expression.getElseExpression());
+                    } else {
+                        uint32_t savedTop = integerTop;
+                        emit(*expression.getThenExpression());
+                        integerTop = savedTop;
+                        jumpToEnd = push(Opcode::Jump, 0);
+                        instructions[conditionalJump].integer = instructions.size();
+                        emit(*expression.getElseExpression());
+                    }
+                    instructions[jumpToEnd].integer = instructions.size();
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                    typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+                    uint32_t result = emit(*expression.getFirstOperand()).first;
+                    switch (expression.getOperatorType()) {
+                        case OperatorType::And:
+                        case OperatorType::Or:
+                        case OperatorType::Implies: {
+                            // Evaluate the second operand only if the first operand does not determine the result.
+                            uint64_t jump;
+                            if (expression.getOperatorType() == OperatorType::And) {
+                                jump = push(Opcode::JumpIfZero, result);
+                            } else if (expression.getOperatorType() == OperatorType::Or) {
+                                jump = push(Opcode::JumpIfNotZero, result);
+                            } else {
+                                push(Opcode::Not, result, result);
+                                jump = push(Opcode::JumpIfNotZero, result);
+                            }
+                            freeIntegerRegistersFrom(result);
+                            emit(*expression.getSecondOperand());
+                            instructions[jump].integer = instructions.size();
+                            break;
+                        }
+                        case OperatorType::Xor:
+                        case OperatorType::Iff: {
+                            uint32_t second = emit(*expression.getSecondOperand()).first;
+                            freeIntegerRegistersFrom(result);
+                            allocateIntegerRegister();
+                            push(expression.getOperatorType() == OperatorType::Xor ? Opcode::Xor : Opcode::Iff, result, result, second);
+                            break;
+                        }
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                    typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+                    if (isRationalValued(expression)) {
+                        uint32_t first = emitAsRational(*expression.getFirstOperand());
+                        uint32_t second = emitAsRational(*expression.getSecondOperand());
+                        freeRationalRegistersFrom(first);
+                        uint32_t result = allocateRationalRegister();
+                        Opcode opcode = Opcode::RationalPlus;
+                        switch (expression.getOperatorType()) {
+                            case OperatorType::Plus: opcode = Opcode::RationalPlus; break;
+                            case OperatorType::Minus: opcode = Opcode::RationalMinus; break;
+                            case OperatorType::Times: opcode = Opcode::RationalTimes; break;
+                            case OperatorType::Divide: opcode = Opcode::RationalDivide; break;
+                            case OperatorType::Min: opcode = Opcode::RationalMin; break;
+                            case OperatorType::Max: opcode = Opcode::RationalMax; break;
+                            case OperatorType::Power: opcode = Opcode::RationalPower; break;
+                            case OperatorType::Modulo: opcode = Opcode::RationalModulo; break;
+                        }
+                        push(opcode, result, first, second);
+                    } else {
+                        uint32_t first = emit(*expression.getFirstOperand()).first;
+                        uint32_t second = emit(*expression.getSecondOperand()).first;
+                        freeIntegerRegistersFrom(first);
+                        uint32_t result = allocateIntegerRegister();
+                        Opcode opcode = Opcode::IntegerPlus;
+                        switch (expression.getOperatorType()) {
+                            case OperatorType::Plus: opcode = Opcode::IntegerPlus; break;
+                            case OperatorType::Minus: opcode = Opcode::IntegerMinus; break;
+                            case OperatorType::Times: opcode = Opcode::IntegerTimes; break;
+                            case OperatorType::Min: opcode = Opcode::IntegerMin; break;
+                            case OperatorType::Max: opcode = Opcode::IntegerMax; break;
+                            default: STORM_LOG_ASSERT(false, "Operator is expected to be evaluated on rationals."); break;
+                        }
+                        push(opcode, result, first, second);
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) override {
+                    typedef storm::expressions::BinaryRelationExpression::RelationType RelationType;
+                    if (isRationalValued(*expression.getFirstOperand()) || isRationalValued(*expression.getSecondOperand())) {
+                        uint32_t const savedIntegerTop = integerTop;
+                        uint32_t first = emitAsRational(*expression.getFirstOperand());
+                        uint32_t second = emitAsRational(*expression.getSecondOperand());
+                        freeRationalRegistersFrom(first);
+                        freeIntegerRegistersFrom(savedIntegerTop);
+                        uint32_t result = allocateIntegerRegister();
+                        Opcode opcode = Opcode::RationalEqual;
+                        switch (expression.getRelationType()) {
+                            case RelationType::Equal: opcode = Opcode::RationalEqual; break;
+                            case RelationType::NotEqual: opcode = Opcode::RationalNotEqual; break;
+                            case RelationType::Less: opcode = Opcode::RationalLess; break;
+                            case RelationType::LessOrEqual: opcode = Opcode::RationalLessOrEqual; break;
+                            case RelationType::Greater: opcode = Opcode::RationalGreater; break;
+                            case RelationType::GreaterOrEqual: opcode = Opcode::RationalGreaterOrEqual; break;
+                        }
+                        push(opcode, result, first, second);
+                    } else {
+                        uint32_t first = emit(*expression.getFirstOperand()).first;
+                        uint32_t second = emit(*expression.getSecondOperand()).first;
+                        freeIntegerRegistersFrom(first);
+                        uint32_t result = allocateIntegerRegister();
+                        Opcode opcode = Opcode::IntegerEqual;
+                        switch (expression.getRelationType()) {
+                            case RelationType::Equal: opcode = Opcode::IntegerEqual; break;
+                            case RelationType::NotEqual: opcode = Opcode::IntegerNotEqual; break;
+                            case RelationType::Less: opcode = Opcode::IntegerLess; break;
+                            case RelationType::LessOrEqual: opcode = Opcode::IntegerLessOrEqual; break;
+                            case RelationType::Greater: opcode = Opcode::IntegerGreater; break;
+                            case RelationType::GreaterOrEqual: opcode = Opcode::IntegerGreaterOrEqual; break;
+                        }
+                        push(opcode, result, first, second);
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                    auto locationIt = variableToLocation.find(expression.getVariable());
+                    if (locationIt == variableToLocation.end()) {
+                        // The variable is not stored in the states (e.g. a transient or rational variable).
+                        supported = false;
+                        allocate(isRationalValued(expression));
+                        return boost::any();
+                    }
+                    VariableLocation const& location = locationIt->second;
+                    uint32_t result = allocateIntegerRegister();
+                    if (location.isBoolean) {
+                        push(Opcode::LoadBoolean, result, location.bitOffset);
+                    } else if (location.bitWidth == 0) {
+                        push(Opcode::ConstantInteger, result, 0, 0, location.lowerBound);
+                    } else {
+                        push(Opcode::LoadInteger, result, location.bitOffset, location.bitWidth, location.lowerBound);
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                    uint32_t result = emit(*expression.getOperand()).first;
+                    push(Opcode::Not, result, result);
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                    typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+                    if (expression.getOperatorType() == OperatorType::Minus) {
+                        if (isRationalValued(expression)) {
+                            uint32_t result = emitAsRational(*expression.getOperand());
+                            push(Opcode::RationalNegate, result, result);
+                        } else {
+                            uint32_t result = emit(*expression.getOperand()).first;
+                            push(Opcode::IntegerNegate, result, result);
+                        }
+                    } else {
+                        uint32_t operand = emitAsRational(*expression.getOperand());
+                        freeRationalRegistersFrom(operand);
+                        push(expression.getOperatorType() == OperatorType::Floor ? Opcode::RationalFloor : Opcode::RationalCeil, allocateIntegerRegister(), operand);
+                    }
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                    push(Opcode::ConstantInteger, allocateIntegerRegister(), 0, 0, expression.getValue() ? 1 : 0);
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                    push(Opcode::ConstantInteger, allocateIntegerRegister(), 0, 0, expression.getValue());
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                    uint64_t index = push(Opcode::ConstantRational, allocateRationalRegister());
+                    instructions[index].rational = expression.getValueAsDouble();
+                    return boost::any();
+                }
+
+                virtual boost::any visit(storm::expressions::PredicateExpression const& expression, boost::any const&) override {
+                    supported = false;
+                    allocate(isRationalValued(expression));
+                    return boost::any();
+                }
+
+            private:
+                /*!
+                 * Determines whether the value of the given expression is held in a rational register. This is the
+                 * case for all numerical expressions that are not of integer type and for integer expressions whose
+                 * value is not necessarily integral if evaluated with floating point numbers.
+                 */
+                bool isRationalValued(storm::expressions::BaseExpression const& expression) {
+                    if (expression.hasBooleanType()) {
+                        return false;
+                    }
+                    if (!expression.hasIntegerType()) {
+                        return true;
+                    }
+                    if (!expression.isFunctionApplication()) {
+                        return false;
+                    }
+                    auto cacheIt = rationalValuedCache.find(&expression);
+                    if (cacheIt != rationalValuedCache.end()) {
+                        return cacheIt->second;
+                    }
+                    bool result = false;
+                    switch (expression.getOperator()) {
+                        case storm::expressions::OperatorType::Divide:
+                        case storm::expressions::OperatorType::Power:
+                        case storm::expressions::OperatorType::Modulo:
+                            result = true;
+                            break;
+                        case storm::expressions::OperatorType::Floor:
+                        case storm::expressions::OperatorType::Ceil:
+                            result = false;
+                            break;
+                        default:
+                            for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                                if (isRationalValued(*expression.getOperand(operandIndex))) {
+                                    result = true;
+                                    break;
+                                }
+                            }
+                    }
+                    rationalValuedCache[&expression] = result;
+                    return result;
+                }
+
+                uint64_t push(Opcode opcode, uint32_t target, uint64_t first = 0, uint64_t second = 0, int64_t integer = 0) {
+                    instructions.push_back(Instruction{opcode, target, static_cast<uint32_t>(first), static_cast<uint32_t>(second), integer, 0.0});
+                    return instructions.size() - 1;
+                }
+
+                uint32_t allocate(bool rational) {
+                    return rational ? allocateRationalRegister() : allocateIntegerRegister();
+                }
+
+                uint32_t allocateIntegerRegister() {
+                    maximalIntegerTop = std::max(maximalIntegerTop, integerTop + 1);
+                    return integerTop++;
+                }
+
+                uint32_t allocateRationalRegister() {
+                    maximalRationalTop = std::max(maximalRationalTop, rationalTop + 1);
+                    return rationalTop++;
+                }
+
+                void freeIntegerRegistersFrom(uint32_t index) {
+                    integerTop = index;
+                }
+
+                void freeRationalRegistersFrom(uint32_t index) {
+                    rationalTop = index;
+                }
+
+                std::unordered_map<storm::expressions::Variable, VariableLocation> const& variableToLocation;
+                std::unordered_map<storm::expressions::BaseExpression const*, bool> rationalValuedCache;
+
+                uint32_t integerTop;
+                uint32_t rationalTop;
+                uint32_t maximalIntegerTop;
+                uint32_t maximalRationalTop;
+            };
+        }
+
+        BytecodeExpressionCompiler::BytecodeExpressionCompiler(VariableInformation const& variableInformation) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                variableToLocation[locationVariable.variable] = VariableLocation{false, locationVariable.bitOffset, locationVariable.bitWidth, 0};
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToLocation[booleanVariable.variable] = VariableLocation{true, booleanVariable.bitOffset, 1, 0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableToLocation[integerVariable.variable] = VariableLocation{false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+            }
+        }
+
+        boost::optional<BytecodeExpression> BytecodeExpressionCompiler::compile(storm::expressions::Expression const& expression) const {
+            BytecodeEmitter<VariableLocation> emitter(variableToLocation);
+            auto resultRegister = emitter.emit(*expression.getBaseExpressionPointer());
+            if (!emitter.supported) {
+                return boost::none;
+            }
+
+            BytecodeExpression result;
+            result.instructions = std::move(emitter.instructions);
+            result.numberOfIntegerRegisters = emitter.getNumberOfIntegerRegisters();
+            result.numberOfRationalRegisters = emitter.getNumberOfRationalRegisters();
+            result.resultRegister = resultRegister.first;
+            result.resultIsRational = resultRegister.second;
+            return result;
+        }
+
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace expressions {
+        class Expression;
+    }
+
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * An expression over the (non-transient) variables of a model that was compiled into a register-based bytecode.
+         * The bytecode reads the values of the variables directly from the bit fields of a compressed state, so
+         * evaluating it does not require to unpack the state into an expression evaluator first.
+         *
+         * Boolean and integer values are held in integer registers and all other numerical values are held in (double)
+         * rational registers. The evaluation agrees with the one of the expression evaluators (which evaluate boolean
+         * and integer expressions with floating point numbers): divisions, powers and modulo operations are always
+         * performed on doubles, even if the operands are integers, and integer results are truncated.
+         */
+        class BytecodeExpression {
+        public:
+            /*!
+             * The registers that are used while evaluating compiled expressions. They may be shared among all
+             * expressions that are evaluated by the same thread.
+             */
+            struct Registers {
+                std::vector<int64_t> integers;
+                std::vector<double> rationals;
+            };
+
+            enum class Opcode : uint8_t {
+                // Loads the value of a variable or a constant into a register.
+                LoadBoolean, LoadInteger, ConstantInteger, ConstantRational, IntegerToRational,
+                // Jumps to the given instruction (if the condition holds).
+                Jump, JumpIfZero, JumpIfNotZero,
+                // Operations on booleans.
+                Not, Xor, Iff,
+                // Operations on integers.
+                IntegerPlus, IntegerMinus, IntegerTimes, IntegerMin, IntegerMax, IntegerNegate,
+                IntegerEqual, IntegerNotEqual, IntegerLess, IntegerLessOrEqual, IntegerGreater, IntegerGreaterOrEqual,
+                // Operations on rationals (floor and ceil yield integers).
+                RationalPlus, RationalMinus, RationalTimes, RationalDivide, RationalMin, RationalMax, RationalPower, RationalModulo, RationalNegate,
+                RationalFloor, RationalCeil,
+                RationalEqual, RationalNotEqual, RationalLess, RationalLessOrEqual, RationalGreater, RationalGreaterOrEqual
+            };
+
+            struct Instruction {
+                Opcode opcode;
+                // The register that receives the result (or the condition register of a conditional jump).
+                uint32_t target;
+                // The operand registers. For loading a variable, these are the bit offset and width of the variable.
+                uint32_t first;
+                uint32_t second;
+                // An immediate integer (the lower bound of a loaded variable, a constant or the target of a jump).
+                int64_t integer;
+                // An immediate rational constant.
+                double rational;
+            };
+
+            BytecodeExpression() = default;
+
+            /*!
+             * Evaluates the expression in the given state.
+             *
+             * @pre The expression has boolean type.
+             */
+            bool evaluateAsBool(CompressedState const& state, Registers& registers) const;
+
+            /*!
+             * Evaluates the expression in the given state. Non-integral results are truncated.
+             *
+             * @pre The expression has integer type.
+             */
+            int64_t evaluateAsInt(CompressedState const& state, Registers& registers) const;
+
+            /*!
+             * Evaluates the expression in the given state. Integer results are converted.
+             */
+            double evaluateAsDouble(CompressedState const& state, Registers& registers) const;
+
+            /*!
+             * Retrieves the number of instructions of the bytecode.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            friend class BytecodeExpressionCompiler;
+
+            /*!
+             * Executes the instructions.
+             */
+            void execute(CompressedState const& state, Registers& registers) const;
+
+            std::vector<Instruction> instructions;
+
+            // The number of registers that are required.
+            uint32_t numberOfIntegerRegisters;
+            uint32_t numberOfRationalRegisters;
+
+            // The register that holds the result after execution.
+            uint32_t resultRegister;
+            bool resultIsRational;
+        };
+
+        /*!
+         * Compiles expressions over the variables of the given variable information into bytecode.
+         */
+        class BytecodeExpressionCompiler {
+        public:
+            /*!
+             * Creates a compiler for the given variables.
+             *
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            BytecodeExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expression.
+             *
+             * @return The compiled expression or nothing if the expression is not supported, e.g., because it refers to
+             * variables that are not stored in the states.
+             */
+            boost::optional<BytecodeExpression> compile(storm::expressions::Expression const& expression) const;
+
+        private:
+            struct VariableLocation {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+            };
+
+            // The locations of the variables within the states.
+            std::unordered_map<storm::expressions::Variable, VariableLocation> variableToLocation;
+        };
+
+    }
+}
@@ -0,0 +1,198 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // Variables with a larger bit width are not indexed as this would require too many candidate lists.
+            uint64_t const MAXIMAL_BIT_WIDTH = 12;
+
+            // The maximal number of entries of all candidate lists of an index.
+            uint64_t const MAXIMAL_NUMBER_OF_ENTRIES = 1ull << 20;
+
+            struct IndexableVariable {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+            };
+
+            /*!
+             * Collects the atoms x=c of the top-level conjunction of the given expression, where x is an indexable
+             * variable and c is an integral constant.
+             */
+            void collectAtoms(storm::expressions::BaseExpression const& expression, std::unordered_map<storm::expressions::Variable, uint64_t> const& variableToIndex, std::vector<std::pair<uint64_t, int64_t>>& atoms) {
+                auto addAtom = [&] (storm::expressions::BaseExpression const& variableExpression, int64_t value) {
+                    auto it = variableToIndex.find(variableExpression.asVariableExpression().getVariable());
+                    if (it != variableToIndex.end()) {
+                        atoms.emplace_back(it->second, value);
+                    }
+                };
+
+                if (expression.isBinaryBooleanFunctionExpression()) {
+                    auto const& function = expression.asBinaryBooleanFunctionExpression();
+                    if (function.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And) {
+                        collectAtoms(*function.getFirstOperand(), variableToIndex, atoms);
+                        collectAtoms(*function.getSecondOperand(), variableToIndex, atoms);
+                    }
+                } else if (expression.isBinaryRelationExpression()) {
+                    auto const& relation = expression.asBinaryRelationExpression();
+                    if (relation.getRelationType() != storm::expressions::BinaryRelationExpression::RelationType::Equal) {
+                        return;
+                    }
+                    for (uint64_t variableOperand = 0; variableOperand < 2; ++variableOperand) {
+                        auto const& variable = *relation.getOperand(variableOperand);
+                        auto const& constant = *relation.getOperand(1 - variableOperand);
+                        if (variable.isVariableExpression() && variable.hasIntegerType() && !constant.containsVariables() && constant.hasNumericalType()) {
+                            // The guards are evaluated with doubles, so we do the same for the constant.
+                            double value = constant.evaluateAsDouble();
+                            if (std::floor(value) == value && std::abs(value) < 1e15) {
+                                addAtom(variable, static_cast<int64_t>(value));
+                            }
+                            return;
+                        }
+                    }
+                } else if (expression.isVariableExpression() && expression.hasBooleanType()) {
+                    addAtom(expression, 1);
+                } else if (expression.isUnaryBooleanFunctionExpression()) {
+                    auto const& operand = *expression.asUnaryBooleanFunctionExpression().getOperand();
+                    if (operand.isVariableExpression()) {
+                        addAtom(operand, 0);
+                    }
+                }
+            }
+        }
+
+        const uint64_t GuardIndex::ANY_VALUE = std::numeric_limits<uint64_t>::max();
+        const uint64_t GuardIndex::NO_VALUE = std::numeric_limits<uint64_t>::max() - 1;
+
+        GuardIndex::GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation) : numberOfGuards(guards.size()), bitOffset(0), bitWidth(0), requiredValues(guards.size(), ANY_VALUE) {
+            // Gather the variables that can be indexed.
+            std::vector<IndexableVariable> variables;
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToIndex[booleanVariable.variable] = variables.size();
+                variables.push_back(IndexableVariable{booleanVariable.bitOffset, 1, 0});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitWidth > 0 && integerVariable.bitWidth <= MAXIMAL_BIT_WIDTH) {
+                    variableToIndex[integerVariable.variable] = variables.size();
+                    variables.push_back(IndexableVariable{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound});
+                }
+            }
+
+            // Find the atoms of all guards and count by how many guards each variable is constrained.
+            std::vector<std::vector<std::pair<uint64_t, int64_t>>> atoms(guards.size());
+            std::vector<uint64_t> numberOfConstrainedGuards(variables.size(), 0);
+            for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                collectAtoms(guards[guard].getBaseExpression(), variableToIndex, atoms[guard]);
+                std::vector<bool> counted(variables.size(), false);
+                for (auto const& atom : atoms[guard]) {
+                    if (!counted[atom.first]) {
+                        counted[atom.first] = true;
+                        ++numberOfConstrainedGuards[atom.first];
+                    }
+                }
+            }
+
+            uint64_t bestVariable = 0;
+            for (uint64_t variable = 1; variable < variables.size(); ++variable) {
+                if (numberOfConstrainedGuards[variable] > numberOfConstrainedGuards[bestVariable]) {
+                    bestVariable = variable;
+                }
+            }
+
+            uint64_t numberOfValues = 0;
+            if (!variables.empty() && numberOfConstrainedGuards[bestVariable] > 0) {
+                IndexableVariable const& variable = variables[bestVariable];
+                numberOfValues = 1ull << variable.bitWidth;
+
+                // Determine the value each guard requires for the selected variable.
+                uint64_t numberOfEntries = 0;
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    for (auto const& atom : atoms[guard]) {
+                        if (atom.first != bestVariable) {
+                            continue;
+                        }
+                        uint64_t value = NO_VALUE;
+                        if (atom.second >= variable.lowerBound && static_cast<uint64_t>(atom.second - variable.lowerBound) < numberOfValues) {
+                            value = static_cast<uint64_t>(atom.second - variable.lowerBound);
+                        }
+                        // Guards that require different values can never hold.
+                        requiredValues[guard] = (requiredValues[guard] == ANY_VALUE || requiredValues[guard] == value) ? value : NO_VALUE;
+                    }
+                    if (requiredValues[guard] == ANY_VALUE) {
+                        numberOfEntries += numberOfValues;
+                    } else if (requiredValues[guard] != NO_VALUE) {
+                        ++numberOfEntries;
+                    }
+                }
+
+                if (numberOfEntries <= MAXIMAL_NUMBER_OF_ENTRIES) {
+                    bitOffset = variable.bitOffset;
+                    bitWidth = variable.bitWidth;
+                } else {
+                    STORM_LOG_DEBUG("Not indexing guards as the candidate lists would become too large.");
+                    std::fill(requiredValues.begin(), requiredValues.end(), ANY_VALUE);
+                    numberOfValues = 0;
+                }
+            }
+
+            if (numberOfValues == 0) {
+                // Without a suitable variable, all guards are candidates.
+                candidates.resize(1);
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    candidates.front().push_back(guard);
+                }
+            } else {
+                candidates.resize(numberOfValues);
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    if (requiredValues[guard] == ANY_VALUE) {
+                        for (auto& candidateList : candidates) {
+                            candidateList.push_back(guard);
+                        }
+                    } else if (requiredValues[guard] != NO_VALUE) {
+                        candidates[requiredValues[guard]].push_back(guard);
+                    }
+                }
+            }
+        }
+
+        std::vector<uint64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+            if (!isIndexed()) {
+                return candidates.front();
+            }
+            return candidates[getValue(state)];
+        }
+
+        bool GuardIndex::isCandidate(CompressedState const& state, uint64_t guard) const {
+            STORM_LOG_ASSERT(guard < numberOfGuards, "Invalid guard index.");
+            uint64_t requiredValue = requiredValues[guard];
+            if (requiredValue == ANY_VALUE) {
+                return true;
+            }
+            return requiredValue == getValue(state);
+        }
+
+        bool GuardIndex::isIndexed() const {
+            return bitWidth > 0;
+        }
+
+        uint64_t GuardIndex::getNumberOfGuards() const {
+            return numberOfGuards;
+        }
+
+        uint64_t GuardIndex::getValue(CompressedState const& state) const {
+            return state.getAsInt(bitOffset, bitWidth);
+        }
+
+    }
+}
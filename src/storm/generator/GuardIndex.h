@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class Expression;
+    }
+
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * An index over a list of guards (e.g. the guards of the commands of a PRISM module or of the edges of a JANI
+         * automaton) that allows to skip guards that can not hold in a given state without evaluating them.
+         *
+         * For this, the top-level conjuncts of the guards are searched for atoms of the form x=c (or b and !b for boolean
+         * variables) where c is a constant. The variable that is constrained this way by most guards is selected and, for
+         * each of its values, the guards that do not require a different value are stored. This way, models in which
+         * most commands are guarded by a local 'program counter' only need to evaluate the guards of a few commands.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an index for the given guards.
+             *
+             * @param guards The guards to index. The guards are referred to by their position in this list.
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            GuardIndex(std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation);
+
+            /*!
+             * Retrieves the (ascending) positions of the guards that can possibly hold in the given state. All other guards
+             * are guaranteed to be false in the state.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const;
+
+            /*!
+             * Retrieves whether the guard at the given position can possibly hold in the given state. If this returns
+             * false, the guard is guaranteed to be false in the state.
+             */
+            bool isCandidate(CompressedState const& state, uint64_t guard) const;
+
+            /*!
+             * Retrieves whether a variable was found that can be used to exclude guards.
+             */
+            bool isIndexed() const;
+
+            /*!
+             * Retrieves the number of guards in this index.
+             */
+            uint64_t getNumberOfGuards() const;
+
+        private:
+            /*!
+             * Retrieves the (offset) value of the indexed variable in the given state.
+             */
+            uint64_t getValue(CompressedState const& state) const;
+
+            // Markers for guards that do not constrain the indexed variable or that can never hold.
+            static const uint64_t ANY_VALUE;
+            static const uint64_t NO_VALUE;
+
+            // The number of guards.
+            uint64_t numberOfGuards;
+
+            // The position of the indexed variable within the states.
+            uint64_t bitOffset;
+            uint64_t bitWidth;
+
+            // For each guard, the (offset) value the indexed variable needs to have for the guard to hold.
+            std::vector<uint64_t> requiredValues;
+
+            // For each (offset) value of the indexed variable, the guards that can possibly hold. If no variable is
+            // indexed, there is only one list that contains all guards.
+            std::vector<std::vector<uint64_t>> candidates;
+        };
+
+    }
+}
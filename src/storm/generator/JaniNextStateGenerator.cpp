@@ -85,6 +85,9 @@ namespace storm {
             this->variableInformation.registerArrayVariableReplacements(arrayEliminatorData);
             this->transientVariableInformation = TransientVariableInformation<ValueType>(this->model, this->parallelAutomata);
             this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
+
+            // Edges whose guards can not hold in a state are skipped by means of the guard indices.
+            buildGuardIndices();
             
             // Create a proper evaluator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
@@ -970,7 +973,7 @@ namespace storm {
                                     continue;
                                 }
                             }
-                            if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                            if (!guardIndices[automatonIndex].isCandidate(state, indexAndEdge.first) || !this->evaluator->asBool(indexAndEdge.second->getGuard())) {
                                 continue;
                             }
                         
@@ -1007,7 +1010,10 @@ namespace storm {
                     if (productiveCombination) {
                         // second, check whether each automaton has at least one enabled action
                         edgeIteratorMemory.clear(); // Store the first enabled edge in each automaton.
+                        auto automatonAndEdgesIt = outputAndEdges.second.begin();
                         for (auto const& edgesIt : edgeSetsMemory) {
+                            GuardIndex const& guardIndex = guardIndices[automatonAndEdgesIt->first];
+                            ++automatonAndEdgesIt;
                             bool atLeastOneEdge = false;
                             EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
                             for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
@@ -1019,7 +1025,7 @@ namespace storm {
                                     }
                                 }
                             
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!guardIndex.isCandidate(state, indexAndEdgeIt->first) || !this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
                                     continue;
                                 }
                             
@@ -1062,7 +1068,7 @@ namespace storm {
                                     }
                                 }
                                 
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!guardIndices[automatonIndex].isCandidate(state, indexAndEdgeIt->first) || !this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
                                     continue;
                                 }
                                 // If we reach this point, the edge is considered enabled.
@@ -1168,6 +1174,19 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            guardIndices.reserve(parallelAutomata.size());
+            for (auto const& automatonRef : parallelAutomata) {
+                std::vector<storm::expressions::Expression> guards;
+                guards.reserve(automatonRef.get().getNumberOfEdges());
+                for (auto const& edge : automatonRef.get().getEdges()) {
+                    guards.push_back(edge.getGuard());
+                }
+                guardIndices.emplace_back(guards, this->variableInformation);
+            }
+        }
+
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformation() {
             // Create synchronizing edges information.
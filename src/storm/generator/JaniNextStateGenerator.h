@@ -2,6 +2,7 @@
 
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/eliminator/ArrayEliminator.h"
@@ -187,6 +188,11 @@ namespace storm {
              */
             void createSynchronizationInformation();
             
+            /*!
+             * Builds the guard indices of the automata that are put in parallel.
+             */
+            void buildGuardIndices();
+
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
@@ -200,6 +206,9 @@ namespace storm {
             
             /// The vector storing the edges that need to be explored (synchronously or asynchronously).
             std::vector<OutputAndEdges> edges;
+
+            /// For each automaton that is put in parallel, an index over the guards of its edges (referred to by the edge index).
+            std::vector<GuardIndex> guardIndices;
             
             /// The names and defining expressions of reward models that need to be considered.
             std::vector<std::pair<std::string, storm::expressions::Expression>> rewardExpressions;
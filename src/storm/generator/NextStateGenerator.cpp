@@ -32,7 +32,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), actionMask(mask) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), deferStateUnpacking(false), currentStateIsUnpacked(false), actionMask(mask) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -42,7 +42,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask)  {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), deferStateUnpacking(false), currentStateIsUnpacked(false), actionMask(mask)  {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -51,6 +51,11 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+            return nullptr;
+        }
+        
         template<typename ValueType, typename StateType>
         NextStateGeneratorOptions const& NextStateGenerator<ValueType, StateType>::getOptions() const {
             return options;
@@ -64,14 +69,15 @@ namespace storm {
         template<typename ValueType, typename StateType>
         storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
             storm::storage::sparse::StateValuationsBuilder result;
+            // The values of locations and integer variables are packed in the same way as in the compressed states.
             for (auto const& v : variableInformation.locationVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, 0, v.bitWidth);
             }
             for (auto const& v : variableInformation.booleanVariables) {
                 result.addVariable(v.variable);
             }
             for (auto const& v : variableInformation.integerVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, v.lowerBound, v.bitWidth);
             }
             return result;
         }
@@ -86,7 +92,7 @@ namespace storm {
             }
             for (auto const& v : variableInformation.integerVariables) {
                 if(v.observable) {
-                    result.addVariable(v.variable);
+                    result.addVariable(v.variable, v.lowerBound, v.bitWidth);
                 }
             }
             for (auto const& l : variableInformation.observationLabels) {
@@ -97,11 +103,23 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-            
-            // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
+            currentStateIsUnpacked = false;
+
+            // Since almost all subsequent operations are based on the evaluator, we load the state into it now (unless
+            // the generator evaluates most expressions directly on the state).
+            if (!deferStateUnpacking) {
+                unpackCurrentStateIntoEvaluator();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::unpackCurrentStateIntoEvaluator() const {
+            if (!currentStateIsUnpacked) {
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                currentStateIsUnpacked = true;
+            }
         }
         
         template<typename ValueType, typename StateType>
@@ -109,6 +127,7 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
+            unpackCurrentStateIntoEvaluator();
             return evaluator->asBool(expression);
         }
 
@@ -192,6 +211,7 @@ namespace storm {
                     }
                 }
             }
+            currentStateIsUnpacked = false;
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
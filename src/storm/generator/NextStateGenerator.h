@@ -91,6 +91,14 @@ namespace storm {
 
             virtual ~NextStateGenerator() = default;
 
+            /*!
+             * Creates a copy of this generator that can be used independently of (and concurrently to) this generator,
+             * e.g., to explore different states in parallel. No state is loaded into the copy.
+             *
+             * @return The copy or a null pointer if this generator can not be copied.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+
             uint64_t getStateSize() const;
             virtual ModelType getModelType() const = 0;
             virtual bool isDeterministicModel() const = 0;
@@ -160,6 +168,12 @@ namespace storm {
 
             void postprocess(StateBehavior<ValueType, StateType>& result);
 
+            /*!
+             * Unpacks the currently loaded state into the evaluator unless this already happened. Generators that
+             * defer unpacking the states need to call this before they use the evaluator.
+             */
+            void unpackCurrentStateIntoEvaluator() const;
+
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
 
@@ -178,6 +192,12 @@ namespace storm {
             /// The currently loaded state.
             CompressedState const* state;
 
+            /// A flag indicating whether loading a state does not unpack it into the evaluator right away.
+            bool deferStateUnpacking;
+
+            /// A flag indicating whether the currently loaded state has been unpacked into the evaluator.
+            mutable bool currentStateIsUnpacked;
+
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
 
@@ -39,6 +39,14 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
+            // Most expressions are evaluated directly on the states, so the states are only unpacked into the evaluator
+            // if an expression needs to be evaluated that could not be compiled.
+            compileExpressions();
+            this->deferStateUnpacking = true;
+
+            // Commands whose guards can not hold in a state are skipped by means of the guard indices.
+            buildGuardIndices();
+
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -88,6 +96,106 @@ namespace storm {
             }
         }
 
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            if (this->actionMask) {
+                return nullptr;
+            }
+            // The program of this generator is already preprocessed, so we can use the delegate constructor.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(this->program, this->options, this->actionMask, false));
+        }
+
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            // Like the evaluator, the bytecode evaluates guards and assignments with doubles. The likelihoods, however,
+            // are evaluated with the value type, so we only compile them if it is double.
+            bool const compileLikelihoods = std::is_same<ValueType, double>::value;
+            BytecodeExpressionCompiler compiler(this->variableInformation);
+
+            uint64_t highestCommandIndex = 0;
+            uint64_t highestUpdateIndex = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    highestCommandIndex = std::max<uint64_t>(highestCommandIndex, command.getGlobalIndex());
+                    for (auto const& update : command.getUpdates()) {
+                        highestUpdateIndex = std::max<uint64_t>(highestUpdateIndex, update.getGlobalIndex());
+                    }
+                }
+            }
+            compiledGuards.resize(highestCommandIndex + 1);
+            compiledUpdates.resize(highestUpdateIndex + 1);
+            storm::storage::BitVector seenCommands(highestCommandIndex + 1);
+            storm::storage::BitVector seenUpdates(highestUpdateIndex + 1);
+
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    bool uniqueIndices = !seenCommands.get(command.getGlobalIndex());
+                    for (auto const& update : command.getUpdates()) {
+                        uniqueIndices &= !seenUpdates.get(update.getGlobalIndex());
+                        seenUpdates.set(update.getGlobalIndex());
+                    }
+                    if (!uniqueIndices) {
+                        // The compiled expressions are looked up by the global indices, so they need to be unique.
+                        STORM_LOG_DEBUG("Not compiling the expressions of the program as its commands or updates do not have unique indices.");
+                        compiledGuards.clear();
+                        compiledUpdates.clear();
+                        return;
+                    }
+                    seenCommands.set(command.getGlobalIndex());
+                    compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+
+                    for (auto const& update : command.getUpdates()) {
+                        CompiledUpdate& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+                        if (compileLikelihoods) {
+                            compiledUpdate.likelihood = compiler.compile(update.getLikelihoodExpression());
+                        }
+                        std::vector<BytecodeExpression> assignments;
+                        for (auto const& assignment : update.getAssignments()) {
+                            boost::optional<BytecodeExpression> compiledAssignment = compiler.compile(assignment.getExpression());
+                            if (!compiledAssignment) {
+                                break;
+                            }
+                            assignments.push_back(std::move(compiledAssignment.get()));
+                        }
+                        if (assignments.size() == update.getNumberOfAssignments()) {
+                            compiledUpdate.assignments = std::move(assignments);
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            guardIndices.reserve(program.getNumberOfModules());
+            for (auto const& module : program.getModules()) {
+                std::vector<storm::expressions::Expression> guards;
+                guards.reserve(module.getNumberOfCommands());
+                for (auto const& command : module.getCommands()) {
+                    guards.push_back(command.getGuardExpression());
+                }
+                guardIndices.emplace_back(guards, this->variableInformation);
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isGuardEnabled(storm::prism::Command const& command) const {
+            if (command.getGlobalIndex() < compiledGuards.size() && compiledGuards[command.getGlobalIndex()]) {
+                return compiledGuards[command.getGlobalIndex()].get().evaluateAsBool(*this->state, registers);
+            }
+            this->unpackCurrentStateIntoEvaluator();
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::getLikelihood(storm::prism::Update const& update) const {
+            if (update.getGlobalIndex() < compiledUpdates.size() && compiledUpdates[update.getGlobalIndex()].likelihood) {
+                return storm::utility::convertNumber<ValueType>(compiledUpdates[update.getGlobalIndex()].likelihood.get().evaluateAsDouble(*this->state, registers));
+            }
+            this->unpackCurrentStateIntoEvaluator();
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+
         template<typename ValueType, typename StateType>
         bool PrismNextStateGenerator<ValueType, StateType>::canHandle(storm::prism::Program const& program) {
             // We can handle all valid prism programs (except for PTAs)
@@ -262,6 +370,7 @@ namespace storm {
             for (auto const& rewardModel : rewardModels) {
                 ValueType stateRewardValue = storm::utility::zero<ValueType>();
                 if (rewardModel.get().hasStateRewards()) {
+                    this->unpackCurrentStateIntoEvaluator();
                     for (auto const& stateReward : rewardModel.get().getStateRewards()) {
                         if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
                             stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
@@ -273,6 +382,7 @@ namespace storm {
 
             // If a terminal expression was set and we must not expand this state, return now.
             if (!this->terminalStates.empty()) {
+                this->unpackCurrentStateIntoEvaluator();
                 for (auto const& expressionBool : this->terminalStates) {
                     if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
                         return result;
@@ -345,6 +455,7 @@ namespace storm {
                 for (auto const& rewardModel : rewardModels) {
                     ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                     if (rewardModel.get().hasStateActionRewards()) {
+                        this->unpackCurrentStateIntoEvaluator();
                         for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                             for (auto const& choice : allChoices) {
                                 if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
@@ -389,6 +500,7 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
+            this->unpackCurrentStateIntoEvaluator();
             return this->evaluator->asBool(expr);
         }
 
@@ -405,13 +517,28 @@ namespace storm {
             auto assignmentIt = update.getAssignments().begin();
             auto assignmentIte = update.getAssignments().end();
 
+            // If possible, we evaluate the compiled assignments. Like the evaluator, they refer to the currently loaded
+            // state rather than the given (possibly intermediate) state.
+            std::vector<BytecodeExpression> const* compiledAssignments = nullptr;
+            if (update.getGlobalIndex() < compiledUpdates.size() && compiledUpdates[update.getGlobalIndex()].assignments) {
+                compiledAssignments = &compiledUpdates[update.getGlobalIndex()].assignments.get();
+            } else {
+                this->unpackCurrentStateIntoEvaluator();
+            }
+            auto compiledAssignmentIt = compiledAssignments ? compiledAssignments->begin() : std::vector<BytecodeExpression>::const_iterator();
+
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
             for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                if (compiledAssignments) {
+                    newState.set(boolIt->bitOffset, compiledAssignmentIt->evaluateAsBool(*this->state, registers));
+                    ++compiledAssignmentIt;
+                } else {
+                    newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                }
             }
 
             // Iterate over all integer assignments and carry them out.
@@ -420,7 +547,13 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue;
+                if (compiledAssignments) {
+                    assignedValue = compiledAssignmentIt->evaluateAsInt(*this->state, registers);
+                    ++compiledAssignmentIt;
+                } else {
+                    assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                }
                 if (this->options.isAddOutOfBoundsStateSet()) {
                     if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                         return this->outOfBoundsState;
@@ -440,10 +573,11 @@ namespace storm {
         }
 
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(storm::prism::Module const* modulePtr, GuardIndex const* guardIndexPtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), guardIndexPtr(guardIndexPtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
                 // Intentionally left empty
             }
             storm::prism::Module const* modulePtr;
+            GuardIndex const* guardIndexPtr;
             std::set<uint_fast64_t> const* commandIndicesPtr;
             typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
         };
@@ -467,6 +601,7 @@ namespace storm {
                 }
 
                 std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                GuardIndex const& guardIndex = guardIndices[i];
 
                 // If the module contains the action, but there is no command in the module that is labeled with
                 // this action, we don't have any feasible command combinations.
@@ -477,6 +612,9 @@ namespace storm {
                 // Look up commands by their indices and check if the guard evaluates to true in the given state.
                 bool hasOneEnabledCommand = false;
                 for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
+                    if (!guardIndex.isCandidate(*this->state, *commandIndexIt)) {
+                        continue;
+                    }
                     storm::prism::Command const& command = module.getCommand(*commandIndexIt);
                     if (!isCommandPotentiallySynchronizing(command)) {
                         continue;
@@ -487,10 +625,10 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardEnabled(command)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
-                        activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                        activeCommands.emplace_back(&module, &guardIndex, &commandIndices, commandIndexIt);
                         break;
                     }
                 }
@@ -514,6 +652,9 @@ namespace storm {
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
                 auto commandIndexIte = activeCommand.commandIndicesPtr->end();
                 for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
+                    if (!activeCommand.guardIndexPtr->isCandidate(*this->state, *commandIndexIt)) {
+                        continue;
+                    }
                     storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -521,7 +662,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardEnabled(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -541,8 +682,8 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all commands whose guard can possibly be enabled.
+                for (uint_fast64_t j : guardIndices[i].getCandidates(state)) {
                     storm::prism::Command const& command = module.getCommand(j);
 
                     // Only consider commands that are not possibly synchronizing.
@@ -561,7 +702,7 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isGuardEnabled(command)) {
                         continue;
                     }
 
@@ -579,7 +720,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = getLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -597,6 +738,7 @@ namespace storm {
                     for (auto const& rewardModel : rewardModels) {
                         ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                         if (rewardModel.get().hasStateActionRewards()) {
+                            this->unpackCurrentStateIntoEvaluator();
                             for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                                 if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
                                     stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
@@ -640,7 +782,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * getLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -720,6 +862,7 @@ namespace storm {
                         for (auto const& rewardModel : rewardModels) {
                             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                             if (rewardModel.get().hasStateActionRewards()) {
+                                this->unpackCurrentStateIntoEvaluator();
                                 for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                                     if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
                                         stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
@@ -782,6 +925,7 @@ namespace storm {
                 return result;
             }
             unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+            this->currentStateIsUnpacked = false;
             for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
                 result.setFromInt(64*i,64,this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
             }
@@ -790,7 +934,9 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         void PrismNextStateGenerator<ValueType, StateType>::extendStateInformation(storm::json<ValueType>& result) const {
-
+            if (program.getNumberOfObservationLabels() > 0) {
+                this->unpackCurrentStateIntoEvaluator();
+            }
             for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
                 result[program.getObservationLabels()[i].getName()] = this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression());
             }
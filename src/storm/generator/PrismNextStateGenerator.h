@@ -2,6 +2,8 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeExpression.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -31,6 +33,12 @@ namespace storm {
              * returns true, the model might still be unsupported.
              */
             static bool canHandle(storm::prism::Program const& program);
+
+            /*!
+             * Creates a copy of this generator. Generators with an action mask can not be copied as the mask might not
+             * be safe to be queried concurrently.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
             
             virtual ModelType getModelType() const override;
             virtual bool isDeterministicModel() const override;
@@ -67,6 +75,27 @@ namespace storm {
              * @return The resulting state.
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+
+            /*!
+             * Compiles the guards, likelihoods and assignments of the program such that they can be evaluated directly
+             * on the compressed states.
+             */
+            void compileExpressions();
+
+            /*!
+             * Builds the guard indices of the modules.
+             */
+            void buildGuardIndices();
+
+            /*!
+             * Checks whether the guard of the given command is satisfied in the currently loaded state.
+             */
+            bool isGuardEnabled(storm::prism::Command const& command) const;
+
+            /*!
+             * Evaluates the likelihood of the given update in the currently loaded state.
+             */
+            ValueType getLikelihood(storm::prism::Update const& update) const;
             
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -130,6 +159,26 @@ namespace storm {
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
 
+            // The compiled guards of the commands (indexed by their global index). Guards that could not be compiled
+            // are evaluated with the evaluator.
+            std::vector<boost::optional<BytecodeExpression>> compiledGuards;
+
+            // The compiled likelihood and assignment expressions of an update.
+            struct CompiledUpdate {
+                boost::optional<BytecodeExpression> likelihood;
+                // The compiled assignment expressions (in the order of the assignments) if all of them could be compiled.
+                boost::optional<std::vector<BytecodeExpression>> assignments;
+            };
+
+            // The compiled updates (indexed by their global index).
+            std::vector<CompiledUpdate> compiledUpdates;
+
+            // The registers used for evaluating the compiled expressions.
+            mutable BytecodeExpression::Registers registers;
+
+            // For each module, an index over the guards of its commands (referred to by their index within the module).
+            std::vector<GuardIndex> guardIndices;
+
             // Mappings from module/action indices to the programs players
             std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
             std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
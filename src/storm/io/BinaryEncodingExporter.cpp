@@ -0,0 +1,176 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace exporter {
+
+        const std::string BinaryEncoding::magic = "STORMBIN";
+        const uint64_t BinaryEncoding::byteOrderMark = 0x0102030405060708ull;
+        const uint64_t BinaryEncoding::version = 1;
+
+        namespace {
+            /*!
+             * Writes the components of a model in the binary encoding to a stream.
+             */
+            class BinaryEncodingWriter {
+            public:
+                BinaryEncodingWriter(std::ostream& stream) : stream(stream) {
+                    // Intentionally left empty.
+                }
+
+                void writeNumber(uint64_t value) {
+                    writeArray(&value, 1);
+                }
+
+                template<typename ElementType>
+                void writeArray(ElementType const* data, uint64_t size) {
+                    uint64_t numberOfBytes = size * sizeof(ElementType);
+                    stream.write(reinterpret_cast<char const*>(data), numberOfBytes);
+                    // Pad the array such that the next one starts at a multiple of 8 bytes.
+                    if (numberOfBytes % 8 != 0) {
+                        char const padding[8] = {};
+                        stream.write(padding, 8 - numberOfBytes % 8);
+                    }
+                }
+
+                template<typename ElementType>
+                void writeVector(std::vector<ElementType> const& vector) {
+                    writeNumber(vector.size());
+                    writeArray(vector.data(), vector.size());
+                }
+
+                void writeString(std::string const& string) {
+                    writeNumber(string.size());
+                    writeArray(string.data(), string.size());
+                }
+
+                void writeBitVector(storm::storage::BitVector const& bitVector) {
+                    writeNumber(bitVector.size());
+                    for (uint64_t bit = 0; bit < bitVector.size(); bit += 64) {
+                        writeNumber(bitVector.getAsInt(bit, std::min<uint64_t>(64, bitVector.size() - bit)));
+                    }
+                }
+
+                void writeMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+                    writeNumber(matrix.getRowCount());
+                    writeNumber(matrix.getColumnCount());
+                    writeNumber(matrix.getEntryCount());
+
+                    std::vector<uint64_t> rowIndications(matrix.getRowCount() + 1, matrix.getEntryCount());
+                    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                        rowIndications[row] = std::distance(matrix.begin(), matrix.begin(row));
+                    }
+                    writeArray(rowIndications.data(), rowIndications.size());
+                    if (matrix.getEntryCount() > 0) {
+                        // The entries are written exactly as they are stored in memory.
+                        writeArray(&*matrix.begin(), matrix.getEntryCount());
+                    }
+
+                    writeNumber(matrix.hasTrivialRowGrouping() ? 0 : 1);
+                    if (!matrix.hasTrivialRowGrouping()) {
+                        writeVector(matrix.getRowGroupIndices());
+                    }
+                }
+
+                void writeLabeling(storm::models::sparse::ItemLabeling const& labeling, std::function<storm::storage::BitVector const& (std::string const&)> const& getItems) {
+                    std::set<std::string> labels = labeling.getLabels();
+                    writeNumber(labels.size());
+                    for (auto const& label : labels) {
+                        writeString(label);
+                        writeBitVector(getItems(label));
+                    }
+                }
+
+            private:
+                std::ostream& stream;
+            };
+        }
+
+        void binaryExportSparseModel(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+            STORM_LOG_THROW(!sparseModel->isOfType(storm::models::ModelType::S2pg) && !sparseModel->isOfType(storm::models::ModelType::Smg), storm::exceptions::NotSupportedException, "Exporting games in the binary encoding is not supported.");
+
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+            BinaryEncodingWriter writer(stream);
+
+            // Header
+            writer.writeArray(BinaryEncoding::magic.data(), BinaryEncoding::magic.size());
+            writer.writeNumber(BinaryEncoding::byteOrderMark);
+            writer.writeNumber(BinaryEncoding::version);
+            std::stringstream modelType;
+            modelType << sparseModel->getType();
+            writer.writeString(modelType.str());
+
+            // Transitions and labels
+            writer.writeMatrix(sparseModel->getTransitionMatrix());
+            auto const& stateLabeling = sparseModel->getStateLabeling();
+            writer.writeLabeling(stateLabeling, [&stateLabeling] (std::string const& label) -> storm::storage::BitVector const& { return stateLabeling.getStates(label); });
+
+            // Reward models
+            std::map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels(sparseModel->getRewardModels().begin(), sparseModel->getRewardModels().end());
+            writer.writeNumber(rewardModels.size());
+            for (auto const& rewardModel : rewardModels) {
+                writer.writeString(rewardModel.first);
+                writer.writeNumber(rewardModel.second.hasStateRewards() ? 1 : 0);
+                if (rewardModel.second.hasStateRewards()) {
+                    writer.writeVector(rewardModel.second.getStateRewardVector());
+                }
+                writer.writeNumber(rewardModel.second.hasStateActionRewards() ? 1 : 0);
+                if (rewardModel.second.hasStateActionRewards()) {
+                    writer.writeVector(rewardModel.second.getStateActionRewardVector());
+                }
+                writer.writeNumber(rewardModel.second.hasTransitionRewards() ? 1 : 0);
+                if (rewardModel.second.hasTransitionRewards()) {
+                    writer.writeMatrix(rewardModel.second.getTransitionRewardMatrix());
+                }
+            }
+
+            // Model-specific components
+            writer.writeNumber(sparseModel->hasChoiceLabeling() ? 1 : 0);
+            if (sparseModel->hasChoiceLabeling()) {
+                auto const& choiceLabeling = sparseModel->getChoiceLabeling();
+                writer.writeLabeling(choiceLabeling, [&choiceLabeling] (std::string const& label) -> storm::storage::BitVector const& { return choiceLabeling.getChoices(label); });
+            }
+
+            if (sparseModel->isOfType(storm::models::ModelType::Ctmc)) {
+                writer.writeNumber(1);
+                writer.writeVector(sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+            } else if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                writer.writeNumber(1);
+                writer.writeVector(sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>()->getExitRates());
+            } else {
+                writer.writeNumber(0);
+            }
+
+            writer.writeNumber(sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton) ? 1 : 0);
+            if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                writer.writeBitVector(sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates());
+            }
+
+            writer.writeNumber(sparseModel->isOfType(storm::models::ModelType::Pomdp) ? 1 : 0);
+            if (sparseModel->isOfType(storm::models::ModelType::Pomdp)) {
+                writer.writeVector(sparseModel->template as<storm::models::sparse::Pomdp<double>>()->getObservations());
+            }
+
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Error while writing to file " << filename << ".");
+            stream.close();
+        }
+
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * The binary encoding stores the components of a sparse model as the raw arrays that make up their in-memory
+         * representation, such that they can be loaded without any parsing. All numbers are stored in the byte order of
+         * the machine that wrote the file and every array starts at a multiple of 8 bytes.
+         *
+         * The file starts with the magic string 'STORMBIN', a byte order mark (which reveals whether the file was written
+         * with a different byte order), the version of the encoding and the model type. It is followed
+         * by the transition matrix, the state labeling, the reward models, the choice labeling, the exit rates, the
+         * Markovian states and the observations, where the optional components are preceded by a flag.
+         */
+        struct BinaryEncoding {
+            // The first bytes of every file in the binary encoding.
+            static const std::string magic;
+
+            // A number whose bytes are all different, such that files written with a different byte order are recognized.
+            static const uint64_t byteOrderMark;
+
+            // The version of the encoding that is written. Files of other versions are rejected.
+            static const uint64_t version;
+        };
+
+        /*!
+         * Exports a sparse model into the binary encoding. Only models with double values are supported.
+         *
+         * @param filename The file to write the model to.
+         * @param sparseModel The model to export.
+         */
+        void binaryExportSparseModel(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+    }
+}
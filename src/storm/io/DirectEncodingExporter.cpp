@@ -1,6 +1,9 @@
 #include <storm/exceptions/NotSupportedException.h>
 #include "storm/io/DirectEncodingExporter.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -12,11 +15,190 @@
 #include "storm/models/sparse/Pomdp.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 
 
 namespace storm {
     namespace exporter {
 
+        namespace {
+            /*!
+             * Appends the decimal representation of the number to the string.
+             */
+            void appendNumber(std::string& out, uint64_t number) {
+                char digits[20];
+                uint64_t numberOfDigits = 0;
+                do {
+                    digits[numberOfDigits++] = '0' + number % 10;
+                    number /= 10;
+                } while (number != 0);
+                while (numberOfDigits > 0) {
+                    out.push_back(digits[--numberOfDigits]);
+                }
+            }
+
+            /*!
+             * Appends the value (or its placeholder) to the string, formatted by the given stream.
+             */
+            template<typename ValueType>
+            void appendValue(std::string& out, std::ostringstream& stream, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders) {
+                stream.str(std::string());
+                writeValue(stream, value, placeholders);
+                out += stream.str();
+            }
+
+            /*!
+             * Formats the states of a model in the explicit DRN format. Values are formatted like the given stream
+             * (e.g., with its precision) would format them.
+             */
+            template<typename ValueType>
+            class StateFormatter {
+            public:
+                StateFormatter(storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> const& exitRates, std::unordered_map<ValueType, std::string> const& placeholders, std::ios const& format) : model(model), matrix(model.getTransitionMatrix()), exitRates(exitRates), placeholders(placeholders), format(format), observations(nullptr) {
+                    if (model.getType() == storm::models::ModelType::Pomdp) {
+                        observations = &static_cast<storm::models::sparse::Pomdp<ValueType> const&>(model).getObservations();
+                    }
+                    for (auto const& rewardModelEntry : model.getRewardModels()) {
+                        stateRewards.push_back(rewardModelEntry.second.hasStateRewards() ? &rewardModelEntry.second.getStateRewardVector() : nullptr);
+                        actionRewards.push_back(rewardModelEntry.second.hasStateActionRewards() ? &rewardModelEntry.second.getStateActionRewardVector() : nullptr);
+                    }
+                    // Only labels with a whitespace are put in (double) quotation marks.
+                    for (auto const& label : model.getStateLabeling().getLabels()) {
+                        StateLabel stateLabel;
+                        stateLabel.formattedLabel = std::count_if(label.begin(), label.end(), isspace) > 0 ? " \"" + label + "\"" : " " + label;
+                        stateLabel.hasQuotationMarks = std::count(label.begin(), label.end(), '\"') > 0;
+                        stateLabel.states = &model.getStateLabeling().getStates(label);
+                        stateLabels.push_back(std::move(stateLabel));
+                    }
+                    if (model.hasChoiceLabeling()) {
+                        for (auto const& label : model.getChoiceLabeling().getLabels()) {
+                            choiceLabels.emplace_back(label, &model.getChoiceLabeling().getChoices(label));
+                        }
+                    }
+                }
+
+                /*!
+                 * Appends the given range of states and their outgoing transitions to the string.
+                 */
+                void formatStates(std::string& out, uint64_t firstState, uint64_t endState) const {
+                    std::ostringstream valueStream;
+                    valueStream.copyfmt(format);
+                    for (uint64_t group = firstState; group < endState; ++group) {
+                        out += "state ";
+                        appendNumber(out, group);
+
+                        // Write exit rates for CTMCs and MAs
+                        if (!exitRates.empty()) {
+                            out += " !";
+                            appendValue(out, valueStream, exitRates.at(group), placeholders);
+                        }
+
+                        if (observations) {
+                            out += " {";
+                            appendNumber(out, observations->at(group));
+                            out += "}";
+                        }
+
+                        // Write state rewards
+                        appendRewards(out, valueStream, stateRewards, group);
+
+                        // Write labels
+                        for (auto const& label : stateLabels) {
+                            if (label.states->get(group)) {
+                                STORM_LOG_THROW(!label.hasQuotationMarks, storm::exceptions::NotSupportedException,
+                                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                                out += label.formattedLabel;
+                            }
+                        }
+                        out += "\n";
+                        // Write state valuations as comments
+                        if (model.hasStateValuations()) {
+                            out += "//";
+                            out += model.getStateValuations().getStateInfo(group);
+                            out += "\n";
+                        }
+
+                        // Write probabilities
+                        uint64_t start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+                        uint64_t end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+                        // Iterate over all actions
+                        for (uint64_t row = start; row < end; ++row) {
+                            // Write choice
+                            out += "\taction ";
+                            if (model.hasChoiceLabeling()) {
+                                bool hasLabel = false;
+                                for (auto const& label : choiceLabels) {
+                                    if (label.second->get(row)) {
+                                        out += label.first;
+                                        hasLabel = true;
+                                    }
+                                }
+                                if (!hasLabel) {
+                                    out += "__NOLABEL__";
+                                }
+                            } else {
+                                appendNumber(out, row - start);
+                            }
+
+                            // Write action rewards
+                            appendRewards(out, valueStream, actionRewards, row);
+                            out += "\n";
+
+                            // Write transitions
+                            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
+                                out += "\t\t";
+                                appendNumber(out, it->getColumn());
+                                out += " : ";
+                                appendValue(out, valueStream, it->getValue(), placeholders);
+                                out += "\n";
+                            }
+                        }
+                    }
+                }
+
+            private:
+                void appendRewards(std::string& out, std::ostringstream& valueStream, std::vector<std::vector<ValueType> const*> const& rewards, uint64_t index) const {
+                    bool first = true;
+                    for (auto const& rewardVector : rewards) {
+                        out += first ? " [" : ", ";
+                        first = false;
+                        if (rewardVector) {
+                            appendValue(out, valueStream, rewardVector->at(index), placeholders);
+                        } else {
+                            out += "0";
+                        }
+                    }
+                    if (!first) {
+                        out += "]";
+                    }
+                }
+
+                storm::models::sparse::Model<ValueType> const& model;
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::vector<ValueType> const& exitRates;
+                std::unordered_map<ValueType, std::string> const& placeholders;
+                std::ios const& format;
+                std::vector<uint32_t> const* observations;
+
+                // The reward vectors of the reward models (in the order of the header) or null if they are not present.
+                std::vector<std::vector<ValueType> const*> stateRewards;
+                std::vector<std::vector<ValueType> const*> actionRewards;
+
+                struct StateLabel {
+                    std::string formattedLabel;
+                    bool hasQuotationMarks;
+                    storm::storage::BitVector const* states;
+                };
+
+                // The labels together with the states or choices that have them.
+                std::vector<StateLabel> stateLabels;
+                std::vector<std::pair<std::string, storm::storage::BitVector const*>> choiceLabels;
+            };
+        }
+
         template<typename ValueType>
         void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
 
@@ -69,118 +251,30 @@ namespace storm {
             os << "@nr_choices" << std::endl << sparseModel->getNumberOfChoices() << std::endl;
             os << "@model" << std::endl;
 
-            storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-
-            // Iterate over states and export state information and outgoing transitions
-            for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-                os << "state " << group;
-
-                // Write exit rates for CTMCs and MAs
-                if (!exitRates.empty()) {
-                    os << " !";
-                    writeValue(os, exitRates.at(group), placeholders);
-                }
-
-
-                if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-                    os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-                }
-
-                // Write state rewards
-                bool first = true;
-                for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                    if (first) {
-                        os << " [";
-                        first = false;
-                    } else {
-                        os << ", ";
-                    }
-
-                    if (rewardModelEntry.second.hasStateRewards()) {
-                        writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-                    } else {
-                        os << "0";
-                    }
-                }
-
-                if (!first) {
-                    os << "]";
-                }
-
-                // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-                for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-                    STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                                    "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-                    // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-                    if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                        os << " \"" << label << "\"";
-                    } else {
-                        os << " " << label;
-                    }
-                }
-                os << std::endl;
-                // Write state valuations as comments
-                if(sparseModel->hasStateValuations()) {
-                    os << "//" << sparseModel->getStateValuations().getStateInfo(group) << std::endl;
-                }
-
-                // Write probabilities
-                typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-                typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-                // Iterate over all actions
-                for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-                    // Write choice
-                    if (sparseModel->hasChoiceLabeling()) {
-                        os << "\taction ";
-                        bool lfirst = true;
-                        if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                            os << "__NOLABEL__";
-                        }
-                        for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                            if (!lfirst) {
-                                os << "_";
-                                lfirst = false;
-                            }
-                            os << label;
-                        }
-                    } else {
-                        os << "\taction " << row - start;
-                    }
-
-                    // Write action rewards
-                    bool first = true;
-                    for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                        if (first) {
-                            os << " [";
-                            first = false;
-                        } else {
-                            os << ", ";
-                        }
-
-                        if (rewardModelEntry.second.hasStateActionRewards()) {
-                            writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                        } else {
-                            os << "0";
-                        }
-
-                    }
-                    if (!first) {
-                        os << "]";
-                    }
-                    os << std::endl;
-
-                    // Write transitions
-                    for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                        ValueType prob = it->getValue();
-                        os << "\t\t" << it->getColumn() << " : ";
-                        writeValue(os, prob, placeholders);
-                        os << std::endl;
-                    }
-
+            // The states are formatted in blocks (in parallel) into buffers that are written to the stream in order.
+            // Only a bounded number of blocks is kept in memory at a time.
+            uint64_t numberOfThreads = std::max<uint64_t>(1, options.numberOfThreads);
+            if (numberOfThreads > 1 && storm::NumberTraits<ValueType>::IsExact) {
+                // Exact numbers may share (reference counted) state that is not thread-safe.
+                STORM_LOG_INFO("Exporting the states sequentially as parallel exporting is only supported for floating point numbers.");
+                numberOfThreads = 1;
+            }
+            uint64_t const statesPerBlock = 4096;
+            uint64_t const blocksPerRound = 4 * numberOfThreads;
+            StateFormatter<ValueType> formatter(*sparseModel, exitRates, placeholders, os);
+            std::vector<std::string> buffers(blocksPerRound);
+            uint64_t numberOfStates = sparseModel->getTransitionMatrix().getRowGroupCount();
+            for (uint64_t firstState = 0; firstState < numberOfStates; firstState += statesPerBlock * blocksPerRound) {
+                uint64_t numberOfBlocks = std::min(blocksPerRound, (numberOfStates - firstState + statesPerBlock - 1) / statesPerBlock);
+                storm::utility::parallel::execute(numberOfThreads, numberOfBlocks, [&] (uint64_t block) {
+                    uint64_t blockBegin = firstState + block * statesPerBlock;
+                    buffers[block].clear();
+                    formatter.formatStates(buffers[block], blockBegin, std::min(blockBegin + statesPerBlock, numberOfStates));
+                });
+                for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+                    os.write(buffers[block].data(), buffers[block].size());
                 }
-            } // end state iteration
-
+            }
         }
 
         template<typename ValueType>
@@ -10,6 +10,8 @@ namespace storm {
 
         struct DirectEncodingOptions {
             bool allowPlaceholders = true;
+            // The number of threads used to format the states (only for floating point numbers).
+            uint64_t numberOfThreads = 1;
         };
         /*!
          * Exports a sparse model into the explicit DRN format.
@@ -1,5 +1,6 @@
 #include "ModelExportFormat.h"
 
+#include "storm/io/compression.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -7,7 +8,9 @@ namespace storm {
 namespace exporter {
 
     ModelExportFormat getModelExportFormatFromString(std::string const& input) {
-        if (input == "dot") {
+        if (input == "bin") {
+            return ModelExportFormat::Binary;
+        } else if (input == "dot") {
             return ModelExportFormat::Dot;
         } else if (input == "drdd") {
             return ModelExportFormat::Drdd;
@@ -21,6 +24,7 @@ namespace exporter {
     
     std::string toString(ModelExportFormat const& input) {
         switch(input) {
+            case ModelExportFormat::Binary: return "bin";
             case ModelExportFormat::Dot: return "dot";
             case ModelExportFormat::Drdd: return "drdd";
             case ModelExportFormat::Drn: return "drn";
@@ -30,10 +34,12 @@ namespace exporter {
     }
     
     ModelExportFormat getModelExportFormatFromFileExtension(std::string const& filename) {
-        auto pos = filename.find_last_of('.');
+        // The format of compressed files is given by the extension in front of .gz
+        std::string uncompressedFilename = storm::utility::removeGzipExtension(filename);
+        auto pos = uncompressedFilename.find_last_of('.');
         STORM_LOG_THROW(pos != std::string::npos, storm::exceptions::InvalidArgumentException, "Couldn't detect a file extension from input filename '" << filename << "'.");
         ++pos;
-        return getModelExportFormatFromString(filename.substr(pos));
+        return getModelExportFormatFromString(uncompressedFilename.substr(pos));
     }
     
 }
@@ -6,6 +6,7 @@ namespace storm {
 namespace exporter {
 
     enum class ModelExportFormat {
+        Binary,
         Dot,
         Drdd,
         Drn,
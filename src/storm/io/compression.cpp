@@ -0,0 +1,219 @@
+#include "storm/io/compression.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace utility {
+
+        namespace {
+            std::string const gzipExtension = ".gz";
+
+            // The size of the chunks in which data is passed to zlib.
+            uint64_t const gzipChunkSize = 1 << 18;
+        }
+
+        bool isGzipFilename(std::string const& filename) {
+            return filename.size() > gzipExtension.size() && filename.compare(filename.size() - gzipExtension.size(), gzipExtension.size(), gzipExtension) == 0;
+        }
+
+        std::string removeGzipExtension(std::string const& filename) {
+            return isGzipFilename(filename) ? filename.substr(0, filename.size() - gzipExtension.size()) : filename;
+        }
+
+        bool isGzipCompressed(char const* begin, char const* end) {
+            return end - begin >= 2 && static_cast<unsigned char>(begin[0]) == 0x1f && static_cast<unsigned char>(begin[1]) == 0x8b;
+        }
+
+#ifdef STORM_HAVE_ZLIB
+        class GzipInputFileStream::Buffer : public std::streambuf {
+        public:
+            Buffer(std::string const& filename) : input(gzipChunkSize), output(gzipChunkSize), finished(false) {
+                file.open(filename, std::ios::in | std::ios::binary);
+                STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+                stream = {};
+                // Adding 32 to the window size lets zlib detect the gzip header.
+                STORM_LOG_THROW(inflateInit2(&stream, 15 + 32) == Z_OK, storm::exceptions::FileIoException, "Could not initialize the decompression.");
+                setg(output.data(), output.data(), output.data());
+            }
+
+            ~Buffer() {
+                inflateEnd(&stream);
+            }
+
+        protected:
+            int_type underflow() override {
+                if (gptr() < egptr()) {
+                    return traits_type::to_int_type(*gptr());
+                }
+                while (!finished) {
+                    if (stream.avail_in == 0) {
+                        file.read(input.data(), input.size());
+                        stream.next_in = reinterpret_cast<Bytef*>(input.data());
+                        stream.avail_in = static_cast<uInt>(file.gcount());
+                        STORM_LOG_THROW(stream.avail_in > 0, storm::exceptions::WrongFormatException, "Unexpected end of the compressed data.");
+                    }
+                    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+                    stream.avail_out = output.size();
+                    int status = inflate(&stream, Z_NO_FLUSH);
+                    if (status == Z_STREAM_END) {
+                        if (stream.avail_in == 0 && file.peek() == std::ifstream::traits_type::eof()) {
+                            finished = true;
+                        } else {
+                            // Concatenated gzip files are decompressed one after the other.
+                            status = inflateReset(&stream);
+                        }
+                    }
+                    STORM_LOG_THROW(status == Z_OK || status == Z_STREAM_END, storm::exceptions::WrongFormatException, "Could not decompress the data: " << (stream.msg ? stream.msg : "unknown error") << ".");
+                    uint64_t size = output.size() - stream.avail_out;
+                    if (size > 0) {
+                        setg(output.data(), output.data(), output.data() + size);
+                        return traits_type::to_int_type(*gptr());
+                    }
+                }
+                return traits_type::eof();
+            }
+
+        private:
+            std::ifstream file;
+            z_stream stream;
+            std::vector<char> input;
+            std::vector<char> output;
+            bool finished;
+        };
+
+        class GzipOutputFileStream::Buffer : public std::streambuf {
+        public:
+            Buffer(std::string const& filename) : input(gzipChunkSize), output(gzipChunkSize), finished(false) {
+                file.open(filename, std::ios::out | std::ios::binary);
+                STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+                stream = {};
+                // Adding 16 to the window size lets zlib write the gzip header.
+                STORM_LOG_THROW(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK, storm::exceptions::FileIoException, "Could not initialize the compression.");
+                setp(input.data(), input.data() + input.size());
+            }
+
+            ~Buffer() {
+                deflateEnd(&stream);
+            }
+
+            void finish() {
+                if (!finished) {
+                    compress(pbase(), pptr() - pbase(), Z_FINISH);
+                    setp(input.data(), input.data() + input.size());
+                    finished = true;
+                    file.close();
+                    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Error while writing the compressed file.");
+                }
+            }
+
+        protected:
+            int_type overflow(int_type character) override {
+                compress(pbase(), pptr() - pbase(), Z_NO_FLUSH);
+                setp(input.data(), input.data() + input.size());
+                if (!traits_type::eq_int_type(character, traits_type::eof())) {
+                    *pptr() = traits_type::to_char_type(character);
+                    pbump(1);
+                }
+                return traits_type::not_eof(character);
+            }
+
+            std::streamsize xsputn(char const* data, std::streamsize size) override {
+                if (size <= epptr() - pptr()) {
+                    std::copy(data, data + size, pptr());
+                    pbump(static_cast<int>(size));
+                } else {
+                    // Large blocks are passed to zlib without copying them to the buffer.
+                    compress(pbase(), pptr() - pbase(), Z_NO_FLUSH);
+                    setp(input.data(), input.data() + input.size());
+                    compress(data, size, Z_NO_FLUSH);
+                }
+                return size;
+            }
+
+        private:
+            void compress(char const* data, uint64_t size, int flush) {
+                STORM_LOG_THROW(!finished, storm::exceptions::FileIoException, "Writing to a closed file.");
+                do {
+                    uInt chunk = static_cast<uInt>(std::min<uint64_t>(size, gzipChunkSize));
+                    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+                    stream.avail_in = chunk;
+                    data += chunk;
+                    size -= chunk;
+                    int chunkFlush = size == 0 ? flush : Z_NO_FLUSH;
+                    do {
+                        stream.next_out = reinterpret_cast<Bytef*>(output.data());
+                        stream.avail_out = output.size();
+                        int status = deflate(&stream, chunkFlush);
+                        STORM_LOG_THROW(status != Z_STREAM_ERROR, storm::exceptions::FileIoException, "Error while compressing the data.");
+                        file.write(output.data(), output.size() - stream.avail_out);
+                    } while (stream.avail_out == 0);
+                } while (size > 0);
+                STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Error while writing the compressed file.");
+            }
+
+            std::ofstream file;
+            z_stream stream;
+            std::vector<char> input;
+            std::vector<char> output;
+            bool finished;
+        };
+
+#else
+        class GzipInputFileStream::Buffer : public std::streambuf {
+        public:
+            Buffer(std::string const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Decompressing files requires zlib, but storm was built without it.");
+            }
+        };
+
+        class GzipOutputFileStream::Buffer : public std::streambuf {
+        public:
+            Buffer(std::string const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Compressing files requires zlib, but storm was built without it.");
+            }
+
+            void finish() {
+                // Intentionally left empty.
+            }
+        };
+#endif
+
+        GzipInputFileStream::GzipInputFileStream(std::string const& filename) : std::istream(nullptr), buffer(new Buffer(filename)) {
+            rdbuf(buffer.get());
+            // Let the errors of the buffer reach the caller instead of only setting the bad bit.
+            exceptions(std::ios::badbit);
+        }
+
+        GzipInputFileStream::~GzipInputFileStream() = default;
+
+        GzipOutputFileStream::GzipOutputFileStream(std::string const& filename) : std::ostream(nullptr), buffer(new Buffer(filename)) {
+            rdbuf(buffer.get());
+        }
+
+        GzipOutputFileStream::~GzipOutputFileStream() {
+            try {
+                close();
+            } catch (...) {
+                STORM_LOG_ERROR("Error while closing a compressed file.");
+            }
+        }
+
+        void GzipOutputFileStream::close() {
+            buffer->finish();
+        }
+
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Checks whether the given file name has the extension of gzip-compressed files (.gz).
+         */
+        bool isGzipFilename(std::string const& filename);
+
+        /*!
+         * Removes the extension of gzip-compressed files (.gz) from the given file name (if present).
+         */
+        std::string removeGzipExtension(std::string const& filename);
+
+        /*!
+         * Checks whether the given data starts with the magic bytes of the gzip format.
+         */
+        bool isGzipCompressed(char const* begin, char const* end);
+
+        /*!
+         * An input stream that reads a file in the gzip format and decompresses it on the fly, so only fixed-size
+         * buffers are kept in memory. Errors while reading or decompressing the file are thrown as exceptions.
+         */
+        class GzipInputFileStream : public std::istream {
+        public:
+            /*!
+             * Opens the given file for reading.
+             *
+             * @param filename Path and name of the file to be read from.
+             */
+            GzipInputFileStream(std::string const& filename);
+
+            ~GzipInputFileStream();
+
+        private:
+            class Buffer;
+            std::unique_ptr<Buffer> buffer;
+        };
+
+        /*!
+         * An output stream that compresses everything written to it in the gzip format and writes the result to a
+         * file. The data is compressed on the fly, so only a fixed-size buffer is kept in memory.
+         */
+        class GzipOutputFileStream : public std::ostream {
+        public:
+            /*!
+             * Opens the given file for writing.
+             *
+             * @param filename Path and name of the file to be written to.
+             */
+            GzipOutputFileStream(std::string const& filename);
+
+            ~GzipOutputFileStream();
+
+            /*!
+             * Compresses the remaining data and closes the file.
+             */
+            void close();
+
+        private:
+            class Buffer;
+            std::unique_ptr<Buffer> buffer;
+        };
+
+    }
+}
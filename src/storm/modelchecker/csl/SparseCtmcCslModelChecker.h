@@ -47,6 +47,12 @@ namespace storm {
              */
             std::vector<ValueType> computeAllTransientProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask);
 
+            /*!
+             * Computes the probabilities of the given time-bounded until formula for each of the given upper time bounds
+             * (instead of the upper bound of the formula) in a single pass.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& upperBounds);
+
             /*!
              * Computes the long run average (or: steady state) distribution over all states
              * Assumes a uniform distribution over initial states.
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <cmath>
+#include <numeric>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -10,6 +13,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/helper/KrylovExponentialHelper.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -17,14 +21,17 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/numerical.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
@@ -35,6 +42,161 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
             
+            namespace {
+                /*!
+                 * The norm in which a matrix does not increase the difference of two vectors it is multiplied with.
+                 */
+                enum class NonExpansiveNorm {
+                    Maximum, // all (absolute) row sums are at most one
+                    Sum, // all (absolute) column sums are at most one, e.g. for the transposed matrix of a distribution
+                    None
+                };
+                
+                /*!
+                 * Determines a norm in which the given matrix is non-expansive.
+                 */
+                template <typename ValueType>
+                NonExpansiveNorm getNonExpansiveNorm(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                    // Allow for rounding errors that occurred while uniformizing the matrix.
+                    ValueType const bound = storm::utility::one<ValueType>() + storm::utility::convertNumber<ValueType>(1e-12);
+                    bool rowSumsBounded = true;
+                    std::vector<ValueType> columnSums(matrix.getColumnCount(), storm::utility::zero<ValueType>());
+                    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                        ValueType rowSum = storm::utility::zero<ValueType>();
+                        for (auto const& entry : matrix.getRow(row)) {
+                            ValueType absoluteValue = storm::utility::abs<ValueType>(entry.getValue());
+                            rowSum += absoluteValue;
+                            columnSums[entry.getColumn()] += absoluteValue;
+                        }
+                        rowSumsBounded &= rowSum <= bound;
+                    }
+                    if (rowSumsBounded) {
+                        return NonExpansiveNorm::Maximum;
+                    }
+                    for (auto const& columnSum : columnSums) {
+                        if (columnSum > bound) {
+                            return NonExpansiveNorm::None;
+                        }
+                    }
+                    return NonExpansiveNorm::Sum;
+                }
+                
+                /*!
+                 * Adds the values weighted with the corresponding weight to each of the given results and retrieves the
+                 * difference between the values and the previous values in the given norm (the sum of the absolute
+                 * differences for NonExpansiveNorm::Sum and the largest absolute difference otherwise). The vectors are
+                 * split into blocks that are processed by the given number of threads.
+                 */
+                template <typename ValueType>
+                ValueType addWeightedValues(std::vector<std::pair<std::vector<ValueType>*, ValueType>> const& weightedResults, std::vector<ValueType> const& values, std::vector<ValueType> const& previousValues, uint64_t numberOfThreads, NonExpansiveNorm norm = NonExpansiveNorm::Maximum) {
+                    // The blocks are small enough to stay in the cache while they are added to all results.
+                    uint64_t const blockSize = 4096;
+                    uint64_t numberOfBlocks = std::max<uint64_t>(1, (values.size() + blockSize - 1) / blockSize);
+                    std::vector<ValueType> differences(numberOfBlocks, storm::utility::zero<ValueType>());
+                    auto processBlock = [&] (uint64_t block) {
+                        uint64_t begin = block * blockSize;
+                        uint64_t end = std::min<uint64_t>(values.size(), begin + blockSize);
+                        ValueType difference = storm::utility::zero<ValueType>();
+                        for (uint64_t index = begin; index < end; ++index) {
+                            ValueType currentDifference = storm::utility::abs<ValueType>(values[index] - previousValues[index]);
+                            if (norm == NonExpansiveNorm::Sum) {
+                                difference += currentDifference;
+                            } else {
+                                difference = currentDifference > difference ? currentDifference : difference;
+                            }
+                        }
+                        differences[block] = difference;
+                        for (auto const& weightedResult : weightedResults) {
+                            std::vector<ValueType>& result = *weightedResult.first;
+                            ValueType const& weight = weightedResult.second;
+                            for (uint64_t index = begin; index < end; ++index) {
+                                result[index] += weight * values[index];
+                            }
+                        }
+                    };
+                    if (numberOfBlocks == 1) {
+                        processBlock(0);
+                    } else {
+                        storm::utility::parallel::execute(numberOfThreads, numberOfBlocks, processBlock);
+                    }
+                    if (norm == NonExpansiveNorm::Sum) {
+                        return std::accumulate(differences.begin(), differences.end(), storm::utility::zero<ValueType>());
+                    }
+                    return *std::max_element(differences.begin(), differences.end());
+                }
+                
+                /*!
+                 * Computes the transient (or mixed poisson) probabilities for the given time bounds with a Krylov subspace
+                 * method. For this, the uniformization is undone, i.e. we consider the generator matrix Q = q * (P - I).
+                 * The vector that is added in each step (or the values to accumulate in the mixed case) are captured by an
+                 * additional absorbing state: exp(t * [Q, c; 0, 0]) * [x; 1] = [exp(t*Q)*x + int_0^t exp(s*Q)*c ds; 1].
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities>
+                std::vector<std::vector<ValueType>> computeTransientProbabilitiesWithKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+                    STORM_LOG_THROW(!useMixedPoissonProbabilities || addVector == nullptr, storm::exceptions::NotSupportedException, "Computing mixed poisson probabilities with an additional vector is not supported by the Krylov subspace method.");
+                    uint64_t numberOfStates = uniformizedMatrix.getRowCount();
+                    std::vector<ValueType> const* extraColumn = useMixedPoissonProbabilities ? &values : addVector;
+                    uint64_t dimension = extraColumn == nullptr ? numberOfStates : numberOfStates + 1;
+                    
+                    // Build the generator matrix.
+                    storm::storage::SparseMatrixBuilder<ValueType> builder(dimension, dimension, uniformizedMatrix.getEntryCount() + 2 * numberOfStates);
+                    for (uint64_t row = 0; row < numberOfStates; ++row) {
+                        bool diagonalInserted = false;
+                        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                            if (!diagonalInserted && entry.getColumn() >= row) {
+                                if (entry.getColumn() == row) {
+                                    builder.addNextValue(row, row, uniformizationRate * (entry.getValue() - storm::utility::one<ValueType>()));
+                                    diagonalInserted = true;
+                                    continue;
+                                }
+                                builder.addNextValue(row, row, -uniformizationRate);
+                                diagonalInserted = true;
+                            }
+                            builder.addNextValue(row, entry.getColumn(), uniformizationRate * entry.getValue());
+                        }
+                        if (!diagonalInserted) {
+                            builder.addNextValue(row, row, -uniformizationRate);
+                        }
+                        if (extraColumn != nullptr && !storm::utility::isZero((*extraColumn)[row])) {
+                            // In the non-mixed case, the vector is added once per uniformization step.
+                            builder.addNextValue(row, numberOfStates, useMixedPoissonProbabilities ? (*extraColumn)[row] : ValueType(uniformizationRate * (*extraColumn)[row]));
+                        }
+                    }
+                    storm::storage::SparseMatrix<ValueType> generatorMatrix = builder.build();
+                    
+                    std::vector<ValueType> currentValues;
+                    if (useMixedPoissonProbabilities) {
+                        currentValues.assign(dimension, storm::utility::zero<ValueType>());
+                    } else {
+                        currentValues = values;
+                        currentValues.resize(dimension, storm::utility::zero<ValueType>());
+                    }
+                    if (dimension > numberOfStates) {
+                        currentValues.back() = storm::utility::one<ValueType>();
+                    }
+                    
+                    // Treat the time bounds in ascending order so that each step continues from the previous one. The
+                    // errors of the steps add up, so the tolerated error is distributed over the largest time bound.
+                    std::vector<uint64_t> order(timeBounds.size());
+                    std::iota(order.begin(), order.end(), 0);
+                    std::sort(order.begin(), order.end(), [&timeBounds] (uint64_t first, uint64_t second) { return timeBounds[first] < timeBounds[second]; });
+                    ValueType maximalTimeBound = timeBounds.empty() ? storm::utility::zero<ValueType>() : timeBounds[order.back()];
+                    ValueType tolerance = storm::utility::isZero(maximalTimeBound) ? epsilon : ValueType(epsilon / maximalTimeBound);
+                    
+                    storm::solver::helper::KrylovExponentialHelper<ValueType> krylovHelper(generatorMatrix);
+                    std::vector<std::vector<ValueType>> results(timeBounds.size());
+                    ValueType currentTime = storm::utility::zero<ValueType>();
+                    ValueType error = storm::utility::zero<ValueType>();
+                    for (auto const& timeBoundIndex : order) {
+                        error += krylovHelper.computeExponentialTimesVector(env, timeBounds[timeBoundIndex] - currentTime, currentValues, tolerance);
+                        currentTime = timeBounds[timeBoundIndex];
+                        results[timeBoundIndex].assign(currentValues.begin(), currentValues.begin() + numberOfStates);
+                    }
+                    STORM_LOG_INFO("Computed transient probabilities with the Krylov subspace method with an estimated error of " << error << ".");
+                    return results;
+                }
+            }
+            
             template <typename ValueType>
             bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<ValueType> const& resultVector, storm::storage::BitVector const& relevantPositions) {
                 // Check if the check is necessary for the provided settings
@@ -258,6 +420,105 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<double> const& upperBounds) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<std::vector<ValueType>> results(upperBounds.size());
+                
+                // The infinite time bounds correspond to untimed reachability, which is computed only once.
+                std::vector<ValueType> finiteUpperBounds;
+                boost::optional<std::vector<ValueType>> untimedResult;
+                for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                    double const& upperBound = upperBounds[boundIndex];
+                    STORM_LOG_THROW(upperBound >= 0 && (std::isfinite(upperBound) || upperBound == storm::utility::infinity<double>()), storm::exceptions::InvalidArgumentException, "The time bound " << upperBound << " is not a non-negative number.");
+                    if (upperBound == storm::utility::infinity<double>()) {
+                        if (!untimedResult) {
+                            untimedResult = computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(goal), rateMatrix, backwardTransitions, exitRates, phiStates, psiStates, qualitative);
+                        }
+                        results[boundIndex] = untimedResult.get();
+                    } else {
+                        finiteUpperBounds.push_back(storm::utility::convertNumber<ValueType>(upperBounds[boundIndex]));
+                    }
+                }
+                if (finiteUpperBounds.empty()) {
+                    return results;
+                }
+                
+                // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+                
+                // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+                // further computations.
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNumberOfSetBits() << " states with probability greater 0.");
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                
+                // the positions within the result for which the precision needs to be checked
+                storm::storage::BitVector relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                    relevantValues &= statesWithProbabilityGreater0;
+                } else {
+                    relevantValues = statesWithProbabilityGreater0;
+                }
+                
+                std::vector<std::vector<ValueType>> finiteResults;
+                bool updateEpsilon;
+                do { // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+                    std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+                    finiteResults.assign(finiteUpperBounds.size(), initialResult);
+                    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+                        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                        ValueType uniformizationRate = 0;
+                        for (auto state : statesWithProbabilityGreater0NonPsi) {
+                            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                        }
+                        uniformizationRate *= 1.02;
+                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                        
+                        // Compute the uniformized matrix.
+                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                        
+                        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                        std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                        for (auto& element : b) {
+                            element /= uniformizationRate;
+                        }
+                        
+                        // Finally compute the transient probabilities for all time bounds in one pass.
+                        std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                        std::vector<std::vector<ValueType>> subresults = computeTransientProbabilities(env, uniformizedMatrix, &b, finiteUpperBounds, uniformizationRate, values, epsilon);
+                        for (uint64_t boundIndex = 0; boundIndex < finiteUpperBounds.size(); ++boundIndex) {
+                            storm::utility::vector::setVectorValues(finiteResults[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+                        }
+                    }
+                    
+                    // All time bounds are computed with the smallest truncation error that is required for one of them.
+                    updateEpsilon = false;
+                    for (auto const& result : finiteResults) {
+                        updateEpsilon |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues);
+                    }
+                } while (updateEpsilon);
+                
+                auto finiteResultIt = finiteResults.begin();
+                for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                    if (upperBounds[boundIndex] != storm::utility::infinity<double>()) {
+                        results[boundIndex] = std::move(*finiteResultIt);
+                        ++finiteResultIt;
+                    }
+                }
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
@@ -583,80 +844,143 @@ namespace storm {
 
             template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+                return std::move(computeTransientProbabilities<ValueType, useMixedPoissonProbabilities>(env, uniformizedMatrix, addVector, std::vector<ValueType>({timeBound}), uniformizationRate, std::move(values), epsilon).front());
+            }
+            
+            template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
                 STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
-                ValueType lambda = timeBound * uniformizationRate;
                 
-                // If no time can pass, the current values are the result.
-                if (storm::utility::isZero(lambda)) {
-                    return values;
+                if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+                    return computeTransientProbabilitiesWithKrylov<ValueType, useMixedPoissonProbabilities>(env, uniformizedMatrix, addVector, timeBounds, uniformizationRate, values, epsilon);
                 }
                 
-                // Use Fox-Glynn to get the truncation points and the weights.
-                storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
-                STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
-                // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+                // A small share of the truncation error is reserved for stopping the iterations once the values do not
+                // change anymore (see below).
+                ValueType steadyStateEpsilon = epsilon / storm::utility::convertNumber<ValueType>(100);
                 
-                // If the cumulative reward is to be computed, we need to adjust the weights.
-                if (useMixedPoissonProbabilities) {
-                    ValueType sum = storm::utility::zero<ValueType>();
+                // The weights and the result for each time bound.
+                struct TimeBoundData {
+                    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult;
+                    ValueType weightBeforeLeft;
+                    std::vector<ValueType> remainingWeights;
+                    std::vector<ValueType> result;
+                    bool done;
+                };
+                std::vector<TimeBoundData> timeBoundData(timeBounds.size());
+                uint64_t lastIteration = 0;
+                for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+                    TimeBoundData& data = timeBoundData[timeBoundIndex];
+                    ValueType lambda = timeBounds[timeBoundIndex] * uniformizationRate;
                     
-                    for (auto& element : foxGlynnResult.weights) {
-                        sum += element;
-                        element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
+                    // If no time can pass, the current values are the result.
+                    if (storm::utility::isZero(lambda)) {
+                        data.result = values;
+                        data.done = true;
+                        continue;
                     }
-                }
-                
-                STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
-                
-                // Initialize result.
-                std::vector<ValueType> result;
-                uint_fast64_t startingIteration = foxGlynnResult.left;
-                if (startingIteration == 0) {
-                    result = values;
-                    storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
-                    ++startingIteration;
-                } else {
+                    data.done = false;
+                    
+                    // Use Fox-Glynn to get the truncation points and the weights.
+                    data.foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon - steadyStateEpsilon);
+                    storm::utility::numerical::FoxGlynnResult<ValueType>& foxGlynnResult = data.foxGlynnResult;
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+                    lastIteration = std::max<uint64_t>(lastIteration, foxGlynnResult.right);
+                    
+                    // If the cumulative reward is to be computed, we need to adjust the weights.
                     if (useMixedPoissonProbabilities) {
-                        result = std::vector<ValueType>(values.size());
-                        std::function<ValueType (ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a) -> ValueType { return a / uniformizationRate; };
-                        storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-                    } else {
-                        result = std::vector<ValueType>(values.size());
+                        ValueType sum = storm::utility::zero<ValueType>();
+                        
+                        for (auto& element : foxGlynnResult.weights) {
+                            sum += element;
+                            element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
+                        }
                     }
+                    
+                    // The values obtained before the left truncation point are ignored for transient probabilities. For
+                    // mixed poisson probabilities, they are scaled with the total weight to make sure that they have the
+                    // same 'impact' on the total result as the values obtained between the left and right truncation point.
+                    // Note that we divide with the total weight afterwards. This is to improve numerical stability.
+                    data.weightBeforeLeft = useMixedPoissonProbabilities ? ValueType(foxGlynnResult.totalWeight / uniformizationRate) : storm::utility::zero<ValueType>();
+                    
+                    // The sum of the weights from the given index on.
+                    data.remainingWeights.assign(foxGlynnResult.weights.size() + 1, storm::utility::zero<ValueType>());
+                    for (uint64_t index = foxGlynnResult.weights.size(); index > 0; --index) {
+                        data.remainingWeights[index - 1] = data.remainingWeights[index] + foxGlynnResult.weights[index - 1];
+                    }
+                    
+                    // Initialize result.
+                    data.result = values;
+                    storm::utility::vector::scaleVectorInPlace(data.result, foxGlynnResult.left == 0 ? foxGlynnResult.weights.front() : data.weightBeforeLeft);
                 }
                 
+                STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                // For all indices up to the (largest) right truncation point, we need to perform the matrix-vector
+                // multiplication, scale and add the result for each time bound. If the uniformized matrix is
+                // (sub-)stochastic, the values of the next j iterations differ from the current values by at most j times
+                // the (maximal) difference of the last iteration. Once the error of using the current values for all
+                // remaining iterations of a time bound is below the reserved truncation error, we can therefore stop early.
+                // For the transposed matrix used to propagate distributions, the same holds for the sum of the differences.
+                NonExpansiveNorm norm = getNonExpansiveNorm(uniformizedMatrix);
+                STORM_LOG_INFO_COND(norm != NonExpansiveNorm::None, "Detection of steady states is disabled as the uniformized matrix is not non-expansive.");
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-                if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-                } else if (useMixedPoissonProbabilities) {
-                    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
-                    
-                    // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-                    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-                        multiplier->multiply(env, values, nullptr, values);
-                        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-                    }
-                    // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
-                    // between the left and right truncation point, we scale them here with the total sum of the weights.
-                    // Note that we divide with this value afterwards. This is to improve numerical stability.
-                    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
-                }
-                
-                // For the indices that fall in between the truncation points, we need to perform the matrix-vector
-                // multiplication, scale and add the result.
-                ValueType weight = 0;
-                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
-                for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-                    multiplier->multiply(env, values, addVector, values);
+                uint64_t numberOfThreads = env.solver().multiplier().getNumberOfThreads();
+                std::vector<ValueType> nextValues(values.size());
+                std::vector<std::pair<std::vector<ValueType>*, ValueType>> weightedResults;
+                for (uint64_t index = 1; index <= lastIteration; ++index) {
+                    multiplier->multiply(env, values, addVector, nextValues);
+                    weightedResults.clear();
+                    for (auto& data : timeBoundData) {
+                        if (!data.done) {
+                            ValueType const& weight = index < data.foxGlynnResult.left ? data.weightBeforeLeft : data.foxGlynnResult.weights[index - data.foxGlynnResult.left];
+                            if (!storm::utility::isZero(weight)) {
+                                weightedResults.emplace_back(&data.result, weight);
+                            }
+                        }
+                    }
+                    ValueType difference = addWeightedValues(weightedResults, nextValues, values, numberOfThreads, norm);
+                    std::swap(values, nextValues);
                     
-                    weight = foxGlynnResult.weights[index - foxGlynnResult.left];
-                    storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                    bool allDone = true;
+                    for (auto& data : timeBoundData) {
+                        if (data.done) {
+                            continue;
+                        }
+                        storm::utility::numerical::FoxGlynnResult<ValueType> const& foxGlynnResult = data.foxGlynnResult;
+                        if (index >= foxGlynnResult.right) {
+                            // All weights of this time bound have been applied.
+                            data.done = true;
+                            continue;
+                        }
+                        ValueType remainingWeight = data.remainingWeights[std::max<uint64_t>(index + 1, foxGlynnResult.left) - foxGlynnResult.left];
+                        if (index + 1 < foxGlynnResult.left) {
+                            remainingWeight += storm::utility::convertNumber<ValueType>(foxGlynnResult.left - index - 1) * data.weightBeforeLeft;
+                        }
+                        if (norm != NonExpansiveNorm::None && difference * storm::utility::convertNumber<ValueType>(foxGlynnResult.right - index) * remainingWeight <= steadyStateEpsilon * foxGlynnResult.totalWeight) {
+                            STORM_LOG_INFO("Values stabilized after " << index << " of " << foxGlynnResult.right << " iterations.");
+                            addWeightedValues<ValueType>({{&data.result, remainingWeight}}, values, values, numberOfThreads);
+                            data.done = true;
+                        } else {
+                            allDone = false;
+                        }
+                    }
+                    if (allDone) {
+                        break;
+                    }
                 }
                 
-                // Finally, divide the result by the total weight
-                storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                return result;
+                // Finally, divide the results by the total weight
+                std::vector<std::vector<ValueType>> results;
+                results.reserve(timeBoundData.size());
+                for (auto& data : timeBoundData) {
+                    if (!data.foxGlynnResult.weights.empty()) {
+                        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(data.result, storm::utility::one<ValueType>() / data.foxGlynnResult.totalWeight);
+                    }
+                    results.push_back(std::move(data.result));
+                }
+                return results;
             }
             
             template <typename ValueType>
@@ -690,6 +1014,8 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
             
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
             template std::vector<double> SparseCtmcCslHelper::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -711,10 +1037,13 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
@@ -2,6 +2,7 @@
 
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
@@ -24,6 +25,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -132,6 +134,14 @@ namespace storm {
                     std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
                     std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
                     
+                    // The index of each maybe state among the Markovian or probabilistic maybe states, respectively.
+                    std::vector<uint64_t> maybeStatesLocalIndices(maybeStates.getNumberOfSetBits());
+                    uint64_t numberOfMarkovianMaybeStates = 0;
+                    for (uint64_t index = 0; index < maybeStatesLocalIndices.size(); ++index) {
+                        maybeStatesLocalIndices[index] = markovianStatesModMaybeStates.get(index) ? numberOfMarkovianMaybeStates++ : index - numberOfMarkovianMaybeStates;
+                    }
+                    uint64_t numberOfThreads = env.solver().multiplier().getNumberOfThreads();
+                    
                     // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
                     storm::utility::ProgressMeasurement progressIterations("iterations");
                     uint64_t iteration = 0;
@@ -203,29 +213,34 @@ namespace storm {
                                 }
                                 
                                 // Compute the values at probabilistic states.
-                                probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
-                                for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                                    eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
-                                }
                                 if (solver) {
+                                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
+                                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                                    }
                                     solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
                                 } else {
-                                    storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues, probabilisticToProbabilisticTransitions.getRowGroupIndices());
+                                    // Without transitions between probabilistic states, the right-hand side only consists of the
+                                    // values for reaching psi states, so the multiplication and the reduction can be done at once.
+                                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
+                                        eqSysRhs[oneStepProb.first] = oneStepProb.second * targetValue;
+                                    }
+                                    probabilisticToMarkovianMultiplier->multiplyAndReduce(env, dir, nextMarkovianStateValues, &eqSysRhs, nextProbabilisticStateValues);
                                 }
                                 
                                 // Create the new values for the maybestates
-                                // Fuse the results together
-                                storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                                storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                                // Fuse the results together and add the scaled values to the actual result vector
+                                std::vector<ValueType>* weightedResult = nullptr;
+                                ValueType weight = storm::utility::zero<ValueType>();
                                 if (!computeLowerBound) {
-                                    // Add the scaled values to the actual result vector
                                     uint64_t i = N-1-k;
                                     if (i >= foxGlynnResult.left) {
                                         assert(i <= foxGlynnResult.right); // has to hold since this iteration is considered relevant.
-                                        ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                                        storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                                        weightedResult = &maybeStatesValuesUpper;
+                                        weight = foxGlynnResult.weights[i - foxGlynnResult.left];
                                     }
                                 }
+                                setMaybeStatesValues(maybeStatesValues, markovianStatesModMaybeStates, maybeStatesLocalIndices, nextMarkovianStateValues, nextProbabilisticStateValues, weightedResult, weight, numberOfThreads);
 
                                 progressSteps.updateProgress(N-k);
                                 if (storm::utility::resources::isTerminate()) {
@@ -313,6 +328,33 @@ namespace storm {
 
             private:
                 
+                /*!
+                 * Writes the values of the Markovian and probabilistic maybe states into the vector of all maybe states. If
+                 * a weighted result is given, the values scaled with the weight are added to it in the same pass. The maybe
+                 * states are split into blocks that are processed by the given number of threads.
+                 */
+                void setMaybeStatesValues(std::vector<ValueType>& maybeStatesValues, storm::storage::BitVector const& markovianStatesModMaybeStates, std::vector<uint64_t> const& maybeStatesLocalIndices, std::vector<ValueType> const& markovianValues, std::vector<ValueType> const& probabilisticValues, std::vector<ValueType>* weightedResult, ValueType const& weight, uint64_t numberOfThreads) const {
+                    uint64_t const blockSize = 4096;
+                    uint64_t numberOfBlocks = (maybeStatesValues.size() + blockSize - 1) / blockSize;
+                    auto processBlock = [&] (uint64_t block) {
+                        uint64_t end = std::min<uint64_t>(maybeStatesValues.size(), (block + 1) * blockSize);
+                        for (uint64_t index = block * blockSize; index < end; ++index) {
+                            ValueType const& value = markovianStatesModMaybeStates.get(index) ? markovianValues[maybeStatesLocalIndices[index]] : probabilisticValues[maybeStatesLocalIndices[index]];
+                            maybeStatesValues[index] = value;
+                            if (weightedResult) {
+                                (*weightedResult)[index] += weight * value;
+                            }
+                        }
+                    };
+                    if (numberOfThreads > 1 && numberOfBlocks > 1) {
+                        storm::utility::parallel::execute(numberOfThreads, numberOfBlocks, processBlock);
+                    } else {
+                        for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+                            processBlock(block);
+                        }
+                    }
+                }
+                
                 bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper, boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
                     STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
                     if (!relative) {
@@ -531,6 +573,25 @@ namespace storm {
                 auto solverEnv = env;
                 solverEnv.solver().setForceExact(true);
                 auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, aProbabilistic);
+                
+                // Create multipliers for the (digitized) steps. These also add the fixed right-hand sides.
+                auto aMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, aMarkovian);
+                std::unique_ptr<storm::solver::Multiplier<ValueType>> aMarkovianToProbabilisticMultiplier, aProbabilisticToMarkovianMultiplier;
+                if (existProbabilisticStates) {
+                    aMarkovianToProbabilisticMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, aMarkovianToProbabilistic);
+                    aProbabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, aProbabilisticToMarkovian);
+                }
+                
+                // Computes the values of the probabilistic states. If there are no transitions between probabilistic
+                // states, the multiplication and the reduction can be done at once.
+                auto computeProbabilisticValues = [&] () {
+                    if (solver) {
+                        aProbabilisticToMarkovianMultiplier->multiply(env, markovianNonGoalValues, &bProbabilisticFixed, bProbabilistic);
+                        solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
+                    } else {
+                        aProbabilisticToMarkovianMultiplier->multiplyAndReduce(env, dir, markovianNonGoalValues, &bProbabilisticFixed, probabilisticNonGoalValues);
+                    }
+                };
 
                 // Perform the actual value iteration
                 // * loop until the step bound has been reached
@@ -538,32 +599,20 @@ namespace storm {
                 // *    perform value iteration using A_PSwG, v_PS and the vector b where b = (A * 1_G)|PS + A_PStoMS * v_MS
                 //      and 1_G being the characteristic vector for all goal states.
                 // *    perform one timed-step using v_MS := A_MSwG * v_MS + A_MStoPS * v_PS + (A * 1_G)|MS
+                // Only the values of the current and the next step are kept.
                 std::vector<ValueType> markovianNonGoalValuesSwap(markovianNonGoalValues);
                 for (uint64_t currentStep = 0; currentStep < numberOfSteps; ++currentStep) {
                     if (existProbabilisticStates) {
-                        // Start by (re-)computing bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
-                        aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-                        storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-                        
-                        // Now perform the inner value iteration for probabilistic states.
-                        if (solver) {
-                            solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
-                        } else {
-                            storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
-                        }
+                        // Start by computing the values of the probabilistic states with the right-hand side
+                        // bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
+                        computeProbabilisticValues();
                         
                         // (Re-)compute bMarkovian = bMarkovianFixed + aMarkovianToProbabilistic * vProbabilistic.
-                        aMarkovianToProbabilistic.multiplyWithVector(probabilisticNonGoalValues, bMarkovian);
-                        storm::utility::vector::addVectors(bMarkovian, bMarkovianFixed, bMarkovian);
+                        aMarkovianToProbabilisticMultiplier->multiply(env, probabilisticNonGoalValues, &bMarkovianFixed, bMarkovian);
                     }
                     
-                    aMarkovian.multiplyWithVector(markovianNonGoalValues, markovianNonGoalValuesSwap);
+                    aMarkovianMultiplier->multiply(env, markovianNonGoalValues, existProbabilisticStates ? &bMarkovian : &bMarkovianFixed, markovianNonGoalValuesSwap);
                     std::swap(markovianNonGoalValues, markovianNonGoalValuesSwap);
-                    if (existProbabilisticStates) {
-                        storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovian, markovianNonGoalValues);
-                    } else {
-                        storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovianFixed, markovianNonGoalValues);
-                    }
                     if (storm::utility::resources::isTerminate()) {
                         break;
                     }
@@ -571,13 +620,7 @@ namespace storm {
                 
                 if (existProbabilisticStates) {
                     // After the loop, perform one more step of the value iteration for PS states.
-                    aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-                    storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
-                    } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
-                    }
+                    computeProbabilisticValues();
                 }
             }
             
@@ -62,14 +62,14 @@ namespace storm {
                     // Create the vector with which to multiply.
                     std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
-                    // Perform the matrix vector multiplication
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+                    // Perform the matrix vector multiplication. The submatrix is handed over to the multiplier as it is not
+                    // needed otherwise.
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, std::move(submatrix));
                     if (lowerBound == 0) {
                         multiplier->repeatedMultiply(env, subresult, &b, upperBound);
                     } else {
                         multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
-                        submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
-                        multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+                        multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true));
                         b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
                         multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
                     }
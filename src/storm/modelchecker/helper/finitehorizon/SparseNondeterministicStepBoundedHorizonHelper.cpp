@@ -59,13 +59,13 @@ namespace storm {
                     // Create the vector with which to multiply.
                     std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+                    // The submatrix is handed over to the multiplier as it is not needed otherwise.
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, std::move(submatrix));
                     if (lowerBound == 0) {
                         multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
                     } else {
                         multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
-                        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
-                        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+                        multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false));
                         b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
                         multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
                     }
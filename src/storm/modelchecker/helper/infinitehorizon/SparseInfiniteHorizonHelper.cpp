@@ -19,9 +19,11 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -142,10 +144,41 @@ namespace storm {
                 progress.startNewMeasurement(0);
                 STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
                 std::vector<ValueType> componentLraValues;
-                componentLraValues.reserve(_longRunComponentDecomposition->size());
-                for (auto const& c : *_longRunComponentDecomposition) {
-                    componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-                    progress.updateProgress(componentLraValues.size());
+                uint64_t numberOfThreads = env.solver().multiplier().getNumberOfThreads();
+                if (numberOfThreads > 1 && _longRunComponentDecomposition->size() > 1 && canComputeComponentsConcurrently(underlyingSolverEnvironment)) {
+                    // The components are independent. Consecutive small components are batched to reduce the scheduling overhead.
+                    uint64_t const minimalBatchSize = 1000;
+                    std::vector<uint64_t> batchBegins = {0};
+                    uint64_t currentBatchSize = 0;
+                    for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+                        if (currentBatchSize >= minimalBatchSize) {
+                            batchBegins.push_back(componentIndex);
+                            currentBatchSize = 0;
+                        }
+                        currentBatchSize += (*_longRunComponentDecomposition)[componentIndex].size();
+                    }
+                    batchBegins.push_back(_longRunComponentDecomposition->size());
+                    
+                    componentLraValues.resize(_longRunComponentDecomposition->size());
+                    std::mutex progressMutex;
+                    uint64_t numberOfProcessedComponents = 0;
+                    storm::utility::parallel::execute(numberOfThreads, batchBegins.size() - 1, [&] (uint64_t batch) {
+                        // The threads are already busy with other components, so the solvers for a single component run sequentially.
+                        Environment batchEnvironment = underlyingSolverEnvironment;
+                        batchEnvironment.solver().multiplier().setNumberOfThreads(1);
+                        for (uint64_t componentIndex = batchBegins[batch]; componentIndex < batchBegins[batch + 1]; ++componentIndex) {
+                            componentLraValues[componentIndex] = computeLraForComponent(batchEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+                        }
+                        std::lock_guard<std::mutex> lock(progressMutex);
+                        numberOfProcessedComponents += batchBegins[batch + 1] - batchBegins[batch];
+                        progress.updateProgress(numberOfProcessedComponents);
+                    });
+                } else {
+                    componentLraValues.reserve(_longRunComponentDecomposition->size());
+                    for (auto const& c : *_longRunComponentDecomposition) {
+                        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+                        progress.updateProgress(componentLraValues.size());
+                    }
                 }
                 
                 // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -159,6 +192,12 @@ namespace storm {
                 return _exitRates != nullptr;
             }
             
+            template <typename ValueType, bool Nondeterministic>
+            bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::canComputeComponentsConcurrently(Environment const&) const {
+                // Operations on the number types of carl are not thread-safe.
+                return std::is_same<ValueType, double>::value;
+            }
+            
             template <typename ValueType, bool Nondeterministic>
             void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::createBackwardTransitions() {
                 if (this->_backwardTransitions == nullptr) {
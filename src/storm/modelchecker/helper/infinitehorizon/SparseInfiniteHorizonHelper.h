@@ -110,6 +110,12 @@ namespace storm {
                  */
                 bool isContinuousTime() const;
                 
+                /*!
+                 * @return true iff the long run averages of different components can be computed concurrently with the given environment.
+                 * @note Implementations need to make sure that computeLraForComponent does not modify shared data in this case.
+                 */
+                virtual bool canComputeComponentsConcurrently(Environment const& env) const;
+                
                 /*!
                  * @post _backwardTransitions points to backward transitions.
                  */
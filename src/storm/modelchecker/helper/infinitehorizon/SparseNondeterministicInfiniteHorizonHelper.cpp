@@ -71,12 +71,14 @@ namespace storm {
             ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter, storm::storage::MaximalEndComponent const& component) {
                 // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
                 
-                // Allocate memory for the nondeterministic choices.
+                // Allocate memory for the nondeterministic choices (unless this has already been done, e.g. if several MECs are processed concurrently).
                 if (this->isProduceSchedulerSet()) {
                     if (!this->_producedOptimalChoices.is_initialized()) {
                         this->_producedOptimalChoices.emplace();
                     }
-                    this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    }
                 }
                 
                 auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -85,14 +87,7 @@ namespace storm {
                 }
                 
                 // Solve nontrivial MEC with the method specified in the settings
-                storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-                if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::LinearProgramming) {
-                    STORM_LOG_INFO("Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly specify a different LRA method.");
-                    method = storm::solver::LraMethod::LinearProgramming;
-                } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-                    STORM_LOG_INFO("Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly specify a different LRA method.");
-                    method = storm::solver::LraMethod::ValueIteration;
-                }
+                storm::solver::LraMethod method = getMecLraMethod(env);
                 STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration, "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
                 if (method == storm::solver::LraMethod::LinearProgramming) {
                     return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -103,6 +98,25 @@ namespace storm {
                 }
             }
             
+            template <typename ValueType>
+            storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getMecLraMethod(Environment const& env) const {
+                storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+                if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::LinearProgramming) {
+                    STORM_LOG_INFO("Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly specify a different LRA method.");
+                    method = storm::solver::LraMethod::LinearProgramming;
+                } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+                    STORM_LOG_INFO("Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly specify a different LRA method.");
+                    method = storm::solver::LraMethod::ValueIteration;
+                }
+                return method;
+            }
+            
+            template <typename ValueType>
+            bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::canComputeComponentsConcurrently(Environment const& env) const {
+                // The LP solvers are not necessarily thread-safe.
+                return SparseInfiniteHorizonHelper<ValueType, true>::canComputeComponentsConcurrently(env) && getMecLraMethod(env) == storm::solver::LraMethod::ValueIteration;
+            }
+            
             template <typename ValueType>
             std::pair<bool, ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForTrivialMec(Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter, storm::storage::MaximalEndComponent const& component) {
                 
@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 
 namespace storm {
@@ -64,6 +65,13 @@ namespace storm {
                 
                 virtual void createDecomposition() override;
                 
+                virtual bool canComputeComponentsConcurrently(Environment const& env) const override;
+                
+                /*!
+                 * @return the method that is used to solve nontrivial MECs with the given environment.
+                 */
+                storm::solver::LraMethod getMecLraMethod(Environment const& env) const;
+                
                 std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter,  ValueGetter const& actionValuesGetter, storm::storage::MaximalEndComponent const& mec);
                 
                 /*!
@@ -252,7 +252,8 @@ namespace storm {
                     }
                     
                     // Formulate for each objective the linear equation system induced by the performed choices
-                    assert(cachedData.bLinEq.size() == choices.size());
+                    boost::optional<ValueType> lowerBound, upperBound;
+                    bool allObjectivesHaveLowerBound = true, allObjectivesHaveUpperBound = true;
                     for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                         auto const& obj = this->objectives[objIndex];
                         std::vector<ValueType> const& objectiveReward = epochModel.objectiveRewards[objIndex];
@@ -261,8 +262,10 @@ namespace storm {
                         auto stepChoiceIt = epochModel.stepChoices.begin();
                         auto stepSolutionIt = epochModel.stepSolutions.begin();
                         std::vector<ValueType>& x = cachedData.xLinEq[objIndex];
+                        std::vector<ValueType>& b = cachedData.bLinEq[objIndex];
+                        assert(b.size() == choices.size());
                         auto xIt = x.begin();
-                        for (auto& b_i : cachedData.bLinEq) {
+                        for (auto& b_i : b) {
                             uint64_t i = *rowGroupIndexIt + *choiceIt;
                             if (epochModel.objectiveRewardFilter[objIndex].get(i)) {
                                 b_i = objectiveReward[i];
@@ -288,18 +291,33 @@ namespace storm {
                             ++choiceIt;
                         }
                         assert(x.size() == choices.size());
-                        auto req = cachedData.linEqSolver->getRequirements(env);
-                        cachedData.linEqSolver->clearBounds();
-                        if (obj.lowerResultBound) {
-                            req.clearLowerBounds();
-                            cachedData.linEqSolver->setLowerBound(*obj.lowerResultBound);
+                        
+                        // The systems of all objectives are solved at once, so the bounds need to hold for each of them.
+                        if (obj.lowerResultBound && allObjectivesHaveLowerBound) {
+                            lowerBound = lowerBound ? storm::utility::min<ValueType>(*lowerBound, *obj.lowerResultBound) : *obj.lowerResultBound;
+                        } else {
+                            allObjectivesHaveLowerBound = false;
                         }
-                        if (obj.upperResultBound) {
-                            cachedData.linEqSolver->setUpperBound(*obj.upperResultBound);
-                            req.clearUpperBounds();
+                        if (obj.upperResultBound && allObjectivesHaveUpperBound) {
+                            upperBound = upperBound ? storm::utility::max<ValueType>(*upperBound, *obj.upperResultBound) : *obj.upperResultBound;
+                        } else {
+                            allObjectivesHaveUpperBound = false;
                         }
-                        STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-                        cachedData.linEqSolver->solveEquations(env, x, cachedData.bLinEq);
+                    }
+                    
+                    auto req = cachedData.linEqSolver->getRequirements(env);
+                    cachedData.linEqSolver->clearBounds();
+                    if (allObjectivesHaveLowerBound && lowerBound) {
+                        req.clearLowerBounds();
+                        cachedData.linEqSolver->setLowerBound(*lowerBound);
+                    }
+                    if (allObjectivesHaveUpperBound && upperBound) {
+                        cachedData.linEqSolver->setUpperBound(*upperBound);
+                        req.clearUpperBounds();
+                    }
+                    STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+                    cachedData.linEqSolver->solveEquations(env, cachedData.xLinEq, cachedData.bLinEq);
+                    for (auto const& x : cachedData.xLinEq) {
                         auto resultIt = result.begin();
                         for (auto state : epochModel.epochInStates) {
                             resultIt->push_back(x[state]);
@@ -344,7 +362,10 @@ namespace storm {
                     cachedData.schedulerChoices.reserve(epochModel.epochMatrix.getRowGroupCount());
                     
                     // Update data for linear equation solving
-                    cachedData.bLinEq.resize(epochModel.epochMatrix.getRowGroupCount());
+                    cachedData.bLinEq.resize(this->objectives.size());
+                    for (auto& b_o : cachedData.bLinEq) {
+                        b_o.resize(epochModel.epochMatrix.getRowGroupCount());
+                    }
                     cachedData.xLinEq.resize(this->objectives.size());
                     for (auto& x_o : cachedData.xLinEq) {
                         x_o.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
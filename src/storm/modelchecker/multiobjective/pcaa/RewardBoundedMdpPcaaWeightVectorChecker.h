@@ -54,7 +54,8 @@ namespace storm {
                     
                     std::vector<uint64_t> schedulerChoices;
                     
-                    std::vector<ValueType> bLinEq;
+                    // The right-hand sides and solutions of the linear equation systems of each objective.
+                    std::vector<std::vector<ValueType>> bLinEq;
                     std::vector<std::vector<ValueType>> xLinEq;
                     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
                     
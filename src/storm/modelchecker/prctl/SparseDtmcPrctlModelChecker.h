@@ -3,6 +3,7 @@
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/modelchecker/prctl/helper/SparseModelCheckerCache.h"
 
 namespace storm {
     namespace modelchecker {
@@ -13,7 +14,13 @@ namespace storm {
             typedef typename SparseDtmcModelType::ValueType ValueType;
             typedef typename SparseDtmcModelType::RewardModelType RewardModelType;
                         
-            explicit SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model);
+            /*!
+             * Creates a model checker for the given model.
+             *
+             * @param cache The data that is reused across queries. If the same cache is given to all model checkers of the
+             * model, the data is reused across them. If none is given, the data is only reused by this model checker.
+             */
+            explicit SparseDtmcPrctlModelChecker(SparseDtmcModelType const& model, std::shared_ptr<helper::SparseModelCheckerCache<ValueType>> const& cache = nullptr);
             
             /*!
              * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
@@ -53,6 +60,14 @@ namespace storm {
              */
             std::unique_ptr<CheckResult> computeExpectedVisitingTimes(Environment const& env);
 
+        private:
+            /*!
+             * Retrieves the cache for until probabilities with the size given by the environment (or null if the cache is disabled).
+             */
+            helper::SparseUntilAnalysisCache<ValueType>* getUntilAnalysisCache(Environment const& env);
+            
+            // The graph analysis results and equation systems of previous queries.
+            std::shared_ptr<helper::SparseModelCheckerCache<ValueType>> cache;
         };
         
     } // namespace modelchecker
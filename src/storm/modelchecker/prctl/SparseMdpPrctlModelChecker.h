@@ -2,6 +2,7 @@
 #define STORM_MODELCHECKER_SPARSEMDPPRCTLMODELCHECKER_H_
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseModelCheckerCache.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 
@@ -17,7 +18,13 @@ namespace storm {
             typedef typename SparseMdpModelType::ValueType ValueType;
             typedef typename SparseMdpModelType::RewardModelType RewardModelType;
             
-            explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model);
+            /*!
+             * Creates a model checker for the given model.
+             *
+             * @param cache The data that is reused across queries. If the same cache is given to all model checkers of the
+             * model, the data is reused across them. If none is given, the data is only reused by this model checker.
+             */
+            explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model, std::shared_ptr<helper::SparseModelCheckerCache<ValueType>> const& cache = nullptr);
             
             /*!
              * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
@@ -44,6 +51,24 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env, CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
             
+            /*!
+             * Retrieves the workspace that holds the equation system (and solver) of the most recent query.
+             */
+            helper::SparseMdpSolverWorkspace<ValueType> const& getSolverWorkspace() const;
+            
+        private:
+            /*!
+             * Retrieves the cache for until probabilities with the size given by the environment (or null if the cache is disabled).
+             */
+            helper::SparseUntilAnalysisCache<ValueType>* getUntilAnalysisCache(Environment const& env);
+            
+            /*!
+             * Retrieves the workspace whose equation system (and solver) is reused by subsequent queries with the same maybe states.
+             */
+            helper::SparseMdpSolverWorkspace<ValueType>* getWorkspace();
+            
+            // The graph analysis results and equation systems of previous queries.
+            std::shared_ptr<helper::SparseModelCheckerCache<ValueType>> cache;
         };
     } // namespace modelchecker
 } // namespace storm
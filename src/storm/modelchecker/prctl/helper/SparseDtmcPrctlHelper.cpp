@@ -1,4 +1,5 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/SparseUntilAnalysisCache.h"
 
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
@@ -137,7 +138,7 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint, SparseUntilAnalysisCache<ValueType>* analysisCache) {
                 
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 
@@ -145,6 +146,9 @@ namespace storm {
                 // that is strictly between 0 and 1) and the states that satisfy the formula with probability 1.
                 storm::storage::BitVector maybeStates, statesWithProbability1;
                 
+                // If a cache is given, the results of previous queries with the same phi and psi states are used.
+                std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry> cacheEntry;
+                
                 if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
                     maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
                     
@@ -163,11 +167,24 @@ namespace storm {
 
                     STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits() << " states remaining).");
                 } else {
-                    // Get all states that have probability 0 and 1 of satisfying the until-formula.
-                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
-                    storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
-                    statesWithProbability1 = std::move(statesWithProbability01.second);
-                    maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+                    storm::storage::BitVector statesWithProbability0;
+                    if (analysisCache) {
+                        cacheEntry = analysisCache->find(phiStates, psiStates, boost::none);
+                    }
+                    if (cacheEntry) {
+                        statesWithProbability0 = cacheEntry->statesWithProbability0;
+                        statesWithProbability1 = cacheEntry->statesWithProbability1;
+                        maybeStates = cacheEntry->maybeStates;
+                    } else {
+                        // Get all states that have probability 0 and 1 of satisfying the until-formula.
+                        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                        statesWithProbability0 = std::move(statesWithProbability01.first);
+                        statesWithProbability1 = std::move(statesWithProbability01.second);
+                        maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+                        if (analysisCache) {
+                            cacheEntry = analysisCache->insert(phiStates, psiStates, boost::none, statesWithProbability0, statesWithProbability1);
+                        }
+                    }
 
                     STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1, " << statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << maybeStates.getNumberOfSetBits() << " states remaining).");
 
@@ -192,11 +209,19 @@ namespace storm {
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
                         // We can eliminate the rows and columns from the original transition probability matrix.
-                        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
-                        if (convertToEquationSystem) {
-                            // Converting the matrix from the fixpoint notation to the form needed for the equation
-                            // system. That is, we go from x = A*x + b to (I-A)x = b.
-                            submatrix.convertToEquationSystem();
+                        // If the matrix is cached, it is not extracted again.
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> cachedSubmatrix;
+                        if (cacheEntry) {
+                            cachedSubmatrix = convertToEquationSystem ? cacheEntry->equationSystemMatrix : cacheEntry->maybeStateSubmatrix;
+                        }
+                        storm::storage::SparseMatrix<ValueType> submatrix;
+                        if (!cachedSubmatrix) {
+                            submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
+                            if (convertToEquationSystem) {
+                                // Converting the matrix from the fixpoint notation to the form needed for the equation
+                                // system. That is, we go from x = A*x + b to (I-A)x = b.
+                                submatrix.convertToEquationSystem();
+                            }
                         }
                         
                         // Initialize the x vector with the hint (if available) or with 0.5 for each element.
@@ -211,11 +236,26 @@ namespace storm {
 
                         // Prepare the right-hand side of the equation system. For entry i this corresponds to
                         // the accumulated probability of going from state i to some 'yes' state.
-                        std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1);
+                        std::vector<ValueType> b;
+                        if (cacheEntry && cacheEntry->rightHandSide) {
+                            b = cacheEntry->rightHandSide.get();
+                        } else {
+                            b = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1);
+                        }
+                        
+                        // Store the equation system for subsequent queries.
+                        if (cacheEntry && (!cachedSubmatrix || !cacheEntry->rightHandSide)) {
+                            if (!cachedSubmatrix) {
+                                cachedSubmatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(submatrix));
+                                (convertToEquationSystem ? cacheEntry->equationSystemMatrix : cacheEntry->maybeStateSubmatrix) = cachedSubmatrix;
+                            }
+                            cacheEntry->rightHandSide = b;
+                            analysisCache->update(cacheEntry);
+                        }
                         
                         // Now solve the created system of linear equations.
                         goal.restrictRelevantValues(maybeStates);
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = cachedSubmatrix ? storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, *cachedSubmatrix) : storm::solver::configureLinearEquationSolver(env, std::move(goal), linearEquationSolverFactory, std::move(submatrix));
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                         solver->solveEquations(env, x, b);
                         
@@ -287,9 +327,9 @@ namespace storm {
             }
 
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, SparseUntilAnalysisCache<ValueType>* analysisCache) {
                 goal.oneMinus();
-                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative);
+                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative, ModelCheckerHint(), analysisCache);
                 for (auto& entry : result) {
                     entry = storm::utility::one<ValueType>() - entry;
                 }
@@ -330,7 +330,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            void SparseMdpEndComponentInformation<ValueType>::setValues(std::vector<ValueType>& result, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& fromResult) {
+            void SparseMdpEndComponentInformation<ValueType>::setValues(std::vector<ValueType>& result, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& fromResult) const {
                 // The following assumes that row groups associated to EC states are at the very end.
                 auto notInEcResultIt = fromResult.begin();
                 for (auto state : maybeStates) {
@@ -7,6 +7,8 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverWorkspace.h"
+#include "storm/modelchecker/prctl/helper/SparseUntilAnalysisCache.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -375,7 +377,12 @@ namespace storm {
             
             template<typename ValueType>
             struct MaybeStateResult {
-                MaybeStateResult(std::vector<ValueType>&& values) : values(std::move(values)) {
+                MaybeStateResult(std::vector<ValueType>&& values) : values(std::move(values)), externalValues(nullptr) {
+                    // Intentionally left empty.
+                }
+                
+                // Creates a result whose values are owned elsewhere (e.g. by a solver workspace).
+                MaybeStateResult(std::vector<ValueType> const* externalValues) : externalValues(externalValues) {
                     // Intentionally left empty.
                 }
                 
@@ -388,52 +395,72 @@ namespace storm {
                 }
                 
                 std::vector<ValueType> const& getValues() const {
-                    return values;
+                    return externalValues ? *externalValues : values;
                 }
                 
                 std::vector<ValueType> values;
+                std::vector<ValueType> const* externalValues;
                 boost::optional<std::vector<uint64_t>> scheduler;
             };
             
             template<typename ValueType>
-            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
-                
-                // Initialize the solution vector.
-                std::vector<ValueType> x = hint.hasValueHint() ? std::move(hint.getValueHint()) : std::vector<ValueType>(submatrix.getRowGroupCount(), hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<ValueType>());
-                
-                // Set up the solver.
-                storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
-                solver->setRequirementsChecked();
-                solver->setHasUniqueSolution(hint.hasUniqueSolution());
-                solver->setHasNoEndComponents(hint.hasNoEndComponents());
+            void configureSolverForMaybeStates(storm::solver::MinMaxLinearEquationSolver<ValueType>& solver, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+                solver.setRequirementsChecked();
+                solver.setHasUniqueSolution(hint.hasUniqueSolution());
+                solver.setHasNoEndComponents(hint.hasNoEndComponents());
                 if (hint.hasLowerResultBound()) {
-                    solver->setLowerBound(hint.getLowerResultBound());
+                    solver.setLowerBound(hint.getLowerResultBound());
                 }
                 if (hint.hasUpperResultBound()) {
-                    solver->setUpperBound(hint.getUpperResultBound());
+                    solver.setUpperBound(hint.getUpperResultBound());
                 }
                 if (hint.hasUpperResultBounds()) {
-                    solver->setUpperBounds(std::move(hint.getUpperResultBounds()));
+                    solver.setUpperBounds(std::move(hint.getUpperResultBounds()));
                 }
                 if (hint.hasSchedulerHint()) {
-                    solver->setInitialScheduler(std::move(hint.getSchedulerHint()));
+                    solver.setInitialScheduler(std::move(hint.getSchedulerHint()));
                 }
-                solver->setTrackScheduler(produceScheduler);
-                
-                // Solve the corresponding system of equations.
-                solver->solveEquations(env, x, b);
-                
+                solver.setTrackScheduler(produceScheduler);
+            }
+            
+            template<typename ValueType>
+            void initializeValuesForMaybeStates(std::vector<ValueType>& x, uint64_t numberOfMaybeStates, SparseMdpHintType<ValueType>& hint) {
+                if (hint.hasValueHint()) {
+                    x = std::move(hint.getValueHint());
+                } else {
+                    x.assign(numberOfMaybeStates, hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<ValueType>());
+                }
+            }
+            
+            template<typename ValueType>
+            void checkUpperBoundsForMaybeStates(Environment const& env, storm::solver::MinMaxLinearEquationSolver<ValueType> const& solver, std::vector<ValueType> const& x) {
 #ifndef NDEBUG
                 // As a sanity check, make sure our local upper bounds were in fact correct.
-                if (solver->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                if (solver.hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
                     auto resultIt = x.begin();
-                    for (auto const& entry : solver->getUpperBounds()) {
+                    for (auto const& entry : solver.getUpperBounds()) {
                         STORM_LOG_ASSERT(*resultIt <= entry + storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), "Expecting result value for state " << std::distance(x.begin(), resultIt) << " to be <= " << entry << ", but got " << *resultIt << ".");
                         ++resultIt;
                     }
                 }
 #endif
+            }
+            
+            template<typename ValueType, typename MatrixType>
+            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, MatrixType&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+                
+                // Initialize the solution vector.
+                std::vector<ValueType> x;
+                initializeValuesForMaybeStates(x, submatrix.getRowGroupCount(), hint);
+                
+                // Set up the solver.
+                storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::forward<MatrixType>(submatrix));
+                configureSolverForMaybeStates(*solver, produceScheduler, hint);
+                
+                // Solve the corresponding system of equations.
+                solver->solveEquations(env, x, b);
+                checkUpperBoundsForMaybeStates(env, *solver, x);
                 
                 // Create result.
                 MaybeStateResult<ValueType> result(std::move(x));
@@ -445,6 +472,29 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType>
+            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, SparseMdpSolverWorkspace<ValueType>& workspace, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+                
+                // Initialize the solution vector (reusing the storage of the workspace).
+                std::vector<ValueType>& x = workspace.getSolutionVector();
+                initializeValuesForMaybeStates(x, workspace.getSubmatrix().getRowGroupCount(), hint);
+                
+                // Retrieve the (possibly cached) solver for the equation system of the workspace.
+                storm::solver::MinMaxLinearEquationSolver<ValueType>& solver = workspace.getSolver(env, std::move(goal));
+                configureSolverForMaybeStates(solver, produceScheduler, hint);
+                
+                // Solve the corresponding system of equations.
+                solver.solveEquations(env, x, workspace.getRightHandSide());
+                checkUpperBoundsForMaybeStates(env, solver, x);
+                
+                // Create result that refers to the values in the workspace.
+                MaybeStateResult<ValueType> result(&x);
+                if (produceScheduler) {
+                    result.scheduler = solver.getSchedulerChoices();
+                }
+                return result;
+            }
+            
             struct QualitativeStateSetsUntilProbabilities {
                 storm::storage::BitVector maybeStates;
                 storm::storage::BitVector statesWithProbability0;
@@ -500,6 +550,27 @@ namespace storm {
                 }
             }
             
+            template<typename ValueType>
+            QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint, SparseUntilAnalysisCache<ValueType>& analysisCache, std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry>& cacheEntry) {
+                if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+                    // The maybe states given by the hint might differ from the actual ones, so we do not cache them.
+                    return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
+                }
+                
+                cacheEntry = analysisCache.find(phiStates, psiStates, goal.direction());
+                if (cacheEntry) {
+                    QualitativeStateSetsUntilProbabilities result;
+                    result.maybeStates = cacheEntry->maybeStates;
+                    result.statesWithProbability0 = cacheEntry->statesWithProbability0;
+                    result.statesWithProbability1 = cacheEntry->statesWithProbability1;
+                    return result;
+                }
+                
+                QualitativeStateSetsUntilProbabilities result = computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+                cacheEntry = analysisCache.insert(phiStates, psiStates, goal.direction(), result.statesWithProbability0, result.statesWithProbability1);
+                return result;
+            }
+            
             template<typename ValueType>
             void extractSchedulerChoices(storm::storage::Scheduler<ValueType>& scheduler, std::vector<uint_fast64_t> const& subChoices, storm::storage::BitVector const& maybeStates) {
                 auto subChoiceIt = subChoices.begin();
@@ -543,6 +614,45 @@ namespace storm {
                 goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
             }
             
+            template<typename ValueType>
+            void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, SparseMdpSolverWorkspace<ValueType>& workspace, SparseUntilAnalysisCache<ValueType>* analysisCache, std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry> const& cacheEntry) {
+                // The submatrix is only rebuilt if neither the workspace nor the cache already hold the one for the maybe states.
+                if (cacheEntry && cacheEntry->maybeStateSubmatrix) {
+                    workspace.prepare(transitionMatrix, qualitativeStateSets.maybeStates, cacheEntry->maybeStateSubmatrix);
+                } else {
+                    workspace.prepare(transitionMatrix, qualitativeStateSets.maybeStates);
+                }
+                
+                if (cacheEntry && cacheEntry->rightHandSide) {
+                    workspace.getRightHandSide() = cacheEntry->rightHandSide.get();
+                } else {
+                    workspace.getRightHandSide() = transitionMatrix.getConstrainedRowGroupSumVector(qualitativeStateSets.maybeStates, qualitativeStateSets.statesWithProbability1);
+                }
+                
+                if (cacheEntry && (!cacheEntry->maybeStateSubmatrix || !cacheEntry->rightHandSide)) {
+                    cacheEntry->maybeStateSubmatrix = workspace.getSharedSubmatrix();
+                    cacheEntry->rightHandSide = workspace.getRightHandSide();
+                    analysisCache->update(cacheEntry);
+                }
+                goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
+            }
+            
+            template<typename ValueType>
+            void restrictRelevantValuesAfterEndComponentElimination(storm::solver::SolveGoal<ValueType>& goal, storm::storage::BitVector const& maybeStates, SparseMdpEndComponentInformation<ValueType> const& ecInformation, uint64_t numberOfRowGroups) {
+                // If the solve goal has relevant values, we need to adjust them.
+                if (goal.hasRelevantValues()) {
+                    storm::storage::BitVector newRelevantValues(numberOfRowGroups);
+                    for (auto state : goal.relevantValues()) {
+                        if (maybeStates.get(state)) {
+                            newRelevantValues.set(ecInformation.getRowGroupAfterElimination(state));
+                        }
+                    }
+                    if (!newRelevantValues.empty()) {
+                        goal.setRelevantValues(std::move(newRelevantValues));
+                    }
+                }
+            }
+            
             template<typename ValueType>
             boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
                 
@@ -561,20 +671,7 @@ namespace storm {
                 if (doDecomposition && !endComponentDecomposition.empty()) {
                     STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
                     SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr, produceScheduler);
-                    
-                    // If the solve goal has relevant values, we need to adjust them.
-                    if (goal.hasRelevantValues()) {
-                        storm::storage::BitVector newRelevantValues(submatrix.getRowGroupCount());
-                        for (auto state : goal.relevantValues()) {
-                            if (qualitativeStateSets.maybeStates.get(state)) {
-                                newRelevantValues.set(result.getRowGroupAfterElimination(state));
-                            }
-                        }
-                        if (!newRelevantValues.empty()) {
-                            goal.setRelevantValues(std::move(newRelevantValues));
-                        }
-                    }
-                    
+                    restrictRelevantValuesAfterEndComponentElimination(goal, qualitativeStateSets.maybeStates, result, submatrix.getRowGroupCount());
                     return result;
                 } else {
                     STORM_LOG_DEBUG("Not eliminating ECs as there are none.");
@@ -585,7 +682,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<ValueType>* workspace, SparseUntilAnalysisCache<ValueType>* analysisCache) {
                 STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException, "Cannot produce scheduler when performing qualitative model checking only.");
                 
                 // Prepare resulting vector.
@@ -593,7 +690,9 @@ namespace storm {
                 
                 // We need to identify the maybe states (states which have a probability for satisfying the until formula
                 // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
-                QualitativeStateSetsUntilProbabilities qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+                // If a cache is given, the results of previous queries with the same phi and psi states are used.
+                std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry> cacheEntry;
+                QualitativeStateSetsUntilProbabilities qualitativeStateSets = analysisCache ? getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, *analysisCache, cacheEntry) : getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
                 
                 STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, " << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << qualitativeStateSets.maybeStates.getNumberOfSetBits() << " states remaining).");
                 
@@ -632,18 +731,46 @@ namespace storm {
                         
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
+                        // If set, the end component free system stored in the cache entry is solved.
+                        typename SparseUntilAnalysisCache<ValueType>::EndComponentFreeSystem const* cachedSystem = nullptr;
+                        bool useWorkspace = false;
                         if (hintInformation.getEliminateEndComponents()) {
-                            ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler);
+                            // Systems that are used to produce schedulers contain additional information, so we do not cache them.
+                            if (cacheEntry && !produceScheduler) {
+                                if (cacheEntry->endComponentFreeSystem) {
+                                    cachedSystem = &cacheEntry->endComponentFreeSystem.get();
+                                    if (cachedSystem->endComponentInformation) {
+                                        restrictRelevantValuesAfterEndComponentElimination(goal, qualitativeStateSets.maybeStates, cachedSystem->endComponentInformation.get(), cachedSystem->submatrix.getRowGroupCount());
+                                    } else {
+                                        goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
+                                    }
+                                } else {
+                                    typename SparseUntilAnalysisCache<ValueType>::EndComponentFreeSystem system;
+                                    system.endComponentInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, system.submatrix, system.rightHandSide, false);
+                                    cacheEntry->endComponentFreeSystem = std::move(system);
+                                    cachedSystem = &cacheEntry->endComponentFreeSystem.get();
+                                    analysisCache->update(cacheEntry);
+                                }
+                            } else {
+                                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler);
+                            }
+                        } else if (workspace) {
+                            // Otherwise, we compute the standard equations (in the workspace, if one is given).
+                            computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, *workspace, analysisCache, cacheEntry);
+                            useWorkspace = true;
                         } else {
-                            // Otherwise, we compute the standard equations.
                             computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
                         }
                         
                         // Now compute the results for the maybe states.
-                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                        MaybeStateResult<ValueType> resultForMaybeStates = useWorkspace ? computeValuesForMaybeStates(env, std::move(goal), *workspace, produceScheduler, hintInformation) :
+                                                                           cachedSystem ? computeValuesForMaybeStates(env, std::move(goal), cachedSystem->submatrix, cachedSystem->rightHandSide, produceScheduler, hintInformation) :
+                                                                           computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
                         
                         // If we eliminated end components, we need to extract the result differently.
-                        if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
+                        if (cachedSystem && cachedSystem->endComponentInformation && cachedSystem->endComponentInformation.get().getEliminatedEndComponents()) {
+                            cachedSystem->endComponentInformation.get().setValues(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
+                        } else if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
                             ecInformation.get().setValues(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
                             if (produceScheduler) {
                                 ecInformation.get().setScheduler(*scheduler, qualitativeStateSets.maybeStates, transitionMatrix, backwardTransitions, resultForMaybeStates.getScheduler());
@@ -674,7 +801,7 @@ namespace storm {
             }
 
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, bool useMecBasedTechnique) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, bool useMecBasedTechnique, SparseMdpSolverWorkspace<ValueType>* workspace, SparseUntilAnalysisCache<ValueType>* analysisCache) {
                 if (useMecBasedTechnique) {
                     // TODO: does this really work for minimizing objectives?
                     storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
@@ -685,10 +812,10 @@ namespace storm {
                         }
                     }
                     
-                    return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative, produceScheduler);
+                    return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative, produceScheduler, ModelCheckerHint(), workspace, analysisCache);
                 } else {
                     goal.oneMinus();
-                    auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler);
+                    auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler, ModelCheckerHint(), workspace, analysisCache);
                     for (auto& element : result.values) {
                         element = storm::utility::one<ValueType>() - element;
                     }
@@ -811,7 +938,7 @@ namespace storm {
             
             template<typename ValueType>
             template<typename RewardModelType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<ValueType>* workspace) {
                 // Only compute the result if the model has at least one reward this->getModel().
                 STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Reward model for formula is empty. Skipping formula.");
                 return computeReachabilityRewardsHelper(env, std::move(goal), transitionMatrix, backwardTransitions,
@@ -825,11 +952,11 @@ namespace storm {
                                                         [&] () {
                                                             return rewardModel.getChoicesWithZeroReward(transitionMatrix);
                                                         },
-                                                        hint);
+                                                        hint, workspace);
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<ValueType>* workspace) {
                 return computeReachabilityRewardsHelper(env, std::move(goal), transitionMatrix, backwardTransitions,
                                                         [] (uint_fast64_t rowCount, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&) {
                                                             return std::vector<ValueType>(rowCount, storm::utility::one<ValueType>());
@@ -841,7 +968,7 @@ namespace storm {
                                                         [&] () {
                                                             return storm::storage::BitVector(transitionMatrix.getRowCount(), false);
                                                         },
-                                                        hint);
+                                                        hint, workspace);
             }
             
 #ifdef STORM_HAVE_CARL
@@ -997,6 +1124,18 @@ namespace storm {
                 goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
             }
             
+            template<typename ValueType>
+            void computeFixedPointSystemReachabilityRewards(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, SparseMdpSolverWorkspace<ValueType>& workspace, std::vector<ValueType>* oneStepTargetProbabilities = nullptr) {
+                STORM_LOG_ASSERT(qualitativeStateSets.infinityStates.empty(), "Expected no states with infinite reward.");
+                // The submatrix is only rebuilt if the workspace does not already hold the one for the maybe states.
+                workspace.prepare(transitionMatrix, qualitativeStateSets.maybeStates);
+                workspace.getRightHandSide() = totalStateRewardVectorGetter(workspace.getSubmatrix().getRowCount(), transitionMatrix, qualitativeStateSets.maybeStates);
+                if (oneStepTargetProbabilities) {
+                    (*oneStepTargetProbabilities) = transitionMatrix.getConstrainedRowGroupSumVector(qualitativeStateSets.maybeStates, qualitativeStateSets.rewardZeroStates);
+                }
+                goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
+            }
+            
             template<typename ValueType>
             boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemReachabilityRewardsEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets, boost::optional<storm::storage::BitVector> const& selectedChoices, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, boost::optional<std::vector<ValueType>>& oneStepTargetProbabilities, bool produceScheduler) {
                 
@@ -1082,7 +1221,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewardsHelper(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewardsHelper(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<ValueType>* workspace) {
                 
                 // Prepare resulting vector.
                 std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -1135,21 +1274,25 @@ namespace storm {
                         
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
+                        bool useWorkspace = false;
                         if (hintInformation.getEliminateEndComponents()) {
                             ecInformation = computeFixedPointSystemReachabilityRewardsEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b, oneStepTargetProbabilities, produceScheduler);
+                        } else if (workspace && !selectedChoices) {
+                            // Otherwise, we compute the standard equations (in the workspace, if one is given and all choices of the maybe states are kept).
+                            computeFixedPointSystemReachabilityRewards(goal, transitionMatrix, qualitativeStateSets, totalStateRewardVectorGetter, *workspace, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr);
+                            useWorkspace = true;
                         } else {
-                            // Otherwise, we compute the standard equations.
                             computeFixedPointSystemReachabilityRewards(goal, transitionMatrix, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr);
                         }
                         
                         // If we need to compute upper bounds, do so now.
                         if (hintInformation.getComputeUpperBounds()) {
                             STORM_LOG_ASSERT(oneStepTargetProbabilities, "Expecting one step target probability vector to be available.");
-                            computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
+                            computeUpperRewardBounds(hintInformation, goal.direction(), useWorkspace ? workspace->getSubmatrix() : submatrix, useWorkspace ? workspace->getRightHandSide() : b, oneStepTargetProbabilities.get());
                         }
                         
                         // Now compute the results for the maybe states.
-                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                        MaybeStateResult<ValueType> resultForMaybeStates = useWorkspace ? computeValuesForMaybeStates(env, std::move(goal), *workspace, produceScheduler, hintInformation) : computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
                         // If we eliminated end components, we need to extract the result differently.
                         if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -1332,14 +1475,14 @@ namespace storm {
             template class SparseMdpPrctlHelper<double>;
             template std::vector<double> SparseMdpPrctlHelper<double>::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, uint_fast64_t stepCount);
             template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, uint_fast64_t stepBound);
-            template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+            template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<double>* workspace);
             template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
 
 #ifdef STORM_HAVE_CARL
             template class SparseMdpPrctlHelper<storm::RationalNumber>;
             template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, uint_fast64_t stepCount);
             template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, uint_fast64_t stepBound);
-            template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+            template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverWorkspace<storm::RationalNumber>* workspace);
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
 #endif
         }
@@ -0,0 +1,130 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverWorkspace.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            SparseMdpSolverWorkspace<ValueType>::SolverSettings::SolverSettings(Environment const& env) : method(env.solver().minMax().getMethod()), precision(env.solver().minMax().getPrecision()), relative(env.solver().minMax().getRelativeTerminationCriterion()), maximalNumberOfIterations(env.solver().minMax().getMaximalNumberOfIterations()), multiplicationStyle(env.solver().minMax().getMultiplicationStyle()), topologicalMethod(env.solver().topological().getUnderlyingMinMaxMethod()), linearEquationSolverType(env.solver().getLinearEquationSolverType()), forceSoundness(env.solver().isForceSoundness()), forceExact(env.solver().isForceExact()), mixedPrecision(env.solver().minMax().isMixedPrecisionSet()), mixedPrecisionSwitchThreshold(env.solver().minMax().getMixedPrecisionSwitchThreshold()), multiplierType(env.solver().multiplier().getType()), numberOfThreads(env.solver().multiplier().getNumberOfThreads()), multicolorGaussSeidel(env.solver().multiplier().isMulticolorGaussSeidelSet()) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverWorkspace<ValueType>::SolverSettings::operator==(SolverSettings const& other) const {
+                return method == other.method && precision == other.precision && relative == other.relative && maximalNumberOfIterations == other.maximalNumberOfIterations
+                    && multiplicationStyle == other.multiplicationStyle && topologicalMethod == other.topologicalMethod && linearEquationSolverType == other.linearEquationSolverType
+                    && forceSoundness == other.forceSoundness && forceExact == other.forceExact && mixedPrecision == other.mixedPrecision && mixedPrecisionSwitchThreshold == other.mixedPrecisionSwitchThreshold
+                    && multiplierType == other.multiplierType && numberOfThreads == other.numberOfThreads && multicolorGaussSeidel == other.multicolorGaussSeidel;
+            }
+
+            template<typename ValueType>
+            SparseMdpSolverWorkspace<ValueType>::SparseMdpSolverWorkspace() : transitionMatrix(nullptr) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverWorkspace<ValueType>::isPreparedFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) const {
+                return this->transitionMatrix == &transitionMatrix && this->maybeStates == maybeStates;
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverWorkspace<ValueType>::prepare(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) {
+                if (isPreparedFor(transitionMatrix, maybeStates)) {
+                    STORM_LOG_DEBUG("Reusing the equation system for " << maybeStates.getNumberOfSetBits() << " maybe states.");
+                    return true;
+                }
+                return prepare(transitionMatrix, maybeStates, std::make_shared<storm::storage::SparseMatrix<ValueType> const>(transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false)));
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverWorkspace<ValueType>::prepare(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& submatrix) {
+                if (isPreparedFor(transitionMatrix, maybeStates)) {
+                    STORM_LOG_DEBUG("Reusing the equation system for " << maybeStates.getNumberOfSetBits() << " maybe states.");
+                    return true;
+                }
+                STORM_LOG_ASSERT(submatrix && submatrix->getRowGroupCount() == maybeStates.getNumberOfSetBits(), "The given submatrix does not match the maybe states.");
+                this->transitionMatrix = &transitionMatrix;
+                this->maybeStates = maybeStates;
+                this->submatrix = submatrix;
+                if (solver) {
+                    // The solver refers to the submatrix, but its cached data belongs to the previous system.
+                    solver->setMatrix(*this->submatrix);
+                }
+                return false;
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseMdpSolverWorkspace<ValueType>::getSubmatrix() const {
+                STORM_LOG_THROW(transitionMatrix != nullptr, storm::exceptions::InvalidOperationException, "The solver workspace has not been prepared.");
+                return *submatrix;
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& SparseMdpSolverWorkspace<ValueType>::getSharedSubmatrix() const {
+                STORM_LOG_THROW(transitionMatrix != nullptr, storm::exceptions::InvalidOperationException, "The solver workspace has not been prepared.");
+                return submatrix;
+            }
+
+            template<typename ValueType>
+            storm::solver::MinMaxLinearEquationSolver<ValueType>& SparseMdpSolverWorkspace<ValueType>::getSolver(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal) {
+                STORM_LOG_THROW(transitionMatrix != nullptr, storm::exceptions::InvalidOperationException, "The solver workspace has not been prepared.");
+                if (!hasSolverFor(env)) {
+                    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
+                    solver = minMaxLinearEquationSolverFactory.create(env, *submatrix);
+                    solver->setCachingEnabled(true);
+                    solverSettings = SolverSettings(env);
+                } else {
+                    // Remove everything that was specific to the previous query.
+                    solver->clearBounds();
+                    solver->clearInitialScheduler();
+                    solver->setTrackScheduler(false);
+                    solver->setHasUniqueSolution(false);
+                    solver->setHasNoEndComponents(false);
+                    solver->setRequirementsChecked(false);
+                }
+                storm::solver::configureMinMaxLinearEquationSolver(std::move(goal), *solver);
+                return *solver;
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverWorkspace<ValueType>::hasSolverFor(Environment const& env) const {
+                return solver && solverSettings && solverSettings.get() == SolverSettings(env);
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType>& SparseMdpSolverWorkspace<ValueType>::getSolutionVector() {
+                return solution;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType>& SparseMdpSolverWorkspace<ValueType>::getRightHandSide() {
+                return rightHandSide;
+            }
+
+            template<typename ValueType>
+            void SparseMdpSolverWorkspace<ValueType>::clear() {
+                solver.reset();
+                solverSettings = boost::none;
+                transitionMatrix = nullptr;
+                maybeStates = storm::storage::BitVector();
+                submatrix.reset();
+                std::vector<ValueType>().swap(solution);
+                std::vector<ValueType>().swap(rightHandSide);
+            }
+
+            template class SparseMdpSolverWorkspace<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseMdpSolverWorkspace<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/MultiplicationStyle.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolveGoal.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Holds the equation system over the maybe states of an MDP together with a min/max equation solver and the
+             * solution vectors. If consecutive queries share the same maybe states (as it is often the case when checking
+             * several properties on the same model), the submatrix is not rebuilt and the solver (including the data it
+             * caches, e.g., SCC decompositions or auxiliary vectors) as well as the vectors are reused, such that no
+             * allocations are necessary while solving.
+             */
+            template<typename ValueType>
+            class SparseMdpSolverWorkspace {
+            public:
+                SparseMdpSolverWorkspace();
+
+                /*!
+                 * Retrieves whether the workspace holds the equation system of the given transition matrix restricted to
+                 * the given maybe states.
+                 */
+                bool isPreparedFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) const;
+
+                /*!
+                 * Prepares the workspace for the given transition matrix and maybe states. The submatrix is only
+                 * (re-)computed if the workspace is not already prepared for them.
+                 *
+                 * @return True iff the equation system of a previous query could be reused.
+                 */
+                bool prepare(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates);
+
+                /*!
+                 * Prepares the workspace for the given transition matrix and maybe states. If the workspace is not already
+                 * prepared for them, the given submatrix (which needs to be the transition matrix restricted to the maybe
+                 * states) is used instead of computing it again.
+                 *
+                 * @return True iff the equation system of a previous query could be reused.
+                 */
+                bool prepare(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& submatrix);
+
+                /*!
+                 * Retrieves the transition matrix restricted to the maybe states. The workspace needs to be prepared.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getSubmatrix() const;
+
+                /*!
+                 * Retrieves the transition matrix restricted to the maybe states such that it can be shared with others.
+                 * The workspace needs to be prepared.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& getSharedSubmatrix() const;
+
+                /*!
+                 * Retrieves a solver for the submatrix that is configured according to the given goal. Settings of
+                 * previous queries (bounds, initial schedulers, termination conditions, relevant values) are removed. The
+                 * solver is only recreated if the solver settings of the environment differ from the ones of the previous
+                 * query.
+                 */
+                storm::solver::MinMaxLinearEquationSolver<ValueType>& getSolver(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal);
+
+                /*!
+                 * Retrieves whether the workspace holds a solver that is reused when a solver for the given environment is
+                 * requested.
+                 */
+                bool hasSolverFor(Environment const& env) const;
+
+                /*!
+                 * Retrieves the vector that holds the solution for the maybe states.
+                 */
+                std::vector<ValueType>& getSolutionVector();
+
+                /*!
+                 * Retrieves the vector that holds the right-hand side of the equation system.
+                 */
+                std::vector<ValueType>& getRightHandSide();
+
+                /*!
+                 * Releases all data held by the workspace.
+                 */
+                void clear();
+
+            private:
+                /*!
+                 * The settings of an environment that affect the creation and configuration of a solver.
+                 */
+                struct SolverSettings {
+                    SolverSettings(Environment const& env);
+                    bool operator==(SolverSettings const& other) const;
+
+                    storm::solver::MinMaxMethod method;
+                    storm::RationalNumber precision;
+                    bool relative;
+                    uint64_t maximalNumberOfIterations;
+                    storm::solver::MultiplicationStyle multiplicationStyle;
+                    storm::solver::MinMaxMethod topologicalMethod;
+                    storm::solver::EquationSolverType linearEquationSolverType;
+                    bool forceSoundness;
+                    bool forceExact;
+                    bool mixedPrecision;
+                    storm::RationalNumber mixedPrecisionSwitchThreshold;
+                    // The layout and instruction set of native multipliers are checked whenever they are used.
+                    storm::solver::MultiplierType multiplierType;
+                    uint64_t numberOfThreads;
+                    bool multicolorGaussSeidel;
+                };
+
+                // The transition matrix and maybe states for which the workspace is prepared.
+                storm::storage::SparseMatrix<ValueType> const* transitionMatrix;
+                storm::storage::BitVector maybeStates;
+
+                // The transition matrix restricted to the maybe states.
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> submatrix;
+
+                // The solver for the submatrix and the settings of the environment it was created for.
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                boost::optional<SolverSettings> solverSettings;
+
+                std::vector<ValueType> solution;
+                std::vector<ValueType> rightHandSide;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverWorkspace.h"
+#include "storm/modelchecker/prctl/helper/SparseUntilAnalysisCache.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Holds the data that the sparse DTMC and MDP model checkers reuse across the queries on one model, i.e., the
+             * cached results of until queries and the equation system (and solver) of the most recent MDP query. As model
+             * checkers are usually created for each property (e.g. by storm::api::verifyWithSparseEngine), the data is
+             * only reused if all of them are given the same instance of this class.
+             *
+             * The data belongs to a single transition matrix. If the cache is used for another one, the data of the
+             * previous matrix is dropped.
+             */
+            template<typename ValueType>
+            class SparseModelCheckerCache {
+            public:
+                SparseModelCheckerCache() : transitionMatrix(nullptr) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Retrieves the cache for until probabilities on the given transition matrix with the size given by the
+                 * environment (or null if the cache is disabled).
+                 */
+                SparseUntilAnalysisCache<ValueType>* getUntilAnalysisCache(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                    setTransitionMatrix(transitionMatrix);
+                    uint64_t maximalSize = env.modelchecker().getAnalysisCacheSize() * 1024 * 1024;
+                    untilAnalysisCache.setMaximalSize(maximalSize);
+                    return maximalSize > 0 ? &untilAnalysisCache : nullptr;
+                }
+
+                /*!
+                 * Retrieves the cache for until probabilities (regardless of whether it is enabled).
+                 */
+                SparseUntilAnalysisCache<ValueType> const& getUntilAnalysisCache() const {
+                    return untilAnalysisCache;
+                }
+
+                /*!
+                 * Retrieves the workspace for the equation systems of MDPs with the given transition matrix.
+                 */
+                SparseMdpSolverWorkspace<ValueType>& getSolverWorkspace(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                    setTransitionMatrix(transitionMatrix);
+                    return getSolverWorkspace();
+                }
+
+                /*!
+                 * Retrieves the workspace that holds the equation system (and solver) of the most recent MDP query.
+                 */
+                SparseMdpSolverWorkspace<ValueType>& getSolverWorkspace() {
+                    // The workspace is only created on demand as it is not available for all value types.
+                    if (!solverWorkspace) {
+                        solverWorkspace = std::make_shared<SparseMdpSolverWorkspace<ValueType>>();
+                    }
+                    return *solverWorkspace;
+                }
+
+            private:
+                void setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                    if (this->transitionMatrix != &transitionMatrix) {
+                        if (this->transitionMatrix != nullptr) {
+                            // Workspaces that were retrieved before any matrix was set remain valid.
+                            untilAnalysisCache.clear();
+                            solverWorkspace.reset();
+                        }
+                        this->transitionMatrix = &transitionMatrix;
+                    }
+                }
+
+                // The transition matrix the data belongs to.
+                storm::storage::SparseMatrix<ValueType> const* transitionMatrix;
+
+                // The graph analysis results and equation systems of previous until queries.
+                SparseUntilAnalysisCache<ValueType> untilAnalysisCache;
+
+                // The equation system (and solver) of the most recent MDP query.
+                std::shared_ptr<SparseMdpSolverWorkspace<ValueType>> solverWorkspace;
+            };
+
+        }
+    }
+}
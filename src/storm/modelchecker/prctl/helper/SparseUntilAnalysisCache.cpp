@@ -0,0 +1,188 @@
+#include "storm/modelchecker/prctl/helper/SparseUntilAnalysisCache.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            uint64_t estimateMatrixSize(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+                return matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<IndexType, ValueType>) + (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(IndexType);
+            }
+
+            uint64_t estimateBitVectorSize(storm::storage::BitVector const& bitVector) {
+                return (bitVector.size() + 63) / 64 * sizeof(uint64_t);
+            }
+
+            template<typename ValueType>
+            bool SparseUntilAnalysisCache<ValueType>::Key::operator==(Key const& other) const {
+                return direction == other.direction && phiStates == other.phiStates && psiStates == other.psiStates;
+            }
+
+            template<typename ValueType>
+            std::size_t SparseUntilAnalysisCache<ValueType>::KeyHash::operator()(Key const& key) const {
+                std::hash<storm::storage::BitVector> bitVectorHash;
+                std::size_t result = bitVectorHash(key.phiStates);
+                result ^= bitVectorHash(key.psiStates) + 0x9e3779b9 + (result << 6) + (result >> 2);
+                if (key.direction) {
+                    result ^= static_cast<std::size_t>(key.direction.get()) + 1;
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            SparseUntilAnalysisCache<ValueType>::SparseUntilAnalysisCache(uint64_t maximalSize) : maximalSize(maximalSize), size(0), numberOfHits(0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            SparseUntilAnalysisCache<ValueType>::SparseUntilAnalysisCache(SparseUntilAnalysisCache const& other) : maximalSize(other.maximalSize), size(other.size), numberOfHits(other.numberOfHits), entries(other.entries) {
+                rebuildIndex();
+            }
+
+            template<typename ValueType>
+            SparseUntilAnalysisCache<ValueType>& SparseUntilAnalysisCache<ValueType>::operator=(SparseUntilAnalysisCache const& other) {
+                if (this != &other) {
+                    maximalSize = other.maximalSize;
+                    size = other.size;
+                    numberOfHits = other.numberOfHits;
+                    entries = other.entries;
+                    rebuildIndex();
+                }
+                return *this;
+            }
+
+            template<typename ValueType>
+            void SparseUntilAnalysisCache<ValueType>::rebuildIndex() {
+                // The index refers to the list nodes, so it can not be copied.
+                keyToEntry.clear();
+                for (auto it = entries.begin(); it != entries.end(); ++it) {
+                    keyToEntry.emplace(it->key, it);
+                }
+            }
+
+            template<typename ValueType>
+            void SparseUntilAnalysisCache<ValueType>::setMaximalSize(uint64_t maximalSize) {
+                this->maximalSize = maximalSize;
+                evict();
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry> SparseUntilAnalysisCache<ValueType>::find(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::solver::OptimizationDirection> const& direction) {
+                auto findIt = keyToEntry.find(Key{phiStates, psiStates, direction});
+                if (findIt == keyToEntry.end()) {
+                    return nullptr;
+                }
+                ++numberOfHits;
+                // Move the entry to the front as it is now the most recently used one.
+                entries.splice(entries.begin(), entries, findIt->second);
+                STORM_LOG_DEBUG("Found cached analysis results for " << findIt->second->entry->maybeStates.getNumberOfSetBits() << " maybe states.");
+                return findIt->second->entry;
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<typename SparseUntilAnalysisCache<ValueType>::Entry> SparseUntilAnalysisCache<ValueType>::insert(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::solver::OptimizationDirection> const& direction, storm::storage::BitVector const& statesWithProbability0, storm::storage::BitVector const& statesWithProbability1) {
+                auto entry = std::make_shared<Entry>();
+                entry->statesWithProbability0 = statesWithProbability0;
+                entry->statesWithProbability1 = statesWithProbability1;
+                entry->maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+
+                Key key{phiStates, psiStates, direction};
+                auto findIt = keyToEntry.find(key);
+                if (findIt != keyToEntry.end()) {
+                    size -= findIt->second->size;
+                    entries.erase(findIt->second);
+                    keyToEntry.erase(findIt);
+                }
+
+                uint64_t entrySize = estimateBitVectorSize(phiStates) + estimateBitVectorSize(psiStates) + estimateSize(*entry);
+                entries.push_front(CachedEntry{key, entry, entrySize});
+                keyToEntry.emplace(std::move(key), entries.begin());
+                size += entrySize;
+                evict();
+                return entry;
+            }
+
+            template<typename ValueType>
+            void SparseUntilAnalysisCache<ValueType>::update(std::shared_ptr<Entry> const& entry) {
+                for (auto& cachedEntry : entries) {
+                    if (cachedEntry.entry == entry) {
+                        uint64_t newSize = estimateBitVectorSize(cachedEntry.key.phiStates) + estimateBitVectorSize(cachedEntry.key.psiStates) + estimateSize(*entry);
+                        size = size - cachedEntry.size + newSize;
+                        cachedEntry.size = newSize;
+                        evict();
+                        return;
+                    }
+                }
+                // If the entry is not found, it has already been evicted.
+            }
+
+            template<typename ValueType>
+            uint64_t SparseUntilAnalysisCache<ValueType>::getSize() const {
+                return size;
+            }
+
+            template<typename ValueType>
+            uint64_t SparseUntilAnalysisCache<ValueType>::getNumberOfEntries() const {
+                return entries.size();
+            }
+
+            template<typename ValueType>
+            uint64_t SparseUntilAnalysisCache<ValueType>::getNumberOfHits() const {
+                return numberOfHits;
+            }
+
+            template<typename ValueType>
+            void SparseUntilAnalysisCache<ValueType>::clear() {
+                keyToEntry.clear();
+                entries.clear();
+                size = 0;
+            }
+
+            template<typename ValueType>
+            uint64_t SparseUntilAnalysisCache<ValueType>::estimateSize(Entry const& entry) {
+                uint64_t result = estimateBitVectorSize(entry.statesWithProbability0) + estimateBitVectorSize(entry.statesWithProbability1) + estimateBitVectorSize(entry.maybeStates);
+                if (entry.maybeStateSubmatrix) {
+                    result += estimateMatrixSize(*entry.maybeStateSubmatrix);
+                }
+                if (entry.equationSystemMatrix) {
+                    result += estimateMatrixSize(*entry.equationSystemMatrix);
+                }
+                if (entry.rightHandSide) {
+                    result += entry.rightHandSide->size() * sizeof(ValueType);
+                }
+                if (entry.endComponentFreeSystem) {
+                    result += estimateMatrixSize(entry.endComponentFreeSystem->submatrix) + entry.endComponentFreeSystem->rightHandSide.size() * sizeof(ValueType);
+                    if (entry.endComponentFreeSystem->endComponentInformation) {
+                        // The end component information stores a constant number of values per maybe state.
+                        result += 3 * entry.maybeStates.getNumberOfSetBits() * sizeof(uint64_t);
+                    }
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            void SparseUntilAnalysisCache<ValueType>::evict() {
+                while (size > maximalSize && !entries.empty()) {
+                    CachedEntry const& leastRecentlyUsed = entries.back();
+                    STORM_LOG_DEBUG("Evicting cached analysis results with an estimated size of " << leastRecentlyUsed.size << " bytes.");
+                    size -= leastRecentlyUsed.size;
+                    keyToEntry.erase(leastRecentlyUsed.key);
+                    entries.pop_back();
+                }
+            }
+
+            template class SparseUntilAnalysisCache<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseUntilAnalysisCache<storm::RationalNumber>;
+            template class SparseUntilAnalysisCache<storm::RationalFunction>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Caches the intermediate results of (unbounded) until probability computations on a fixed model, i.e., the
+             * states with probability 0 and 1 and the equation system over the maybe states. Entries are identified by
+             * the phi and psi states and the optimization direction (which is not given for DTMCs). Properties that share
+             * these sets can thus skip the graph analysis and the extraction of the equation system.
+             *
+             * The memory consumed by the entries is estimated and limited. If the limit is exceeded, the least recently
+             * used entries are evicted.
+             */
+            template<typename ValueType>
+            class SparseUntilAnalysisCache {
+            public:
+                /*!
+                 * The equation system obtained by eliminating the end components among the maybe states of an MDP.
+                 */
+                struct EndComponentFreeSystem {
+                    // Information about the eliminated end components (not set if there were none).
+                    boost::optional<SparseMdpEndComponentInformation<ValueType>> endComponentInformation;
+                    storm::storage::SparseMatrix<ValueType> submatrix;
+                    std::vector<ValueType> rightHandSide;
+                };
+
+                struct Entry {
+                    storm::storage::BitVector statesWithProbability0;
+                    storm::storage::BitVector statesWithProbability1;
+                    storm::storage::BitVector maybeStates;
+
+                    // The transition matrix restricted to the maybe states (if it was already computed).
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> maybeStateSubmatrix;
+
+                    // The matrix (I-A) for the maybe states of a DTMC for solvers that require the equation system format.
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> equationSystemMatrix;
+
+                    // For each row of the maybe states, the probability to reach a state with probability 1 in one step.
+                    boost::optional<std::vector<ValueType>> rightHandSide;
+
+                    // The system after end component elimination (only for MDPs).
+                    boost::optional<EndComponentFreeSystem> endComponentFreeSystem;
+                };
+
+                /*!
+                 * Creates a cache whose entries consume (approximately) at most the given number of bytes.
+                 */
+                SparseUntilAnalysisCache(uint64_t maximalSize = 0);
+                
+                SparseUntilAnalysisCache(SparseUntilAnalysisCache const& other);
+                SparseUntilAnalysisCache& operator=(SparseUntilAnalysisCache const& other);
+                SparseUntilAnalysisCache(SparseUntilAnalysisCache&& other) = default;
+                SparseUntilAnalysisCache& operator=(SparseUntilAnalysisCache&& other) = default;
+
+                /*!
+                 * Sets the number of bytes that the entries may consume at most and evicts entries if necessary.
+                 */
+                void setMaximalSize(uint64_t maximalSize);
+
+                /*!
+                 * Retrieves the entry for the given sets (if present) and marks it as most recently used.
+                 *
+                 * @return The entry or a null pointer if there is none.
+                 */
+                std::shared_ptr<Entry> find(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::solver::OptimizationDirection> const& direction);
+
+                /*!
+                 * Inserts an entry with the given qualitative results. The returned entry remains valid even if it is
+                 * evicted from the cache.
+                 */
+                std::shared_ptr<Entry> insert(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<storm::solver::OptimizationDirection> const& direction, storm::storage::BitVector const& statesWithProbability0, storm::storage::BitVector const& statesWithProbability1);
+
+                /*!
+                 * Needs to be called whenever data was added to an entry. Updates the consumed memory and evicts entries
+                 * if necessary.
+                 */
+                void update(std::shared_ptr<Entry> const& entry);
+
+                /*!
+                 * Retrieves the (estimated) number of bytes consumed by the entries.
+                 */
+                uint64_t getSize() const;
+
+                uint64_t getNumberOfEntries() const;
+
+                /*!
+                 * Retrieves how often an entry was found.
+                 */
+                uint64_t getNumberOfHits() const;
+
+                /*!
+                 * Removes all entries.
+                 */
+                void clear();
+
+            private:
+                struct Key {
+                    bool operator==(Key const& other) const;
+
+                    storm::storage::BitVector phiStates;
+                    storm::storage::BitVector psiStates;
+                    boost::optional<storm::solver::OptimizationDirection> direction;
+                };
+
+                struct KeyHash {
+                    std::size_t operator()(Key const& key) const;
+                };
+
+                struct CachedEntry {
+                    Key key;
+                    std::shared_ptr<Entry> entry;
+                    uint64_t size;
+                };
+
+                static uint64_t estimateSize(Entry const& entry);
+                void rebuildIndex();
+                void evict();
+
+                uint64_t maximalSize;
+                uint64_t size;
+                uint64_t numberOfHits;
+
+                // The entries ordered by their last use (most recently used first).
+                std::list<CachedEntry> entries;
+                std::unordered_map<Key, typename std::list<CachedEntry>::iterator, KeyHash> keyToEntry;
+            };
+
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 
@@ -31,6 +32,7 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::threadsOptionName = "threads";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
                 std::vector<std::string> engines;
@@ -61,6 +63,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used for parallelized operations (e.g. exploring the state space in the explicit model builder, matrix-vector multiplications of the native multiplier or solving independent SCCs in the topological solvers). Selects the native multiplier unless another multiplier type is given.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. If zero, one thread per hardware thread is used.").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             storm::solver::EquationSolverType  CoreSettings::getEquationSolver() const {
@@ -136,6 +140,18 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            bool CoreSettings::isNumberOfThreadsSet() const {
+                return this->getOption(threadsOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t CoreSettings::getNumberOfThreads() const {
+                uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+                if (numberOfThreads == 0) {
+                    return storm::utility::parallel::getNumberOfHardwareThreads();
+                }
+                return numberOfThreads;
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
@@ -103,6 +103,20 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Retrieves whether the number of threads has been set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isNumberOfThreadsSet() const;
+
+                /*!
+                 * Retrieves the number of threads to use for parallelized operations.
+                 *
+                 * @return The number of threads (at least one).
+                 */
+                uint64_t getNumberOfThreads() const;
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -142,6 +156,7 @@ namespace storm {
                 static const std::string ddLibraryOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
+                static const std::string threadsOptionName;
                 static const std::string cudaOptionName;
             };
 
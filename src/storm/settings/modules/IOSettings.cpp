@@ -1,5 +1,7 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <boost/algorithm/string.hpp>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -8,8 +10,10 @@
 #include "storm/settings/Argument.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
+#include "storm/io/compression.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 
 namespace storm {
@@ -31,6 +35,7 @@ namespace storm {
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
             const std::string IOSettings::explicitDrnOptionShortName = "drn";
+            const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
             const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
             const std::string IOSettings::explicitImcaOptionShortName = "imca";
             const std::string IOSettings::prismInputOptionName = "prism";
@@ -42,6 +47,7 @@ namespace storm {
             const std::string IOSettings::choiceLabelingOptionName = "choicelab";
             const std::string IOSettings::constantsOptionName = "constants";
             const std::string IOSettings::constantsOptionShortName = "const";
+            const std::string IOSettings::constantSweepOptionName = "constantsweep";
 
             const std::string IOSettings::janiPropertyOptionName = "janiproperty";
             const std::string IOSettings::janiPropertyOptionShortName = "jprop";
@@ -49,6 +55,7 @@ namespace storm {
             const std::string IOSettings::propertyOptionShortName = "prop";
             const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
             const std::string IOSettings::expectedVisitingTimesOptionName = "expvisittimes";
+            const std::string IOSettings::timeBoundsOptionName = "timebounds";
             
             const std::string IOSettings::qvbsInputOptionName = "qvbs";
             const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
@@ -62,9 +69,9 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportDotMaxWidthOptionName, false, "The maximal width for labels in the dot format. For longer lines a linebreak is inserted. Value 0 represents no linebreaks.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("width", "The maximal line width for the dot format. Default is 0 meaning no linebreaks.").setDefaultValueUnsignedInteger(0).build()).build());
-                std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+                std::vector<std::string> exportFormats({"auto", "bin", "dot", "drdd", "drn", "json"});
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
-                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file. Files in the DRN format are compressed if they end with '.gz'.").build())
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("format", "The output format. 'auto' detects from the file extension.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(exportFormats)).setDefaultValueString("auto").makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportJaniDotOptionName, false, "If given, the loaded jani model will be written to the specified file in the dot format.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build()).build());
@@ -82,6 +89,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.").setShortName(explicitDrnOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Loads the model given in the binary format (as written by --" + exportBuildOptionName + " with format 'bin').")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
+                                .build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.").setShortName(explicitImcaOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
@@ -103,10 +113,14 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file from which to read the choice labels.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constantsOptionName, false, "Specifies the constant replacements to use in symbolic models. Note that this requires the model to be given as an symbolic model (i.e., via --" + prismInputOptionName + " or --" + janiInputOptionName + ").").setShortName(constantsOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of constants and their value, e.g. a=1,b=2,c=3.").setDefaultValueString("").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, constantSweepOptionName, false, "Builds and checks the symbolic model for several values of its (remaining) undefined constants. If these constants do not influence the structure of the model, it is explored only once. Requires the sparse engine.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A semicolon separated list of constant definitions, e.g. a=1,b=2;a=3,b=4.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, janiPropertyOptionName, false, "Specifies the properties from the jani model (given by --" + janiInputOptionName + ") to be checked.").setShortName(janiPropertyOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of properties to be checked").setDefaultValueString("").makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  steadyStateDistrOptionName, false, "Computes the steady state distribution. Result can be exported using --" + exportCheckResultOptionName +".").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  expectedVisitingTimesOptionName, false, "Computes the expected number of times each state is visited (DTMC) or the expected time spend in each state (CTMC). Result can be exported using --" + exportCheckResultOptionName +".").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundsOptionName, false, "Checks each property of the form P=? [phi U<=t psi] on CTMCs for all given time bounds (instead of t) in a single pass (sparse engine only).").setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("bounds", "A comma separated list of time bounds.").build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, qvbsInputOptionName, false, "Selects a model from the Quantitative Verification Benchmark Set.").setShortName(qvbsInputOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("model", "The short model name as in the benchmark set.").build())
@@ -146,12 +160,10 @@ namespace storm {
             }
             
             storm::exporter::ModelExportFormat IOSettings::getExportBuildFormat() const {
-                auto format = this->getOption(exportBuildOptionName).getArgumentByName("format").getValueAsString();
-                if (format == "auto") {
-                    return storm::exporter::getModelExportFormatFromFileExtension(getExportBuildFilename());
-                } else {
-                    return storm::exporter::getModelExportFormatFromString(format);
-                }
+                auto formatString = this->getOption(exportBuildOptionName).getArgumentByName("format").getValueAsString();
+                storm::exporter::ModelExportFormat format = formatString == "auto" ? storm::exporter::getModelExportFormatFromFileExtension(getExportBuildFilename()) : storm::exporter::getModelExportFormatFromString(formatString);
+                STORM_LOG_THROW(format == storm::exporter::ModelExportFormat::Drn || !storm::utility::isGzipFilename(getExportBuildFilename()), storm::exceptions::InvalidSettingsException, "Only models in the DRN format can be exported to compressed files, but the file '" << getExportBuildFilename() << "' is to be written in the format '" << storm::exporter::toString(format) << "'.");
+                return format;
             }
 
             bool IOSettings::isExportJaniDotSet() const {
@@ -230,6 +242,14 @@ namespace storm {
                 return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
             }
 
+            bool IOSettings::isExplicitBinarySet() const {
+                return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExplicitBinaryFilename() const {
+                return this->getOption(explicitBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitIMCASet() const {
                 return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
             }
@@ -294,6 +314,17 @@ namespace storm {
                 return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
             }
 
+            bool IOSettings::isConstantSweepSet() const {
+                return this->getOption(constantSweepOptionName).getHasOptionBeenSet();
+            }
+
+            std::vector<std::string> IOSettings::getConstantSweepDefinitionStrings() const {
+                std::vector<std::string> definitionStrings;
+                std::string sweepString = this->getOption(constantSweepOptionName).getArgumentByName("values").getValueAsString();
+                boost::split(definitionStrings, sweepString, boost::is_any_of(";"));
+                return definitionStrings;
+            }
+
             bool IOSettings::isJaniPropertiesSet() const {
                 return this->getOption(janiPropertyOptionName).getHasOptionBeenSet();
             }
@@ -326,6 +357,18 @@ namespace storm {
                 return this->getOption(expectedVisitingTimesOptionName).getHasOptionBeenSet();
             }
             
+            bool IOSettings::isTimeBoundsSet() const {
+                return this->getOption(timeBoundsOptionName).getHasOptionBeenSet();
+            }
+            
+            std::vector<double> IOSettings::getTimeBounds() const {
+                std::vector<double> result;
+                for (auto const& bound : storm::parser::parseCommaSeperatedValues(this->getOption(timeBoundsOptionName).getArgumentByName("bounds").getValueAsString())) {
+                    result.push_back(storm::utility::convertNumber<double>(bound));
+                }
+                return result;
+            }
+            
             bool IOSettings::isQvbsInputSet() const {
                 return this->getOption(qvbsInputOptionName).getHasOptionBeenSet();
             }
@@ -380,6 +423,7 @@ namespace storm {
                 // Ensure that not two explicit input models were given.
                 uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
                 numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+                numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
                 numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
                 STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -389,6 +433,9 @@ namespace storm {
                 // Make sure PRISM-to-JANI conversion is only set if the actual input is in PRISM format.
                 STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException, "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
                 
+                // A constant sweep requires a symbolic model.
+                STORM_LOG_THROW(!isConstantSweepSet() || numSymbolicInputs == 1, storm::exceptions::InvalidSettingsException, "A constant sweep requires the model to be given in a symbolic format (PRISM or JANI).");
+                
                 return true;
             }
 
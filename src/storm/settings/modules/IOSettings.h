@@ -174,6 +174,20 @@ namespace storm {
                  */
                 bool isExplicitExportPlaceholdersDisabled() const;
                 
+                /*!
+                 * Retrieves whether the explicit option with the binary format was set.
+                 *
+                 * @return True if the explicit option with the binary format was set.
+                 */
+                bool isExplicitBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the file that contains the model.
+                 */
+                std::string getExplicitBinaryFilename() const;
+
                 /*!
                  * Retrieves whether the explicit option with IMCA was set.
                  *
@@ -291,6 +305,20 @@ namespace storm {
                  */
                 std::string getConstantDefinitionString() const;
 
+                /*!
+                 * Retrieves whether the constant sweep option was set.
+                 *
+                 * @return True if the constant sweep option was set.
+                 */
+                bool isConstantSweepSet() const;
+
+                /*!
+                 * Retrieves the strings that define the (remaining) undefined constants for each model of the constant sweep.
+                 *
+                 * @return The strings that define the constants, one for each model.
+                 */
+                std::vector<std::string> getConstantSweepDefinitionStrings() const;
+
                 /*!
                  * Retrieves whether the jani-property option was set
                  * @return
@@ -339,6 +367,16 @@ namespace storm {
                  */
                 bool isComputeExpectedVisitingTimesSet() const;
                 
+                /*!
+                 * Retrieves whether properties are to be checked for several time bounds.
+                 */
+                bool isTimeBoundsSet() const;
+                
+                /*!
+                 * Retrieves the time bounds for which properties are to be checked.
+                 */
+                std::vector<double> getTimeBounds() const;
+                
                 /*!
                  * Retrieves whether the input model is to be read from the quantitative verification benchmark set (QVBS)
                  */
@@ -391,6 +429,7 @@ namespace storm {
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
                 static const std::string prismInputOptionName;
@@ -401,12 +440,14 @@ namespace storm {
                 static const std::string choiceLabelingOptionName;
                 static const std::string constantsOptionName;
                 static const std::string constantsOptionShortName;
+                static const std::string constantSweepOptionName;
                 static const std::string janiPropertyOptionName;
                 static const std::string janiPropertyOptionShortName;
                 static const std::string propertyOptionName;
                 static const std::string propertyOptionShortName;
                 static const std::string steadyStateDistrOptionName;
                 static const std::string expectedVisitingTimesOptionName;
+                static const std::string timeBoundsOptionName;
                 static const std::string qvbsInputOptionName;
                 static const std::string qvbsInputOptionShortName;
                 static const std::string qvbsRootOptionName;
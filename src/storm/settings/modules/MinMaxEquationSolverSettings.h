@@ -95,6 +95,16 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether value and interval iteration shall start with reduced precision iterations.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves the difference between two reduced precision iterates at which full precision is used.
+                 */
+                double getMixedPrecisionSwitchThreshold() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +116,7 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string mixedPrecisionOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -15,10 +15,12 @@ namespace storm {
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
             const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+            const std::string ModelCheckerSettings::analysisCacheOptionName = "analysiscache";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daToolOptionName, false, "If set, use an external tool to convert LTL formulas to state-based deterministic automata in HOA format").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "A script that can be called with a prefix formula and a name for the output automaton.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheOptionName, false, "Sets the memory (in MB) that the sparse engine may use to cache the graph analysis and the equation systems of until properties, such that properties sharing their phi and psi states can reuse them. The cache is disabled by default (size 0).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The size in MB.").setDefaultValueUnsignedInteger(0).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -32,6 +34,10 @@ namespace storm {
             std::string ModelCheckerSettings::getLtl2daTool() const {
                 return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
             }
+
+            uint64_t ModelCheckerSettings::getAnalysisCacheSize() const {
+                return this->getOption(analysisCacheOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
             
         } // namespace modules
     } // namespace settings
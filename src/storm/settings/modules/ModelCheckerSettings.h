@@ -36,6 +36,13 @@ namespace storm {
                  */
                 std::string getLtl2daTool() const;
 
+                /*!
+                 * Retrieves the memory (in MB) that may be used to cache the analysis results of until properties.
+                 *
+                 * @return The size of the cache in MB (0 if caching is disabled).
+                 */
+                uint64_t getAnalysisCacheSize() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -43,6 +50,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
                 static const std::string ltl2daToolOptionName;
+                static const std::string analysisCacheOptionName;
             };
 
         } // namespace modules
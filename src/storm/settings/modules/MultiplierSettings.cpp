@@ -13,12 +13,19 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::structureOfArraysOptionName = "soa";
+            const std::string MultiplierSettings::simdOptionName = "simd";
+            const std::string MultiplierSettings::multicolorOptionName = "multicolor";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
-                this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
+                this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred. If no type is given, the native multiplier is selected if --threads is larger than one or another option of this module is set, as only the native multiplier supports them.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
-                
+                this->addOption(storm::settings::OptionBuilder(moduleName, structureOfArraysOptionName, false, "If set, the native multiplier stores column indices and values of the matrix in separate arrays (using 32-bit column indices if possible). The arrays are stored in addition to the matrix unless the matrix is only used by the multiplier.").setIsAdvanced().build());
+                std::vector<std::string> instructionSets = {"none", "auto", "avx2", "avx512"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, simdOptionName, false, "Sets which instruction set the native multiplier uses for vectorized matrix-vector multiplications. Implies structure-of-arrays layout (see option 'soa').").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the instruction set. 'auto' selects the best one supported by the processor.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(instructionSets)).setDefaultValueString("none").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, multicolorOptionName, false, "If set, Gauss-Seidel style multiplications (and SOR) visit the rows in a multicolor order such that rows of the same color can be processed in parallel (see --threads).").setIsAdvanced().build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -35,6 +42,28 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isStructureOfArraysSet() const {
+                return this->getOption(structureOfArraysOptionName).getHasOptionBeenSet();
+            }
+            
+            storm::utility::simd::InstructionSet MultiplierSettings::getInstructionSet() const {
+                std::string instructionSet = this->getOption(simdOptionName).getArgumentByName("name").getValueAsString();
+                if (instructionSet == "none") {
+                    return storm::utility::simd::InstructionSet::Scalar;
+                } else if (instructionSet == "auto") {
+                    return storm::utility::simd::getBestSupportedInstructionSet();
+                } else if (instructionSet == "avx2") {
+                    return storm::utility::simd::InstructionSet::Avx2;
+                } else if (instructionSet == "avx512") {
+                    return storm::utility::simd::InstructionSet::Avx512;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown instruction set '" << instructionSet << "'.");
+            }
+            
+            bool MultiplierSettings::isMulticolorGaussSeidelSet() const {
+                return this->getOption(multicolorOptionName).getHasOptionBeenSet();
+            }
         }
     }
 }
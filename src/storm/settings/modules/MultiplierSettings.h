@@ -5,6 +5,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace settings {
@@ -22,11 +23,30 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether the native multiplier is to store the matrix in structure-of-arrays layout.
+                 */
+                bool isStructureOfArraysSet() const;
+                
+                /*!
+                 * Retrieves the instruction set that the native multiplier is to use for vectorized multiplications.
+                 * If the selection was 'auto', the best instruction set supported by the processor is returned.
+                 */
+                storm::utility::simd::InstructionSet getInstructionSet() const;
+                
+                /*!
+                 * Retrieves whether Gauss-Seidel style multiplications are to visit the rows in a multicolor order.
+                 */
+                bool isMulticolorGaussSeidelSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string structureOfArraysOptionName;
+                static const std::string simdOptionName;
+                static const std::string multicolorOptionName;
             };
             
         }
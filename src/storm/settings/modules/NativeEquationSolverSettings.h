@@ -109,6 +109,16 @@ namespace storm {
                  * Retrieves whether the  force bounds option has been set.
                  */
                 bool isForceBoundsSet() const;
+                
+                /*!
+                 * Retrieves whether the power method and interval iteration shall start with reduced precision iterations.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves the difference between two reduced precision iterates at which full precision is used.
+                 */
+                double getMixedPrecisionSwitchThreshold() const;
                
                 bool check() const override;
                 
@@ -126,6 +136,7 @@ namespace storm {
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
                 static const std::string forceBoundsOptionName;
+                static const std::string mixedPrecisionOptionName;
 
             };
             
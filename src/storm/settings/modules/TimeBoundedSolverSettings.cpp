@@ -13,6 +13,7 @@ namespace storm {
             const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
             
             const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+            const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
             const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
             const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
             const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
@@ -21,6 +22,9 @@ namespace storm {
                 std::vector<std::string> maMethods = {"imca", "unifplus"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, maMethodOptionName, false, "The method to use to solve bounded reachability queries on MAs.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(maMethods)).setDefaultValueString("unifplus").build()).build());
                 
+                std::vector<std::string> ctmcMethods = {"unif", "krylov"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false, "The method to use to compute transient probabilities of CTMCs. Krylov subspace methods are well-suited for stiff models with widely differing rates.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods)).setDefaultValueString("unif").build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
@@ -49,6 +53,14 @@ namespace storm {
                 return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
             }
             
+            storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+                std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+                if (techniqueAsString == "krylov") {
+                    return storm::solver::CtmcTransientMethod::Krylov;
+                }
+                return storm::solver::CtmcTransientMethod::Uniformization;
+            }
+            
             bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
                 return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
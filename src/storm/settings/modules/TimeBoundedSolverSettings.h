@@ -27,6 +27,11 @@ namespace storm {
                  */
                 storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
                 
+                /*!
+                 * Retrieves the selected technique for computing transient probabilities of CTMCs.
+                 */
+                storm::solver::CtmcTransientMethod getCtmcMethod() const;
+                
                 /*!
                  * Retrieves whether the precision has been set.
                  *
@@ -56,6 +61,7 @@ namespace storm {
                 
             private:
                 static const std::string maMethodOptionName;
+                static const std::string ctmcMethodOptionName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string unifPlusKappaOptionName;
@@ -4,6 +4,7 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/utility/ConstantsComparator.h"
@@ -313,7 +314,7 @@ namespace storm {
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             uint64_t iterations = currentIterations;
 
-            SolverStatus status = SolverStatus::InProgress;
+            SolverStatus status = iterations < maximalNumberOfIterations ? SolverStatus::InProgress : SolverStatus::MaximalIterationsExceeded;
             while (status == SolverStatus::InProgress) {
                 // Compute x' = min/max(A*x + b).
                 if (useGaussSeidelMultiplication) {
@@ -403,7 +404,7 @@ namespace storm {
 
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->initializeSchedulerChoices(this->A->getRowGroupCount());
                 this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
 
@@ -414,6 +415,44 @@ namespace storm {
             return statusIters.first == SolverStatus::Converged || statusIters.first == SolverStatus::TerminatedEarly;
         }
 
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::performMixedPrecisionIterations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, SolverGuarantee const& guarantee, uint64_t& iterations) const {
+            uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+            if (iterations >= maxIter) {
+                return false;
+            }
+            if (!mixedPrecisionHelper) {
+                mixedPrecisionHelper = std::make_unique<storm::solver::helper::MixedPrecisionHelper<ValueType>>(*this->A);
+            }
+            
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            ValueType switchThreshold = storm::utility::max(storm::utility::convertNumber<ValueType>(env.solver().minMax().getMixedPrecisionSwitchThreshold()), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+            std::vector<ValueType> candidate = x;
+            iterations += mixedPrecisionHelper->performIterations(dir, candidate, b, switchThreshold, relative, maxIter - iterations, env.solver().multiplier().getNumberOfThreads());
+            
+            if (guarantee != SolverGuarantee::None) {
+                // The reduced precision iterates might have overshot the solution, so we move the candidate away from the
+                // solution and check in full precision whether it is still a pre-fixpoint (post-fixpoint). Since the
+                // maximum (minimum) of two pre-fixpoints (post-fixpoints) is again one, we can keep the initial bounds.
+                bool lessOrEqual = guarantee == SolverGuarantee::LessOrEqual;
+                auto xIt = x.begin();
+                for (auto& value : candidate) {
+                    ValueType offset = relative ? switchThreshold * storm::utility::max(storm::utility::abs(value), storm::utility::one<ValueType>()) : switchThreshold;
+                    value = lessOrEqual ? storm::utility::max(*xIt, value - offset) : storm::utility::min(*xIt, value + offset);
+                    ++xIt;
+                }
+                std::vector<ValueType> image(candidate.size());
+                this->multiplierA->multiplyAndReduce(env, dir, candidate, &b, image);
+                bool verified = lessOrEqual ? storm::utility::vector::compareElementWise(candidate, image, std::less_equal<ValueType>()) : storm::utility::vector::compareElementWise(candidate, image, std::greater_equal<ValueType>());
+                if (!verified) {
+                    STORM_LOG_INFO("Discarding the result of the reduced precision iterations as it could not be verified to be a " << (lessOrEqual ? "lower" : "upper") << " bound.");
+                    return false;
+                }
+            }
+            x = std::move(candidate);
+            return true;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
@@ -474,22 +513,29 @@ namespace storm {
                 }
             }
 
+            // Approach the solution with reduced precision first. Results that come with a guarantee can only be
+            // verified if the solution is unique.
+            uint64_t reducedPrecisionIterations = 0;
+            if (env.solver().minMax().isMixedPrecisionSet() && (guarantee == SolverGuarantee::None || this->hasUniqueSolution())) {
+                performMixedPrecisionIterations(env, dir, x, b, guarantee, reducedPrecisionIterations);
+            }
+            
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
             
             this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, reducedPrecisionIterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
                 std::swap(x, *currentX);
             }
             
-            this->reportStatus(result.status, result.iterations);
+            this->reportStatus(result.status, reducedPrecisionIterations + result.iterations);
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->initializeSchedulerChoices(this->A->getRowGroupCount());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
             
@@ -532,6 +578,13 @@ namespace storm {
             this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
+            // Tighten both bounds with reduced precision iterations, where only verified bounds are kept.
+            uint64_t iterations = 0;
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                performMixedPrecisionIterations(env, dir, *lowerX, b, SolverGuarantee::LessOrEqual, iterations);
+                performMixedPrecisionIterations(env, dir, *upperX, b, SolverGuarantee::GreaterOrEqual, iterations);
+            }
+            
             std::vector<ValueType>* tmp = nullptr;
             if (!useGaussSeidelMultiplication) {
                 auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
@@ -539,9 +592,7 @@ namespace storm {
             }
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
-            uint64_t iterations = 0;
-            
-            SolverStatus status = SolverStatus::InProgress;
+            SolverStatus status = iterations < env.solver().minMax().getMaximalNumberOfIterations() ? SolverStatus::InProgress : SolverStatus::MaximalIterationsExceeded;
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues() && !env.solver().minMax().isSymmetricUpdatesSet();
             std::vector<ValueType> oldValues;
@@ -674,7 +725,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->initializeSchedulerChoices(this->A->getRowGroupCount());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
             
@@ -735,7 +786,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->initializeSchedulerChoices(this->A->getRowGroupCount());
                 this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
 
@@ -1085,6 +1136,7 @@ namespace storm {
             auxiliaryRowGroupVector2.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
+            mixedPrecisionHelper.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
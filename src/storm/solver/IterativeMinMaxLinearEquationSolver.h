@@ -6,6 +6,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
@@ -76,6 +77,18 @@ namespace storm {
             
             ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t  maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
+            /*!
+             * Iterates on the given vector with reduced precision until the switch threshold of the environment is met.
+             * If a guarantee is given, the vector is only replaced if the result (shifted by the switch threshold) is
+             * verified in full precision to retain the guarantee, i.e., x <= F(x) for LessOrEqual and x >= F(x) for
+             * GreaterOrEqual, where F is the value iteration operator.
+             *
+             * @param iterations The number of iterations performed so far. It is increased by the number of reduced precision
+             * iterations, which are bounded such that the total does not exceed the maximal number of iterations.
+             * @return True iff the given vector was replaced.
+             */
+            bool performMixedPrecisionIterations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, SolverGuarantee const& guarantee, uint64_t& iterations) const;
+            
             void createLinearEquationSolver(Environment const& env) const;
             
             /// The factory used to obtain linear equation solvers.
@@ -87,6 +100,7 @@ namespace storm {
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::MixedPrecisionHelper<ValueType>> mixedPrecisionHelper;
             
         };
         
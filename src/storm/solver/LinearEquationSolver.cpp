@@ -16,6 +16,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
 namespace storm {
@@ -31,6 +32,26 @@ namespace storm {
             return this->internalSolveEquations(env, x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+            if (x.empty()) {
+                return true;
+            } else if (x.size() == 1) {
+                return this->internalSolveEquations(env, x.front(), b.front());
+            }
+            return this->internalSolveMultipleEquations(env, x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            bool result = true;
+            for (uint64_t index = 0; index < x.size(); ++index) {
+                result &= this->internalSolveEquations(env, x[index], b[index]);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
             return LinearEquationSolverRequirements();
@@ -47,6 +47,20 @@ namespace storm {
              * @return true
              */
             bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Solves the equation system (in the format expected by the solver) for several right-hand sides at once,
+             * i.e., it computes the solution x[j] for the right-hand side b[j] for each j. Solvers may exploit that the
+             * matrix is shared among the systems, e.g., by iterating on all solution vectors simultaneously. Note that
+             * custom termination conditions and bounds have to be valid for all of the systems.
+             *
+             * @param x The solution vectors that have to be computed. Their number must be equal to the number of
+             * right-hand sides and their lengths must be equal to the number of rows of A.
+             * @param b The right-hand sides. Their lengths must be equal to the number of rows of A.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
 
             /*!
              * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
@@ -78,6 +92,11 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides. By default, the systems are solved one after another.
+             */
+            virtual bool internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
@@ -141,6 +141,20 @@ namespace storm {
             return initialScheduler.get();
         }
         
+        template<typename ValueType>
+        void MinMaxLinearEquationSolver<ValueType>::clearInitialScheduler() {
+            initialScheduler = boost::none;
+        }
+        
+        template<typename ValueType>
+        void MinMaxLinearEquationSolver<ValueType>::initializeSchedulerChoices(uint64_t numberOfRowGroups) const {
+            if (schedulerChoices) {
+                schedulerChoices->assign(numberOfRowGroups, 0);
+            } else {
+                schedulerChoices = std::vector<uint_fast64_t>(numberOfRowGroups);
+            }
+        }
+        
         template<typename ValueType>
         MinMaxLinearEquationSolverRequirements MinMaxLinearEquationSolver<ValueType>::getRequirements(Environment const&, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
             return MinMaxLinearEquationSolverRequirements();
@@ -157,6 +157,11 @@ namespace storm {
              */
             std::vector<uint_fast64_t> const& getInitialScheduler() const;
             
+            /*!
+             * Removes the initial scheduler (if one was set).
+             */
+            void clearInitialScheduler();
+            
             /*!
              * Retrieves the requirements of this solver for solving equations with the current settings. The requirements
              * are guaranteed to be ordered according to their appearance in the SolverRequirement type.
@@ -176,6 +181,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Sets the scheduler choices to a vector of zeros with the given size. Storage of previously computed
+             * choices is reused.
+             */
+            void initializeSchedulerChoices(uint64_t numberOfRowGroups) const;
                         
             /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
             OptimizationDirectionSetting direction;
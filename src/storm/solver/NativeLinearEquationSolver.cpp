@@ -3,6 +3,7 @@
 #include <limits>
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -12,6 +13,7 @@
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/MulticolorOrdering.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -63,13 +65,26 @@ namespace storm {
             uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             bool relative = env.solver().native().getRelativeTerminationCriterion();
             
+            // If requested, visit the rows in a multicolor order to process the rows of each color in parallel.
+            bool useMulticolorOrdering = env.solver().multiplier().isMulticolorGaussSeidelSet();
+            // Exact number types are not thread-safe.
+            uint64_t numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : env.solver().multiplier().getNumberOfThreads();
+            if (useMulticolorOrdering && !multicolorOrdering) {
+                multicolorOrdering = std::make_unique<storm::storage::MulticolorOrdering>(*A);
+                STORM_LOG_INFO("Using a multicolor ordering with " << multicolorOrdering->getNumberOfColors() << " colors.");
+            }
+            
             // Set up additional environment variables.
             uint_fast64_t iterations = 0;
             SolverStatus status = SolverStatus::InProgress;
             
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
-                A->performSuccessiveOverRelaxationStep(omega, x, b);
+                if (useMulticolorOrdering) {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b, *multicolorOrdering, numberOfThreads);
+                } else {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b);
+                }
                 
                 // Now check if the process already converged within our precision.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
@@ -315,7 +330,7 @@ namespace storm {
             bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
             
             uint64_t iterations = currentIterations;
-            SolverStatus status = this->terminateNow(*currentX, guarantee) ? SolverStatus::TerminatedEarly : SolverStatus::InProgress;
+            SolverStatus status = this->terminateNow(*currentX, guarantee) ? SolverStatus::TerminatedEarly : (iterations < maxIterations ? SolverStatus::InProgress : SolverStatus::MaximalIterationsExceeded);
             while (status == SolverStatus::InProgress && iterations < maxIterations) {
                 if (useGaussSeidelMultiplication) {
                     *newX = *currentX;
@@ -342,6 +357,42 @@ namespace storm {
             return PowerIterationResult(iterations - currentIterations, status);
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::performMixedPrecisionIterations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, SolverGuarantee const& guarantee, uint64_t& iterations) const {
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            if (iterations >= maxIter) {
+                return false;
+            }
+            if (!mixedPrecisionHelper) {
+                mixedPrecisionHelper = std::make_unique<storm::solver::helper::MixedPrecisionHelper<ValueType>>(*A);
+            }
+            
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            ValueType switchThreshold = storm::utility::max(storm::utility::convertNumber<ValueType>(env.solver().native().getMixedPrecisionSwitchThreshold()), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
+            std::vector<ValueType> candidate = x;
+            iterations += mixedPrecisionHelper->performIterations(boost::none, candidate, b, switchThreshold, relative, maxIter - iterations, env.solver().multiplier().getNumberOfThreads());
+            
+            if (guarantee != SolverGuarantee::None) {
+                // Move the candidate away from the solution and verify in full precision that the guarantee still holds.
+                bool lessOrEqual = guarantee == SolverGuarantee::LessOrEqual;
+                auto xIt = x.begin();
+                for (auto& value : candidate) {
+                    ValueType offset = relative ? switchThreshold * storm::utility::max(storm::utility::abs(value), storm::utility::one<ValueType>()) : switchThreshold;
+                    value = lessOrEqual ? storm::utility::max(*xIt, value - offset) : storm::utility::min(*xIt, value + offset);
+                    ++xIt;
+                }
+                std::vector<ValueType> image(candidate.size());
+                this->multiplier->multiply(env, candidate, &b, image);
+                bool verified = lessOrEqual ? storm::utility::vector::compareElementWise(candidate, image, std::less_equal<ValueType>()) : storm::utility::vector::compareElementWise(candidate, image, std::greater_equal<ValueType>());
+                if (!verified) {
+                    STORM_LOG_INFO("Discarding the result of the reduced precision iterations as it could not be verified to be a " << (lessOrEqual ? "lower" : "upper") << " bound.");
+                    return false;
+                }
+            }
+            x = std::move(candidate);
+            return true;
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
@@ -364,12 +415,16 @@ namespace storm {
                     guarantee = SolverGuarantee::GreaterOrEqual;
                 }
             }
+            uint64_t reducedPrecisionIterations = 0;
+            if (env.solver().native().isMixedPrecisionSet()) {
+                performMixedPrecisionIterations(env, x, b, guarantee, reducedPrecisionIterations);
+            }
             std::vector<ValueType>* newX = this->cachedRowVector.get();
             
             // Forward call to power iteration implementation.
             this->startMeasureProgress();
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+            PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, reducedPrecisionIterations, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
 
             // Swap the result in place.
             if (currentX == this->cachedRowVector.get()) {
@@ -380,11 +435,146 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, result.iterations);
+            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, reducedPrecisionIterations + result.iterations);
 
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        std::vector<ValueType> interleaveVectors(std::vector<std::vector<ValueType>> const& vectors) {
+            uint64_t numberOfVectors = vectors.size();
+            std::vector<ValueType> result(vectors.front().size() * numberOfVectors);
+            for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                auto resultIt = result.begin() + vectorIndex;
+                for (auto const& value : vectors[vectorIndex]) {
+                    *resultIt = value;
+                    resultIt += numberOfVectors;
+                }
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        void deinterleaveVectors(std::vector<ValueType> const& interleavedVectors, std::vector<std::vector<ValueType>>& vectors) {
+            uint64_t numberOfVectors = vectors.size();
+            for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                auto interleavedIt = interleavedVectors.begin() + vectorIndex;
+                for (auto& value : vectors[vectorIndex]) {
+                    value = *interleavedIt;
+                    interleavedIt += numberOfVectors;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveMultipleEquationsJacobi(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t numberOfSystems = x.size();
+            STORM_LOG_INFO("Solving " << numberOfSystems << " linear equation systems (" << getMatrixRowCount() << " rows) simultaneously with NativeLinearEquationSolver (Jacobi)");
+            
+            // Get a Jacobi decomposition of the matrix A.
+            if (!jacobiDecomposition) {
+                jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, *A);
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            
+            std::vector<ValueType> currentX = interleaveVectors(x);
+            std::vector<ValueType> interleavedB = interleaveVectors(b);
+            std::vector<ValueType> nextX(currentX.size());
+            
+            uint_fast64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                // Compute D^-1 * (b - LU * x) for all systems and store the result in nextX.
+                jacobiDecomposition->multiplier->multiplyInterleaved(env, currentX, nullptr, nextX, numberOfSystems);
+                auto nextXIt = nextX.begin();
+                auto bIt = interleavedB.begin();
+                for (auto const& diagonalValue : jacobiDecomposition->DVector) {
+                    for (uint64_t system = 0; system < numberOfSystems; ++system, ++nextXIt, ++bIt) {
+                        *nextXIt = diagonalValue * (*bIt - *nextXIt);
+                    }
+                }
+                
+                // As the criterion is checked entry-wise, all systems have converged once the blocks are close enough.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, nextX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                std::swap(nextX, currentX);
+                
+                this->showProgressIterative(iterations);
+                ++iterations;
+                
+                status = this->updateStatus(status, false, iterations, maxIter);
+            }
+            
+            deinterleaveVectors(currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveMultipleEquationsPower(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t numberOfSystems = x.size();
+            STORM_LOG_INFO("Solving " << numberOfSystems << " linear equation systems (" << getMatrixRowCount() << " rows) simultaneously with NativeLinearEquationSolver (Power)");
+            
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            
+            std::vector<ValueType> currentX = interleaveVectors(x);
+            std::vector<ValueType> interleavedB = interleaveVectors(b);
+            std::vector<ValueType> newX(currentX.size());
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                if (useGaussSeidelMultiplication) {
+                    newX = currentX;
+                    this->multiplier->multiplyInterleavedGaussSeidel(env, newX, &interleavedB, numberOfSystems);
+                } else {
+                    this->multiplier->multiplyInterleaved(env, currentX, &interleavedB, newX, numberOfSystems);
+                }
+                
+                // As the criterion is checked entry-wise, all systems have converged once the blocks are close enough.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                std::swap(currentX, newX);
+                ++iterations;
+                
+                status = this->updateStatus(status, false, iterations, maxIter);
+                
+                this->showProgressIterative(iterations);
+            }
+            
+            deinterleaveVectors(currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(status == SolverStatus::Converged, false, iterations);
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -430,9 +620,16 @@ namespace storm {
             if (!this->multiplier) {
                 this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
             }
-
-            SolverStatus status = SolverStatus::InProgress;
+            
+            // Tighten both bounds with reduced precision iterations, where only verified bounds are kept.
             uint64_t iterations = 0;
+            if (env.solver().native().isMixedPrecisionSet()) {
+                performMixedPrecisionIterations(env, *lowerX, b, SolverGuarantee::LessOrEqual, iterations);
+                performMixedPrecisionIterations(env, *upperX, b, SolverGuarantee::GreaterOrEqual, iterations);
+            }
+
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            SolverStatus status = iterations < maxIter ? SolverStatus::InProgress : SolverStatus::MaximalIterationsExceeded;
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues() && !env.solver().native().isSymmetricUpdatesSet();
             std::vector<ValueType> oldValues;
@@ -446,7 +643,6 @@ namespace storm {
             if (!relative) {
                 precision *= storm::utility::convertNumber<ValueType>(2.0);
             }
-            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
                 // Remember in which directions we took steps in this iteration.
@@ -999,6 +1195,21 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Termination conditions and mixed precision iterations refer to a single solution vector, so these cases
+            // are handled by solving the systems one after another.
+            if (!this->hasCustomTerminationCondition() && !env.solver().native().isMixedPrecisionSet()) {
+                auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+                if (method == NativeLinearEquationSolverMethod::Jacobi) {
+                    return this->solveMultipleEquationsJacobi(env, x, b);
+                } else if (method == NativeLinearEquationSolverMethod::Power) {
+                    return this->solveMultipleEquationsPower(env, x, b);
+                }
+            }
+            return LinearEquationSolver<ValueType>::internalSolveMultipleEquations(env, x, b);
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
@@ -1026,11 +1237,13 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
+            multicolorOrdering.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
             multiplier.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
+            mixedPrecisionHelper.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
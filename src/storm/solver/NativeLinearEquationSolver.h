@@ -7,6 +7,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
@@ -39,6 +40,7 @@ namespace storm {
 
         protected:
             virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveMultipleEquations(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
             
         private:
             struct PowerIterationResult {
@@ -55,6 +57,17 @@ namespace storm {
             
             PowerIterationResult performPowerIteration(Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maxIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
+            /*!
+             * Iterates on the given vector with reduced precision until the switch threshold of the environment is met.
+             * If a guarantee is given, the vector is only replaced if the (shifted) result is verified in full precision
+             * to satisfy x <= A*x + b (LessOrEqual) or x >= A*x + b (GreaterOrEqual).
+             *
+             * @param iterations The number of iterations performed so far. It is increased by the number of reduced precision
+             * iterations, which are bounded such that the total does not exceed the maximal number of iterations.
+             * @return True iff the given vector was replaced.
+             */
+            bool performMixedPrecisionIterations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, SolverGuarantee const& guarantee, uint64_t& iterations) const;
+            
             void logIterations(bool converged, bool terminate, uint64_t iterations) const;
             
             virtual uint64_t getMatrixRowCount() const override;
@@ -70,6 +83,13 @@ namespace storm {
             virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Variants of the Jacobi and the power method that iterate on the (interleaved) solution vectors of several
+             * right-hand sides simultaneously, such that each matrix entry is only loaded once per iteration.
+             */
+            bool solveMultipleEquationsJacobi(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+            bool solveMultipleEquationsPower(storm::Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -98,6 +118,7 @@ namespace storm {
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2; // A.getRowCount() rows
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::MixedPrecisionHelper<ValueType>> mixedPrecisionHelper;
             
             struct JacobiDecomposition {
                 JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
@@ -108,6 +129,9 @@ namespace storm {
             };
             mutable std::unique_ptr<JacobiDecomposition> jacobiDecomposition;
             
+            // A multicolor ordering of the rows for parallel SOR steps.
+            mutable std::unique_ptr<storm::storage::MulticolorOrdering> multicolorOrdering;
+            
             struct WalkerChaeData {
                 WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB);
                 
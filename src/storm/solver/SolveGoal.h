@@ -92,20 +92,34 @@ namespace storm {
             boost::optional<storm::storage::BitVector> relevantValueVector;
         };
         
-        template<typename ValueType, typename MatrixType>
-        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureMinMaxLinearEquationSolver(Environment const& env, SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& factory, MatrixType&& matrix) {
-            std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = factory.create(env, std::forward<MatrixType>(matrix));
-            solver->setOptimizationDirection(goal.direction());
+        /*!
+         * Configures the given solver according to the given goal, i.e., sets the optimization direction, the relevant
+         * values and (if the goal is bounded) a suitable termination condition. Relevant values and termination
+         * conditions of previous goals are removed.
+         */
+        template<typename ValueType>
+        void configureMinMaxLinearEquationSolver(SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolver<ValueType>& solver) {
+            solver.setOptimizationDirection(goal.direction());
             if (goal.isBounded()) {
                 if (goal.boundIsALowerBound()) {
-                    solver->setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumExceedsThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(), goal.thresholdValue(), true));
+                    solver.setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumExceedsThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(), goal.thresholdValue(), true));
                 } else {
-                    solver->setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumBelowThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(), goal.thresholdValue(), false));
+                    solver.setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumBelowThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(), goal.thresholdValue(), false));
                 }
+            } else {
+                solver.resetTerminationCondition();
             }
             if (goal.hasRelevantValues()) {
-                solver->setRelevantValues(std::move(goal.relevantValues()));
+                solver.setRelevantValues(std::move(goal.relevantValues()));
+            } else {
+                solver.clearRelevantValues();
             }
+        }
+        
+        template<typename ValueType, typename MatrixType>
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureMinMaxLinearEquationSolver(Environment const& env, SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& factory, MatrixType&& matrix) {
+            std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = factory.create(env, std::forward<MatrixType>(matrix));
+            configureMinMaxLinearEquationSolver(std::move(goal), *solver);
             return solver;
         }
         
@@ -74,6 +74,16 @@ namespace storm {
             return "invalid";
         }
         
+        std::string toString(CtmcTransientMethod m) {
+            switch(m) {
+                case CtmcTransientMethod::Uniformization:
+                    return "unif";
+                case CtmcTransientMethod::Krylov:
+                    return "krylov";
+            }
+            return "invalid";
+        }
+        
         std::string toString(LpSolverType t) {
             switch(t) {
                 case LpSolverType::Gurobi:
@@ -11,6 +11,7 @@ namespace storm {
         ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
         ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+        ExtendEnumsWithSelectionField(CtmcTransientMethod, Uniformization, Krylov)
 
         ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3)
         ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
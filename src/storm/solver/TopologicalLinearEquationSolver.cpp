@@ -1,6 +1,9 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/solver/helper/ParallelSccSchedule.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -10,6 +13,11 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/NumberTraits.h"
+
+#include <atomic>
+#include <mutex>
 
 namespace storm {
     namespace solver {
@@ -55,16 +63,27 @@ namespace storm {
             return subEnv;
         }
 
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::canSolveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const {
+            // Exact numbers may share (reference counted) state that is not thread-safe. The same holds for the rational
+            // numbers used by rational search. Solvers of other libraries are not necessarily thread-safe.
+            return numberOfThreads > 1 && !storm::NumberTraits<ValueType>::IsExact && sccSolverEnvironment.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native && sccSolverEnvironment.solver().native().getMethod() != storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+        }
+        
         template<typename ValueType>
         bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             
             // For sound computations we need to increase the precision in each SCC
             bool needAdaptPrecision = env.solver().isForceSoundness() && env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
             
-            if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+            // SCCs of equal depth can be solved concurrently.
+            bool solveInParallel = canSolveSccsInParallel(getEnvironmentForUnderlyingSolver(env), env.solver().topological().getNumberOfThreads());
+            bool needSccDepths = needAdaptPrecision || solveInParallel;
+            
+            if (!this->sortedSccDecomposition || (needSccDepths && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(needSccDepths, env.solver().topological().getNumberOfThreads());
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->getMatrixRowCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -82,6 +101,8 @@ namespace storm {
             bool returnValue = true;
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            } else if (solveInParallel) {
+                returnValue = solveSccsInParallel(sccSolverEnvironment, env.solver().topological().getNumberOfThreads(), x, b);
             } else {
                 // Solve each SCC individually
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
@@ -97,7 +118,7 @@ namespace storm {
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
                     }
                     ++sccIndex;
                     progress.updateProgress(sccIndex);
@@ -119,9 +140,85 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->parallelSccSchedule) {
+                // Trivial SCCs are cheap, so we only start a new batch once the current one has enough states.
+                this->parallelSccSchedule = std::make_unique<helper::ParallelSccSchedule>(*this->sortedSccDecomposition, 1024);
+            }
+            auto const& schedule = *this->parallelSccSchedule;
+            STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << schedule.getNumberOfLevels() << " levels using " << numberOfThreads << " threads.");
+            
+            // If a level consists of several batches, the batches are already solved concurrently, so the solvers
+            // of the individual SCCs should not spawn further threads.
+            storm::Environment batchSolverEnvironment(sccSolverEnvironment);
+            batchSolverEnvironment.solver().multiplier().setNumberOfThreads(1);
+            
+            // The matrix creates its (trivial) row grouping on demand, which must not happen concurrently.
+            this->A->getRowGroupIndices();
+            
+            // The SCC solvers are shared among the batches, where each solver is used by one batch at a time.
+            std::mutex sccSolversMutex;
+            std::atomic<bool> returnValue(true);
+            auto solveBatch = [&] (storm::Environment const& batchEnvironment, uint64_t batch) {
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> batchSolver;
+                storm::storage::BitVector sccAsBitVector;
+                for (uint64_t const* sccIt = schedule.batchBegin(batch); sccIt != schedule.batchEnd(batch); ++sccIt) {
+                    auto const& scc = (*this->sortedSccDecomposition)[*sccIt];
+                    bool sccResult;
+                    if (scc.size() == 1) {
+                        sccResult = solveTrivialScc(*scc.begin(), x, b);
+                    } else {
+                        if (sccAsBitVector.size() == 0) {
+                            sccAsBitVector.resize(x.size());
+                            std::lock_guard<std::mutex> lock(sccSolversMutex);
+                            if (!this->idleSccSolvers.empty()) {
+                                batchSolver = std::move(this->idleSccSolvers.back());
+                                this->idleSccSolvers.pop_back();
+                            }
+                        } else {
+                            sccAsBitVector.clear();
+                        }
+                        for (auto const& state : scc) {
+                            sccAsBitVector.set(state, true);
+                        }
+                        sccResult = solveScc(batchEnvironment, batchSolver, sccAsBitVector, x, b);
+                    }
+                    if (!sccResult) {
+                        returnValue = false;
+                    }
+                }
+                if (batchSolver) {
+                    std::lock_guard<std::mutex> lock(sccSolversMutex);
+                    this->idleSccSolvers.push_back(std::move(batchSolver));
+                }
+            };
+            
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("SCCs");
+            progress.setMaxCount(this->sortedSccDecomposition->size());
+            progress.startNewMeasurement(0);
+            for (uint64_t level = 0; level < schedule.getNumberOfLevels(); ++level) {
+                uint64_t const firstBatch = schedule.getFirstBatch(level);
+                uint64_t const numberOfBatches = schedule.getNumberOfBatches(level);
+                if (numberOfBatches == 1) {
+                    solveBatch(sccSolverEnvironment, firstBatch);
+                } else {
+                    storm::utility::parallel::execute(numberOfThreads, numberOfBatches, [&] (uint64_t batch) { solveBatch(batchSolverEnvironment, firstBatch + batch); });
+                }
+                sccIndex += schedule.batchEnd(firstBatch + numberOfBatches - 1) - schedule.batchBegin(firstBatch);
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
+                }
+            }
+            return returnValue;
+        }
+        
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(numberOfThreads));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -173,21 +270,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -207,20 +304,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -241,6 +338,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            parallelSccSchedule.reset();
+            idleSccSolvers.clear();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -5,6 +5,7 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/ParallelSccSchedule.h"
 
 namespace storm {
     
@@ -37,8 +38,11 @@ namespace storm {
 
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
             
-            // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-            void createSortedSccDecomposition(bool needLongestChainSize) const;
+            // Checks whether the SCCs can be solved concurrently with the given number of threads and the underlying solver of the given environment.
+            bool canSolveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const;
+            
+            // Creates an SCC decomposition (using the given number of threads) and sorts the SCCs according to a topological sort.
+            void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
             
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
@@ -46,7 +50,10 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves the SCCs level by level, where the SCCs of one level (i.e., SCCs with the same depth) are solved concurrently.
+            bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -60,6 +67,8 @@ namespace storm {
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<helper::ParallelSccSchedule> parallelSccSchedule;
+            mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> idleSccSolvers;
         };
         
         template<typename ValueType>
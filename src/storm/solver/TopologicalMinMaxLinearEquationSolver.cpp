@@ -2,6 +2,8 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/solver/helper/ParallelSccSchedule.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -12,6 +14,11 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/NumberTraits.h"
+
+#include <atomic>
+#include <mutex>
 
 namespace storm {
     namespace solver {
@@ -43,6 +50,25 @@ namespace storm {
             return subEnv;
         }
 
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::canSolveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const {
+            if (numberOfThreads <= 1 || storm::NumberTraits<ValueType>::IsExact) {
+                // Exact numbers may share (reference counted) state that is not thread-safe.
+                return false;
+            }
+            // Only the value iteration based methods are known to be thread-safe. Other methods may use LP solvers or
+            // linear equation solvers of other libraries, or (for rational search) exact numbers.
+            switch (sccSolverEnvironment.solver().minMax().getMethod()) {
+                case MinMaxMethod::ValueIteration:
+                case MinMaxMethod::IntervalIteration:
+                case MinMaxMethod::SoundValueIteration:
+                case MinMaxMethod::OptimisticValueIteration:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        
         template<typename ValueType>
         bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
@@ -51,10 +77,14 @@ namespace storm {
             // For sound computations we need to increase the precision in each SCC
             bool needAdaptPrecision = env.solver().isForceSoundness();
             
-            if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+            // SCCs of equal depth can be solved concurrently.
+            bool solveInParallel = canSolveSccsInParallel(getEnvironmentForUnderlyingSolver(env), env.solver().topological().getNumberOfThreads());
+            bool needSccDepths = needAdaptPrecision || solveInParallel;
+            
+            if (!this->sortedSccDecomposition || (needSccDepths && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(needSccDepths, env.solver().topological().getNumberOfThreads());
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->A->getRowGroupCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -81,39 +111,31 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                uint64_t sccIndex = 0;
-                storm::utility::ProgressMeasurement progress("states");
-                progress.setMaxCount(x.size());
-                progress.startNewMeasurement(0);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) { // Group refers to state
-                            sccRowGroupsAsBitVector.set(group, true);
-
-                            if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                    sccRowsAsBitVector.set(row, true);
-                                }
-                            } else {
-                                auto row = this->A->getRowGroupIndices()[group]+this->getInitialScheduler()[group];
-                                sccRowsAsBitVector.set(row, true);
-                                STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                            }
+                if (solveInParallel) {
+                    returnValue = solveSccsInParallel(sccSolverEnvironment, env.solver().topological().getNumberOfThreads(), dir, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    uint64_t sccIndex = 0;
+                    storm::utility::ProgressMeasurement progress("states");
+                    progress.setMaxCount(x.size());
+                    progress.startNewMeasurement(0);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            sccRowGroupsAsBitVector.clear();
+                            sccRowsAsBitVector.clear();
+                            setSccAsBitVectors(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                            returnValue = solveScc(sccSolverEnvironment, this->sccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        }
+                        ++sccIndex;
+                        progress.updateProgress(sccIndex);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    progress.updateProgress(sccIndex);
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
                 
@@ -122,7 +144,7 @@ namespace storm {
                     if (!auxiliaryRowGroupVector) {
                         auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
                     }
-                    this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                    this->initializeSchedulerChoices(this->A->getRowGroupCount());
                     this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
                 }
             }
@@ -135,9 +157,104 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->parallelSccSchedule) {
+                // Trivial SCCs are cheap, so we only start a new batch once the current one has enough states.
+                this->parallelSccSchedule = std::make_unique<helper::ParallelSccSchedule>(*this->sortedSccDecomposition, 1024);
+            }
+            auto const& schedule = *this->parallelSccSchedule;
+            STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << schedule.getNumberOfLevels() << " levels using " << numberOfThreads << " threads.");
+            
+            // If a level consists of several batches, the batches are already solved concurrently, so the solvers
+            // of the individual SCCs should not spawn further threads.
+            storm::Environment batchSolverEnvironment(sccSolverEnvironment);
+            batchSolverEnvironment.solver().multiplier().setNumberOfThreads(1);
+            
+            // The matrix creates its (trivial) row grouping on demand, which must not happen concurrently.
+            this->A->getRowGroupIndices();
+            
+            // The SCC solvers are shared among the batches, where each solver is used by one batch at a time.
+            std::mutex sccSolversMutex;
+            std::atomic<bool> returnValue(true);
+            auto solveBatch = [&] (storm::Environment const& batchEnvironment, uint64_t batch) {
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> batchSolver;
+                storm::storage::BitVector sccRowGroupsAsBitVector;
+                storm::storage::BitVector sccRowsAsBitVector;
+                for (uint64_t const* sccIt = schedule.batchBegin(batch); sccIt != schedule.batchEnd(batch); ++sccIt) {
+                    auto const& scc = (*this->sortedSccDecomposition)[*sccIt];
+                    bool sccResult;
+                    if (scc.size() == 1) {
+                        sccResult = solveTrivialScc(*scc.begin(), dir, x, b);
+                    } else {
+                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                        if (sccRowGroupsAsBitVector.size() == 0) {
+                            sccRowGroupsAsBitVector.resize(x.size());
+                            sccRowsAsBitVector.resize(b.size());
+                            std::lock_guard<std::mutex> lock(sccSolversMutex);
+                            if (!this->idleSccSolvers.empty()) {
+                                batchSolver = std::move(this->idleSccSolvers.back());
+                                this->idleSccSolvers.pop_back();
+                            }
+                        } else {
+                            sccRowGroupsAsBitVector.clear();
+                            sccRowsAsBitVector.clear();
+                        }
+                        setSccAsBitVectors(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                        sccResult = solveScc(batchEnvironment, batchSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b);
+                    }
+                    if (!sccResult) {
+                        returnValue = false;
+                    }
+                }
+                if (batchSolver) {
+                    std::lock_guard<std::mutex> lock(sccSolversMutex);
+                    this->idleSccSolvers.push_back(std::move(batchSolver));
+                }
+            };
+            
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("SCCs");
+            progress.setMaxCount(this->sortedSccDecomposition->size());
+            progress.startNewMeasurement(0);
+            for (uint64_t level = 0; level < schedule.getNumberOfLevels(); ++level) {
+                uint64_t const firstBatch = schedule.getFirstBatch(level);
+                uint64_t const numberOfBatches = schedule.getNumberOfBatches(level);
+                if (numberOfBatches == 1) {
+                    solveBatch(sccSolverEnvironment, firstBatch);
+                } else {
+                    storm::utility::parallel::execute(numberOfThreads, numberOfBatches, [&] (uint64_t batch) { solveBatch(batchSolverEnvironment, firstBatch + batch); });
+                }
+                sccIndex += schedule.batchEnd(firstBatch + numberOfBatches - 1) - schedule.batchBegin(firstBatch);
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
+                }
+            }
+            return returnValue;
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::setSccAsBitVectors(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const {
+            for (auto const& group : scc) { // Group refers to state
+                sccRowGroups.set(group, true);
+
+                if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+                    for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                        sccRows.set(row, true);
+                    }
+                } else {
+                    auto row = this->A->getRowGroupIndices()[group]+this->getInitialScheduler()[group];
+                    sccRows.set(row, true);
+                    STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(numberOfThreads));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -269,15 +386,15 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
 
             storm::storage::SparseMatrix<ValueType> sccA;
             if (this->choiceFixedForRowGroup) {
@@ -291,7 +408,7 @@ namespace storm {
                     // As we removed the entries where the choice was fixed, we need to change the scheduler.
                     // We set the scheduler to 0 for those states.
                     storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-                    this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                    sccSolver->setInitialScheduler(std::move(sccInitChoices));
                 }
 
             } else {
@@ -300,13 +417,13 @@ namespace storm {
                 // initial scheduler
                 if (this->hasInitialScheduler()) {
                     auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                    this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                    sccSolver->setInitialScheduler(std::move(sccInitChoices));
                 }
 
             }
 
 
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -328,18 +445,18 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -353,14 +470,14 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -380,6 +497,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            parallelSccSchedule.reset();
+            idleSccSolvers.clear();
             auxiliaryRowGroupVector.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
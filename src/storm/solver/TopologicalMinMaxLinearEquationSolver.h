@@ -4,6 +4,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/ParallelSccSchedule.h"
 
 namespace storm {
 
@@ -32,8 +33,11 @@ namespace storm {
         private:
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-            // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-            void createSortedSccDecomposition(bool needLongestChainSize) const;
+            // Checks whether the SCCs can be solved concurrently with the given number of threads and the underlying solver of the given environment.
+            bool canSolveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const;
+
+            // Creates an SCC decomposition (using the given number of threads) and sorts the SCCs according to a topological sort.
+            void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
 
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
@@ -41,12 +45,20 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves the SCCs level by level, where the SCCs of one level (i.e., SCCs with the same depth) are solved concurrently.
+            bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            // Sets the row groups of the given SCC and their (non-fixed) rows in the given bit vectors.
+            void setSccAsBitVectors(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<helper::ParallelSccSchedule> parallelSccSchedule;
+            mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> idleSccSolvers;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
         };
     }
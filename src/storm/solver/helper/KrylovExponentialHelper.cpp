@@ -0,0 +1,311 @@
+#include "storm/solver/helper/KrylovExponentialHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/constants/constants.hpp>
+
+#include "storm/environment/Environment.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NoConvergenceException.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace {
+                template<typename ValueType>
+                ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+                    ValueType result = storm::utility::zero<ValueType>();
+                    for (uint64_t index = 0; index < first.size(); ++index) {
+                        result += first[index] * second[index];
+                    }
+                    return result;
+                }
+
+                template<typename ValueType>
+                ValueType euclideanNorm(std::vector<ValueType> const& vector) {
+                    return std::sqrt(dotProduct(vector, vector));
+                }
+
+                /*!
+                 * Rounds the given (positive) step size up to two significant digits (as in Expokit).
+                 */
+                template<typename ValueType>
+                ValueType roundStepSize(ValueType stepSize) {
+                    ValueType scale = std::pow(static_cast<ValueType>(10), std::floor(std::log10(stepSize)) - 1);
+                    return std::ceil(stepSize / scale) * scale;
+                }
+
+                /*!
+                 * Multiplies the given dense (row-major) square matrices.
+                 */
+                template<typename ValueType>
+                std::vector<ValueType> multiplyDense(std::vector<ValueType> const& first, std::vector<ValueType> const& second, uint64_t dimension) {
+                    std::vector<ValueType> result(dimension * dimension, storm::utility::zero<ValueType>());
+                    for (uint64_t row = 0; row < dimension; ++row) {
+                        for (uint64_t k = 0; k < dimension; ++k) {
+                            ValueType const& factor = first[row * dimension + k];
+                            for (uint64_t column = 0; column < dimension; ++column) {
+                                result[row * dimension + column] += factor * second[k * dimension + column];
+                            }
+                        }
+                    }
+                    return result;
+                }
+
+                /*!
+                 * Solves A*X = B for the given dense (row-major) square matrices via Gaussian elimination with partial
+                 * pivoting. Both matrices are overwritten, B by the solution.
+                 */
+                template<typename ValueType>
+                void solveDense(std::vector<ValueType>& a, std::vector<ValueType>& b, uint64_t dimension) {
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        uint64_t pivot = column;
+                        for (uint64_t row = column + 1; row < dimension; ++row) {
+                            if (std::abs(a[row * dimension + column]) > std::abs(a[pivot * dimension + column])) {
+                                pivot = row;
+                            }
+                        }
+                        if (pivot != column) {
+                            std::swap_ranges(a.begin() + pivot * dimension, a.begin() + (pivot + 1) * dimension, a.begin() + column * dimension);
+                            std::swap_ranges(b.begin() + pivot * dimension, b.begin() + (pivot + 1) * dimension, b.begin() + column * dimension);
+                        }
+                        for (uint64_t row = column + 1; row < dimension; ++row) {
+                            ValueType factor = a[row * dimension + column] / a[column * dimension + column];
+                            if (factor == storm::utility::zero<ValueType>()) {
+                                continue;
+                            }
+                            for (uint64_t k = column; k < dimension; ++k) {
+                                a[row * dimension + k] -= factor * a[column * dimension + k];
+                            }
+                            for (uint64_t k = 0; k < dimension; ++k) {
+                                b[row * dimension + k] -= factor * b[column * dimension + k];
+                            }
+                        }
+                    }
+                    for (uint64_t row = dimension; row > 0; --row) {
+                        uint64_t currentRow = row - 1;
+                        for (uint64_t k = row; k < dimension; ++k) {
+                            ValueType const& factor = a[currentRow * dimension + k];
+                            for (uint64_t column = 0; column < dimension; ++column) {
+                                b[currentRow * dimension + column] -= factor * b[k * dimension + column];
+                            }
+                        }
+                        for (uint64_t column = 0; column < dimension; ++column) {
+                            b[currentRow * dimension + column] /= a[currentRow * dimension + currentRow];
+                        }
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            KrylovExponentialHelper<ValueType>::KrylovExponentialHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t krylovDimension) : matrix(matrix), krylovDimension(std::max<uint64_t>(1, std::min<uint64_t>(krylovDimension, matrix.getRowCount()))), matrixNorm(storm::utility::zero<ValueType>()) {
+                STORM_LOG_ASSERT(matrix.getRowCount() == matrix.getColumnCount(), "Expected a square matrix.");
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    ValueType rowSum = storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        rowSum += std::abs(entry.getValue());
+                    }
+                    matrixNorm = std::max(matrixNorm, rowSum);
+                }
+            }
+
+            template<typename ValueType>
+            ValueType KrylovExponentialHelper<ValueType>::computeExponentialTimesVector(Environment const& env, ValueType time, std::vector<ValueType>& vector, ValueType tolerance) {
+                ValueType beta = euclideanNorm(vector);
+                if (storm::utility::isZero(time) || storm::utility::isZero(beta) || storm::utility::isZero(matrixNorm)) {
+                    return storm::utility::zero<ValueType>();
+                }
+                if (!multiplier) {
+                    multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, matrix);
+                }
+
+                // The parameters of Expokit.
+                uint64_t const m = krylovDimension;
+                uint64_t const maximalNumberOfRejections = 10;
+                ValueType const breakdownTolerance = static_cast<ValueType>(1e-7);
+                ValueType const gamma = static_cast<ValueType>(0.9);
+                ValueType const roundoff = matrixNorm * std::numeric_limits<ValueType>::epsilon();
+
+                // Estimate the length of the first step.
+                ValueType exponent = storm::utility::one<ValueType>() / static_cast<ValueType>(m);
+                ValueType fact = std::pow(static_cast<ValueType>(m + 1) / std::exp(storm::utility::one<ValueType>()), static_cast<ValueType>(m + 1)) * std::sqrt(boost::math::constants::two_pi<ValueType>() * static_cast<ValueType>(m + 1));
+                ValueType newStepSize = roundStepSize((storm::utility::one<ValueType>() / matrixNorm) * std::pow((fact * tolerance) / (4 * beta * matrixNorm), exponent));
+
+                basis.resize(m + 1);
+                std::vector<ValueType> product(vector.size());
+                uint64_t const hessenbergDimension = m + 2;
+                std::vector<ValueType> hessenberg(hessenbergDimension * hessenbergDimension);
+                ValueType currentTime = storm::utility::zero<ValueType>();
+                ValueType totalError = storm::utility::zero<ValueType>();
+                uint64_t numberOfSteps = 0;
+                while (currentTime < time && !storm::utility::isZero(beta)) {
+                    ValueType stepSize = std::min(time - currentTime, newStepSize);
+
+                    // Arnoldi process: compute an orthonormal basis of the Krylov subspace and the projected matrix.
+                    basis[0].resize(vector.size());
+                    std::transform(vector.begin(), vector.end(), basis[0].begin(), [&beta] (ValueType const& value) { return value / beta; });
+                    std::fill(hessenberg.begin(), hessenberg.end(), storm::utility::zero<ValueType>());
+                    // If a breakdown occurs, the subspace is invariant and the projection is exact.
+                    bool breakdown = false;
+                    uint64_t basisSize = m;
+                    for (uint64_t j = 0; j < m; ++j) {
+                        multiplier->multiply(env, basis[j], nullptr, product);
+                        for (uint64_t i = 0; i <= j; ++i) {
+                            ValueType h = dotProduct(basis[i], product);
+                            hessenberg[i * hessenbergDimension + j] = h;
+                            for (uint64_t index = 0; index < product.size(); ++index) {
+                                product[index] -= h * basis[i][index];
+                            }
+                        }
+                        ValueType norm = euclideanNorm(product);
+                        if (norm < breakdownTolerance) {
+                            breakdown = true;
+                            basisSize = j + 1;
+                            stepSize = time - currentTime;
+                            break;
+                        }
+                        hessenberg[(j + 1) * hessenbergDimension + j] = norm;
+                        basis[j + 1].resize(vector.size());
+                        std::transform(product.begin(), product.end(), basis[j + 1].begin(), [&norm] (ValueType const& value) { return value / norm; });
+                    }
+                    ValueType productNorm = storm::utility::zero<ValueType>();
+                    if (!breakdown) {
+                        // The additional row and column are used for estimating the error.
+                        hessenberg[(m + 1) * hessenbergDimension + m] = storm::utility::one<ValueType>();
+                        multiplier->multiply(env, basis[m], nullptr, product);
+                        productNorm = euclideanNorm(product);
+                    }
+
+                    // Compute the exponential of the projected matrix and reduce the step size until the error is small enough.
+                    uint64_t exponentialDimension = breakdown ? basisSize : m + 2;
+                    std::vector<ValueType> exponential;
+                    ValueType localError;
+                    uint64_t numberOfRejections = 0;
+                    while (true) {
+                        std::vector<ValueType> scaledHessenberg(exponentialDimension * exponentialDimension);
+                        for (uint64_t row = 0; row < exponentialDimension; ++row) {
+                            for (uint64_t column = 0; column < exponentialDimension; ++column) {
+                                scaledHessenberg[row * exponentialDimension + column] = stepSize * hessenberg[row * hessenbergDimension + column];
+                            }
+                        }
+                        exponential = computeDenseExponential(scaledHessenberg, exponentialDimension);
+                        if (breakdown) {
+                            // The result is exact up to rounding errors.
+                            localError = storm::utility::zero<ValueType>();
+                            break;
+                        }
+
+                        ValueType phi1 = std::abs(beta * exponential[m * exponentialDimension]);
+                        ValueType phi2 = std::abs(beta * exponential[(m + 1) * exponentialDimension] * productNorm);
+                        if (phi1 > 10 * phi2) {
+                            localError = phi2;
+                            exponent = storm::utility::one<ValueType>() / static_cast<ValueType>(m);
+                        } else if (phi1 > phi2) {
+                            localError = (phi1 * phi2) / (phi1 - phi2);
+                            exponent = storm::utility::one<ValueType>() / static_cast<ValueType>(m);
+                        } else {
+                            localError = phi1;
+                            exponent = storm::utility::one<ValueType>() / static_cast<ValueType>(std::max<uint64_t>(1, m - 1));
+                        }
+                        if (localError <= stepSize * tolerance) {
+                            break;
+                        }
+                        ++numberOfRejections;
+                        STORM_LOG_THROW(numberOfRejections <= maximalNumberOfRejections, storm::exceptions::NoConvergenceException, "The Krylov subspace method failed to reach the requested tolerance " << tolerance << ".");
+                        stepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+                    }
+
+                    // Map the result back from the Krylov subspace.
+                    uint64_t resultDimension = breakdown ? basisSize : m + 1;
+                    std::fill(vector.begin(), vector.end(), storm::utility::zero<ValueType>());
+                    for (uint64_t i = 0; i < resultDimension; ++i) {
+                        ValueType factor = beta * exponential[i * exponentialDimension];
+                        for (uint64_t index = 0; index < vector.size(); ++index) {
+                            vector[index] += factor * basis[i][index];
+                        }
+                    }
+                    beta = euclideanNorm(vector);
+
+                    currentTime += stepSize;
+                    ++numberOfSteps;
+                    if (!breakdown) {
+                        newStepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+                    }
+                    totalError += std::max(localError, roundoff);
+                }
+                STORM_LOG_DEBUG("Krylov subspace method performed " << numberOfSteps << " steps with an estimated error of " << totalError << ".");
+                return totalError;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> KrylovExponentialHelper<ValueType>::computeDenseExponential(std::vector<ValueType> const& matrix, uint64_t dimension) {
+                uint64_t const degree = 6;
+
+                // Scale the matrix such that its norm is at most 1/2.
+                ValueType norm = storm::utility::zero<ValueType>();
+                for (uint64_t row = 0; row < dimension; ++row) {
+                    ValueType rowSum = storm::utility::zero<ValueType>();
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        rowSum += std::abs(matrix[row * dimension + column]);
+                    }
+                    norm = std::max(norm, rowSum);
+                }
+                int64_t numberOfSquarings = 0;
+                if (norm > storm::utility::zero<ValueType>()) {
+                    numberOfSquarings = std::max<int64_t>(0, static_cast<int64_t>(std::floor(std::log2(norm))) + 2);
+                }
+                ValueType scale = std::ldexp(storm::utility::one<ValueType>(), -numberOfSquarings);
+                std::vector<ValueType> scaledMatrix(matrix);
+                for (auto& value : scaledMatrix) {
+                    value *= scale;
+                }
+
+                // Evaluate the even part (V) and the odd part (U) of the numerator of the Pade approximation.
+                std::vector<ValueType> coefficients(degree + 1, storm::utility::one<ValueType>());
+                for (uint64_t k = 1; k <= degree; ++k) {
+                    coefficients[k] = coefficients[k - 1] * static_cast<ValueType>(degree + 1 - k) / static_cast<ValueType>(k * (2 * degree + 1 - k));
+                }
+                std::vector<ValueType> identity(dimension * dimension, storm::utility::zero<ValueType>());
+                for (uint64_t index = 0; index < dimension; ++index) {
+                    identity[index * dimension + index] = storm::utility::one<ValueType>();
+                }
+                std::vector<ValueType> square = multiplyDense(scaledMatrix, scaledMatrix, dimension);
+                std::vector<ValueType> even(dimension * dimension, storm::utility::zero<ValueType>());
+                std::vector<ValueType> odd(dimension * dimension, storm::utility::zero<ValueType>());
+                std::vector<ValueType> power = identity;
+                for (uint64_t k = 0; k <= degree; k += 2) {
+                    for (uint64_t index = 0; index < power.size(); ++index) {
+                        even[index] += coefficients[k] * power[index];
+                        if (k + 1 <= degree) {
+                            odd[index] += coefficients[k + 1] * power[index];
+                        }
+                    }
+                    power = multiplyDense(power, square, dimension);
+                }
+                odd = multiplyDense(odd, scaledMatrix, dimension);
+
+                // The approximation is (V - U)^-1 * (V + U).
+                std::vector<ValueType> denominator(dimension * dimension);
+                std::vector<ValueType> result(dimension * dimension);
+                for (uint64_t index = 0; index < result.size(); ++index) {
+                    denominator[index] = even[index] - odd[index];
+                    result[index] = even[index] + odd[index];
+                }
+                solveDense(denominator, result, dimension);
+
+                // Undo the scaling.
+                for (int64_t squaring = 0; squaring < numberOfSquarings; ++squaring) {
+                    result = multiplyDense(result, result, dimension);
+                }
+                return result;
+            }
+
+            template class KrylovExponentialHelper<double>;
+        }
+    }
+}
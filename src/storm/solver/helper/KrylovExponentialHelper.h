@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/multiplier/Multiplier.h"
+
+namespace storm {
+    class Environment;
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Computes the product of the exponential of a sparse matrix with a vector, i.e. exp(t*A)*v, by projecting the
+             * matrix onto Krylov subspaces of small dimension (as in Expokit's expv). The time is split into steps whose
+             * lengths are adapted to an a-posteriori estimate of the local error. In contrast to uniformization, the number
+             * of matrix-vector multiplications therefore does not grow with the largest rate of the matrix times t.
+             */
+            template<typename ValueType>
+            class KrylovExponentialHelper {
+            public:
+                /*!
+                 * Creates a helper for the given matrix.
+                 *
+                 * @param matrix The (square) matrix A.
+                 * @param krylovDimension The (maximal) dimension of the Krylov subspaces.
+                 */
+                KrylovExponentialHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t krylovDimension = 30);
+
+                /*!
+                 * Replaces the given vector v by exp(t*A)*v.
+                 *
+                 * @param time The time t (non-negative).
+                 * @param vector The vector v and the result.
+                 * @param tolerance The tolerated error (in the euclidean norm) per unit of time, i.e. the error of the result
+                 * is (estimated to be) at most tolerance * t.
+                 * @return The estimated error of the result.
+                 */
+                ValueType computeExponentialTimesVector(Environment const& env, ValueType time, std::vector<ValueType>& vector, ValueType tolerance);
+
+            private:
+                /*!
+                 * Computes the exponential of the given dense (row-major) matrix with the given dimension via scaling and
+                 * squaring of the diagonal Pade approximation of degree six.
+                 */
+                static std::vector<ValueType> computeDenseExponential(std::vector<ValueType> const& matrix, uint64_t dimension);
+
+                // The matrix and a multiplier for it.
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplier;
+
+                // The (maximal) dimension of the Krylov subspaces.
+                uint64_t krylovDimension;
+
+                // The infinity norm of the matrix.
+                ValueType matrixNorm;
+
+                // The orthonormal bases of the Krylov subspaces.
+                std::vector<std::vector<ValueType>> basis;
+            };
+        }
+    }
+}
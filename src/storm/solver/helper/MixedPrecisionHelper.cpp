@@ -0,0 +1,69 @@
+#include "storm/solver/helper/MixedPrecisionHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            MixedPrecisionHelper<ValueType>::MixedPrecisionHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix.template toValueType<ImpreciseType>()) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            uint64_t MixedPrecisionHelper<ValueType>::performIterations(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& threshold, bool relative, uint64_t maximalNumberOfIterations, uint64_t numberOfThreads) {
+                // Differences below a few ulps can not be detected reliably in reduced precision.
+                ImpreciseType impreciseThreshold = std::max(storm::utility::convertNumber<ImpreciseType>(threshold), static_cast<ImpreciseType>(8) * std::numeric_limits<ImpreciseType>::epsilon());
+
+                currentX.resize(x.size());
+                std::transform(x.begin(), x.end(), currentX.begin(), [] (ValueType const& value) { return storm::utility::convertNumber<ImpreciseType>(value); });
+                newX.resize(x.size());
+                impreciseB.resize(b.size());
+                std::transform(b.begin(), b.end(), impreciseB.begin(), [] (ValueType const& value) { return storm::utility::convertNumber<ImpreciseType>(value); });
+
+                uint64_t iterations = 0;
+                bool converged = false;
+                while (!converged && iterations < maximalNumberOfIterations) {
+                    if (dir) {
+                        if (numberOfThreads > 1) {
+                            matrix.multiplyAndReduceParallel(dir.get(), matrix.getRowGroupIndices(), currentX, &impreciseB, newX, nullptr, numberOfThreads);
+                        } else {
+                            matrix.multiplyAndReduce(dir.get(), matrix.getRowGroupIndices(), currentX, &impreciseB, newX, nullptr);
+                        }
+                    } else {
+                        if (numberOfThreads > 1) {
+                            matrix.multiplyWithVectorParallel(currentX, newX, &impreciseB, numberOfThreads);
+                        } else {
+                            matrix.multiplyWithVector(currentX, newX, &impreciseB);
+                        }
+                    }
+                    ++iterations;
+                    converged = storm::utility::vector::equalModuloPrecision<ImpreciseType>(currentX, newX, impreciseThreshold, relative);
+                    std::swap(currentX, newX);
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                }
+                STORM_LOG_INFO("Performed " << iterations << " iterations in reduced precision (" << (converged ? "" : "not ") << "reaching the threshold " << impreciseThreshold << ").");
+
+                std::transform(currentX.begin(), currentX.end(), x.begin(), [] (ImpreciseType const& value) { return storm::utility::convertNumber<ValueType>(value); });
+                return iterations;
+            }
+
+            template class MixedPrecisionHelper<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class MixedPrecisionHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
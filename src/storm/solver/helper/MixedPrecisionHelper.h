@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Performs value iteration sweeps on a copy of a matrix whose values are stored with reduced precision (float
+             * for double matrices and double for exact matrices). Since the imprecise sweeps cause less memory traffic,
+             * they can be used to cheaply approach the solution before switching to the actual value type.
+             */
+            template<typename ValueType>
+            class MixedPrecisionHelper {
+            public:
+                typedef typename std::conditional<std::is_same<ValueType, double>::value, float, double>::type ImpreciseType;
+
+                /*!
+                 * Creates a helper for the given matrix, which is copied with reduced precision.
+                 */
+                MixedPrecisionHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Starting from the given vector, repeatedly computes x' = A*x + b (reduced to the optimal choice per row
+                 * group if a direction is given) in reduced precision until two consecutive iterates differ by at most the
+                 * given threshold. The result is written to the given vector.
+                 *
+                 * @param dir If given, the optimization direction used to reduce the row groups.
+                 * @param x The initial vector and the result.
+                 * @param b The vector that is added to the result of the multiplications.
+                 * @param threshold The difference between two iterates at which the iterations stop. Thresholds that can
+                 * not be met in reduced precision are increased accordingly.
+                 * @param relative If set, the relative difference is considered.
+                 * @param maximalNumberOfIterations The maximal number of iterations.
+                 * @param numberOfThreads The number of threads used for the matrix-vector multiplications.
+                 * @return The number of performed iterations.
+                 */
+                uint64_t performIterations(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& threshold, bool relative, uint64_t maximalNumberOfIterations, uint64_t numberOfThreads);
+
+            private:
+                // The matrix with reduced precision.
+                storm::storage::SparseMatrix<ImpreciseType> matrix;
+
+                // Auxiliary vectors with reduced precision.
+                std::vector<ImpreciseType> currentX;
+                std::vector<ImpreciseType> newX;
+                std::vector<ImpreciseType> impreciseB;
+            };
+        }
+    }
+}
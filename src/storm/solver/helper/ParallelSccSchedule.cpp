@@ -0,0 +1,83 @@
+#include "storm/solver/helper/ParallelSccSchedule.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            ParallelSccSchedule::ParallelSccSchedule(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, uint64_t minimalBatchSize) {
+                STORM_LOG_ASSERT(decomposition.hasSccDepth(), "Scheduling SCCs requires their depths.");
+                uint64_t const numberOfSccs = decomposition.size();
+                uint64_t const numberOfLevels = numberOfSccs == 0 ? 0 : decomposition.getMaxSccDepth() + 1;
+
+                // Sort the SCCs by their depth (stable, so SCCs of the same level keep their topological order).
+                std::vector<uint64_t> levelBegin(numberOfLevels + 1, 0);
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    ++levelBegin[decomposition.getSccDepth(scc) + 1];
+                }
+                for (uint64_t level = 0; level < numberOfLevels; ++level) {
+                    levelBegin[level + 1] += levelBegin[level];
+                }
+                sccIndices.resize(numberOfSccs);
+                std::vector<uint64_t> nextPosition(levelBegin.begin(), levelBegin.end() - 1);
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    sccIndices[nextPosition[decomposition.getSccDepth(scc)]++] = scc;
+                }
+
+                // Split each level into batches of at least the given number of states.
+                levelIndications.reserve(numberOfLevels + 1);
+                for (uint64_t level = 0; level < numberOfLevels; ++level) {
+                    levelIndications.push_back(batchIndications.size());
+                    uint64_t statesInBatch = 0;
+                    for (uint64_t position = levelBegin[level]; position < levelBegin[level + 1]; ++position) {
+                        if (statesInBatch == 0) {
+                            batchIndications.push_back(position);
+                        }
+                        statesInBatch += decomposition[sccIndices[position]].size();
+                        if (statesInBatch >= minimalBatchSize) {
+                            statesInBatch = 0;
+                        }
+                    }
+                }
+                levelIndications.push_back(batchIndications.size());
+                batchIndications.push_back(numberOfSccs);
+            }
+
+            uint64_t ParallelSccSchedule::getNumberOfLevels() const {
+                return levelIndications.size() - 1;
+            }
+
+            uint64_t ParallelSccSchedule::getNumberOfBatches(uint64_t level) const {
+                return levelIndications[level + 1] - levelIndications[level];
+            }
+
+            uint64_t ParallelSccSchedule::getNumberOfBatches() const {
+                return batchIndications.size() - 1;
+            }
+
+            uint64_t ParallelSccSchedule::getFirstBatch(uint64_t level) const {
+                return levelIndications[level];
+            }
+
+            uint64_t const* ParallelSccSchedule::batchBegin(uint64_t batch) const {
+                return sccIndices.data() + batchIndications[batch];
+            }
+
+            uint64_t const* ParallelSccSchedule::batchEnd(uint64_t batch) const {
+                return sccIndices.data() + batchIndications[batch + 1];
+            }
+
+            template ParallelSccSchedule::ParallelSccSchedule(storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition, uint64_t minimalBatchSize);
+#ifdef STORM_HAVE_CARL
+            template ParallelSccSchedule::ParallelSccSchedule(storm::storage::StronglyConnectedComponentDecomposition<storm::RationalNumber> const& decomposition, uint64_t minimalBatchSize);
+            template ParallelSccSchedule::ParallelSccSchedule(storm::storage::StronglyConnectedComponentDecomposition<storm::RationalFunction> const& decomposition, uint64_t minimalBatchSize);
+#endif
+        }
+    }
+}
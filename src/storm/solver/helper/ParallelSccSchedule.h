@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Arranges the SCCs of a decomposition into levels and batches such that they can be solved concurrently.
+             * A level consists of all SCCs with the same depth. As SCCs of equal depth can not reach each other, the
+             * SCCs of one level only depend on SCCs of lower levels and can thus be solved in any order once the lower
+             * levels are solved. The SCCs of each level are split into batches that can be handed out to different
+             * threads, where small (in particular trivial) SCCs are batched together to keep the overhead per batch low.
+             */
+            class ParallelSccSchedule {
+            public:
+                /*!
+                 * Creates the schedule for the given decomposition.
+                 *
+                 * @param decomposition The SCC decomposition. Its SCC depths need to be computed.
+                 * @param minimalBatchSize The number of states that a batch needs to have before a new batch of the same
+                 * level is started.
+                 */
+                template<typename ValueType>
+                ParallelSccSchedule(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, uint64_t minimalBatchSize);
+
+                /*!
+                 * Retrieves the number of levels. Level i needs to be solved before level i + 1.
+                 */
+                uint64_t getNumberOfLevels() const;
+
+                /*!
+                 * Retrieves the number of batches of the given level.
+                 */
+                uint64_t getNumberOfBatches(uint64_t level) const;
+
+                /*!
+                 * Retrieves the total number of batches, i.e., the number of batches of all levels.
+                 */
+                uint64_t getNumberOfBatches() const;
+
+                /*!
+                 * Retrieves the index of the first batch of the given level. The batches of level i are the batches
+                 * getFirstBatch(i), ..., getFirstBatch(i + 1) - 1.
+                 */
+                uint64_t getFirstBatch(uint64_t level) const;
+
+                /*!
+                 * Retrieves the indices of the SCCs that belong to the given batch. The SCCs of the batch are found from
+                 * batchBegin(batch) (inclusive) to batchEnd(batch) (exclusive).
+                 */
+                uint64_t const* batchBegin(uint64_t batch) const;
+                uint64_t const* batchEnd(uint64_t batch) const;
+
+            private:
+                // The SCC indices ordered by level (and batch).
+                std::vector<uint64_t> sccIndices;
+
+                // The positions in the SCC indices at which each batch begins (including the end position).
+                std::vector<uint64_t> batchIndications;
+
+                // The batches at which each level begins (including the number of batches).
+                std::vector<uint64_t> levelIndications;
+            };
+        }
+    }
+}
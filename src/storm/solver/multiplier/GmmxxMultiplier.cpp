@@ -20,6 +20,11 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        GmmxxMultiplier<ValueType>::GmmxxMultiplier(storm::storage::SparseMatrix<ValueType>&& matrix) : Multiplier<ValueType>(std::move(matrix)) {
+            // Intentionally left empty.
+        }
+        
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::initialize() const {
             if (gmmMatrix.nrows() == 0) {
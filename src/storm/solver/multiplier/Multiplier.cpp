@@ -1,5 +1,7 @@
 #include "Multiplier.h"
 
+#include <atomic>
+
 #include "storm-config.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -12,6 +14,7 @@
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
@@ -23,12 +26,44 @@ namespace storm {
         Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
             // Intentionally left empty.
         }
+        
+        template<typename ValueType>
+        Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType>&& matrix) : ownedMatrix(std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix))), matrix(*ownedMatrix) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        Multiplier<ValueType>::~Multiplier() = default;
     
         template<typename ValueType>
         void Multiplier<ValueType>::clearCache() const {
             cachedVector.reset();
         }
         
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyInterleaved(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            // Exact number types are not thread-safe.
+            uint64_t numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : env.solver().multiplier().getNumberOfThreads();
+            this->matrix.multiplyWithInterleavedVectors(x, *target, b, numberOfVectors, numberOfThreads);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyInterleavedGaussSeidel(Environment const&, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards) const {
+            this->matrix.multiplyWithInterleavedVectorsGaussSeidel(x, b, numberOfVectors, backwards);
+        }
+        
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
@@ -75,7 +110,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
+        MultiplierType MultiplierFactory<ValueType>::getMultiplierType(Environment const& env) const {
             auto type = env.solver().multiplier().getType();
             
             // Adjust the multiplier type if an eqsolver was specified but not a multiplier
@@ -91,7 +126,26 @@ namespace storm {
                 STORM_LOG_INFO_COND(!changed, "Selecting '" + toString(type) + "' as the multiplier type to match the selected equation solver. If you want to override this, please explicitly specify a different multiplier type.");
             }
             
-            switch (type) {
+            // Threads, the structure-of-arrays layout, vectorization and multicolor orderings are only supported by the
+            // native multiplier.
+            auto const& multiplierEnv = env.solver().multiplier();
+            bool nativeFeaturesRequested = multiplierEnv.getNumberOfThreads() > 1 || multiplierEnv.isStructureOfArraysSet() || multiplierEnv.getInstructionSet() != storm::utility::simd::InstructionSet::Scalar || multiplierEnv.isMulticolorGaussSeidelSet();
+            if (type == MultiplierType::Gmmxx && nativeFeaturesRequested) {
+                if (multiplierEnv.isTypeSetFromDefault() && env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
+                    STORM_LOG_INFO("Selecting 'native' as the multiplier type as multiple threads, the structure-of-arrays layout, vectorization or multicolor orderings are requested.");
+                    type = MultiplierType::Native;
+                } else {
+                    static std::atomic<bool> warned(false);
+                    STORM_LOG_WARN_COND(warned.exchange(true), "The 'gmmxx' multiplier ignores the number of threads, the structure-of-arrays layout, vectorization and multicolor orderings. Select the 'native' multiplier to use them.");
+                }
+            }
+            
+            return type;
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
+            switch (getMultiplierType(env)) {
                 case MultiplierType::Gmmxx:
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
@@ -100,6 +154,17 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
         
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) {
+            switch (getMultiplierType(env)) {
+                case MultiplierType::Gmmxx:
+                    return std::make_unique<GmmxxMultiplier<ValueType>>(std::move(matrix));
+                case MultiplierType::Native:
+                    return std::make_unique<NativeMultiplier<ValueType>>(std::move(matrix));
+            }
+            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
+        }
+        
         template class Multiplier<double>;
         template class MultiplierFactory<double>;
         
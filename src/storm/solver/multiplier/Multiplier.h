@@ -5,6 +5,7 @@
 
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
     
@@ -23,7 +24,12 @@ namespace storm {
             
             Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
             
-            virtual ~Multiplier() = default;
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix.
+             */
+            Multiplier(storm::storage::SparseMatrix<ValueType>&& matrix);
+            
+            virtual ~Multiplier();
             
             /*
              * Clears the currently cached data of this multiplier in order to free some memory.
@@ -42,6 +48,30 @@ namespace storm {
              */
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const = 0;
             
+            /*!
+             * Performs the matrix-vector multiplications x_j' = A*x_j + b_j for several vectors at once. The vectors are
+             * stored interleaved, i.e., the i-th entry of x_j is located at position i * numberOfVectors + j.
+             *
+             * @param x The interleaved input vectors. Its length must be equal to the number of columns of A times the
+             * number of vectors.
+             * @param b If non-null, these interleaved vectors are added after the multiplication. If given, its length
+             * must be equal to the number of rows of A times the number of vectors.
+             * @param result The target into which to write the interleaved results. Its length must be equal to the
+             * number of rows of A times the number of vectors. Can be the same as the x vector.
+             * @param numberOfVectors The number of vectors.
+             */
+            virtual void multiplyInterleaved(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const;
+            
+            /*!
+             * Performs the matrix-vector multiplications of multiplyInterleaved in gauss-seidel style.
+             *
+             * @param x The interleaved input/output vectors.
+             * @param b If non-null, these interleaved vectors are added after the multiplication.
+             * @param numberOfVectors The number of vectors.
+             * @param backwards if true, the iterations will be performed beginning from the last row and ending at the first row.
+             */
+            virtual void multiplyInterleavedGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards = true) const;
+            
             /*!
              * Performs a matrix-vector multiplication in gauss-seidel style.
              *
@@ -136,6 +166,9 @@ namespace storm {
             
         protected:
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
+            
+            // The matrix if it is owned by this multiplier (and null otherwise).
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> ownedMatrix;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
         
@@ -146,6 +179,16 @@ namespace storm {
             ~MultiplierFactory() = default;
 
             std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix);
+            
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix. Callers that only need the matrix for the
+             * multiplications should prefer this variant, as it allows the native multiplier to release the entries of
+             * the matrix once it holds them in structure-of-arrays layout.
+             */
+            std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix);
+            
+        private:
+            MultiplierType getMultiplierType(Environment const& env) const;
         };
         
     }
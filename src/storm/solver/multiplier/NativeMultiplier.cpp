@@ -3,36 +3,128 @@
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/MulticolorOrdering.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/NumberTraits.h"
 
 namespace storm {
     namespace solver {
         
         template<typename ValueType>
-        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), requestedInstructionSet(storm::utility::simd::InstructionSet::Scalar), entriesReleased(false) {
             // Intentionally left empty.
         }
         
         template<typename ValueType>
-        bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
+        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType>&& matrix) : Multiplier<ValueType>(std::move(matrix)), requestedInstructionSet(storm::utility::simd::InstructionSet::Scalar), entriesReleased(false) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        NativeMultiplier<ValueType>::~NativeMultiplier() = default;
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::initialize(Environment const& env) const {
+            auto const& multiplierEnvironment = env.solver().multiplier();
+            // The environment might differ between calls, so we adapt the cached data to the current settings.
+            bool vectorize = multiplierEnvironment.getInstructionSet() != storm::utility::simd::InstructionSet::Scalar;
+            if (!multiplierEnvironment.isStructureOfArraysSet() && !vectorize && !entriesReleased) {
+                soaMatrix.reset();
+                return;
+            }
+            if (!soaMatrix) {
+                soaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType>>(this->matrix);
+                requestedInstructionSet = storm::utility::simd::InstructionSet::Scalar;
+            }
+            if (requestedInstructionSet != multiplierEnvironment.getInstructionSet()) {
+                requestedInstructionSet = multiplierEnvironment.getInstructionSet();
+                if (storm::utility::simd::isSupported(requestedInstructionSet)) {
+                    soaMatrix->setInstructionSet(requestedInstructionSet);
+                } else {
+                    STORM_LOG_WARN("The instruction set " << requestedInstructionSet << " is not supported by this processor. Falling back to scalar multiplications.");
+                    soaMatrix->setInstructionSet(storm::utility::simd::InstructionSet::Scalar);
+                }
+            }
+            // Once the SoA copy exists, the entries of an owned matrix are only needed for multicolor orderings and
+            // the multiplications of Intel TBB.
+            if (this->ownedMatrix && !entriesReleased && !multiplierEnvironment.isMulticolorGaussSeidelSet() && !useIntelTbb()) {
+                releaseEntries();
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::releaseEntries() const {
+            storm::storage::SparseMatrix<ValueType> const& matrix = *this->ownedMatrix;
+            STORM_LOG_INFO("Releasing the " << matrix.getEntryCount() << " entries of the matrix as they are held in structure-of-arrays layout.");
+            boost::optional<std::vector<typename storm::storage::SparseMatrix<ValueType>::index_type>> rowGroupIndices;
+            if (!matrix.hasTrivialRowGrouping()) {
+                rowGroupIndices = matrix.getRowGroupIndices();
+            }
+            std::vector<typename storm::storage::SparseMatrix<ValueType>::index_type> rowIndications(matrix.getRowCount() + 1, 0);
+            *this->ownedMatrix = storm::storage::SparseMatrix<ValueType>(matrix.getColumnCount(), std::move(rowIndications), std::vector<storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>>(), std::move(rowGroupIndices));
+            entriesReleased = true;
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            if (!entriesReleased) {
+                soaMatrix.reset();
+            }
+            multicolorOrdering.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        storm::storage::MulticolorOrdering const& NativeMultiplier<ValueType>::getMulticolorOrdering(std::vector<uint64_t> const* rowGroupIndices) const {
+            // The groupings are compared entry-wise as a different grouping might be stored at the same address. This is
+            // cheap compared to the sweep over the matrix that follows.
+            if (!multicolorOrdering || !multicolorOrdering->isComputedFor(rowGroupIndices)) {
+                multicolorOrdering = std::make_unique<storm::storage::MulticolorOrdering>(this->matrix, rowGroupIndices);
+                STORM_LOG_INFO("Gauss-Seidel multiplications use a multicolor ordering with " << multicolorOrdering->getNumberOfColors() << " colors.");
+            }
+            return *multicolorOrdering;
+        }
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::useIntelTbb() const {
 #ifdef STORM_HAVE_INTELTBB
-            return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+            return !entriesReleased && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
 #else
             return false;
 #endif
         }
         
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::useMulticolorOrdering(Environment const& env) const {
+            // The ordering is computed from the entries of the matrix.
+            return env.solver().multiplier().isMulticolorGaussSeidelSet() && !entriesReleased;
+        }
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
+            // Exact number types are not thread-safe.
+            return (useIntelTbb() || env.solver().multiplier().getNumberOfThreads() > 1) && !storm::NumberTraits<ValueType>::IsExact;
+        }
+        
+        template<typename ValueType>
+        uint64_t NativeMultiplier<ValueType>::getNumberOfThreads(Environment const& env) const {
+            return storm::NumberTraits<ValueType>::IsExact ? 1 : env.solver().multiplier().getNumberOfThreads();
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            initialize(env);
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
                 if (this->cachedVector) {
@@ -43,7 +135,7 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddParallel(x, b, *target);
+                multAddParallel(env, x, b, *target);
             } else {
                 multAdd(x, b, *target);
             }
@@ -52,9 +144,30 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyInterleaved(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const {
+            STORM_LOG_THROW(!entriesReleased, storm::exceptions::NotSupportedException, "Interleaved multiplications are not supported after the entries of the matrix were released.");
+            Multiplier<ValueType>::multiplyInterleaved(env, x, b, result, numberOfVectors);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyInterleavedGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards) const {
+            STORM_LOG_THROW(!entriesReleased, storm::exceptions::NotSupportedException, "Interleaved multiplications are not supported after the entries of the matrix were released.");
+            Multiplier<ValueType>::multiplyInterleavedGaussSeidel(env, x, b, numberOfVectors, backwards);
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
-            if (backwards) {
+            initialize(env);
+            if (useMulticolorOrdering(env)) {
+                this->matrix.multiplyWithVectorMulticolor(getMulticolorOrdering(nullptr), x, b, backwards, getNumberOfThreads(env));
+            } else if (soaMatrix) {
+                if (backwards) {
+                    soaMatrix->multiplyWithVectorBackward(x, x, b);
+                } else {
+                    soaMatrix->multiplyWithVectorForward(x, x, b);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyWithVectorBackward(x, x, b);
             } else {
                 this->matrix.multiplyWithVectorForward(x, x, b);
@@ -63,6 +176,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            initialize(env);
             std::vector<ValueType>* target = &result;
             if (&x == &result) {
                 if (this->cachedVector) {
@@ -73,7 +187,7 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+                multAddReduceParallel(env, dir, rowGroupIndices, x, b, *target, choices);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -84,7 +198,16 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            if (backwards) {
+            initialize(env);
+            if (useMulticolorOrdering(env)) {
+                this->matrix.multiplyAndReduceMulticolor(dir, rowGroupIndices, getMulticolorOrdering(&rowGroupIndices), x, b, choices, backwards, getNumberOfThreads(env));
+            } else if (soaMatrix) {
+                if (backwards) {
+                    soaMatrix->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+                } else {
+                    soaMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
             } else {
                 this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
@@ -93,47 +216,75 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
-            for (auto const& entry : this->matrix.getRow(rowIndex)) {
-                value += entry.getValue() * x[entry.getColumn()];
+            if (soaMatrix) {
+                value += soaMatrix->multiplyRowWithVector(rowIndex, x);
+            } else {
+                for (auto const& entry : this->matrix.getRow(rowIndex)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
             }
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
-            for (auto const& entry : this->matrix.getRow(rowIndex)) {
-                val1 += entry.getValue() * x1[entry.getColumn()];
-                val2 += entry.getValue() * x2[entry.getColumn()];
+            if (soaMatrix) {
+                soaMatrix->multiplyRowWithVectors(rowIndex, x1, val1, x2, val2);
+            } else {
+                for (auto const& entry : this->matrix.getRow(rowIndex)) {
+                    val1 += entry.getValue() * x1[entry.getColumn()];
+                    val2 += entry.getValue() * x2[entry.getColumn()];
+                }
             }
         }
 
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-            this->matrix.multiplyWithVector(x, result, b);
+            if (soaMatrix) {
+                soaMatrix->multiplyWithVector(x, result, b);
+            } else {
+                this->matrix.multiplyWithVector(x, result, b);
+            }
         }
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-            this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            if (soaMatrix) {
+                soaMatrix->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            } else {
+                this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            }
         }
         
         template<typename ValueType>
-        void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+        void NativeMultiplier<ValueType>::multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
 #ifdef STORM_HAVE_INTELTBB
-            this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(x, b, result);
+            if (useIntelTbb()) {
+                this->matrix.multiplyWithVectorParallel(x, result, b);
+                return;
+            }
 #endif
+            uint64_t numberOfThreads = env.solver().multiplier().getNumberOfThreads();
+            if (soaMatrix) {
+                soaMatrix->multiplyWithVectorParallel(x, result, b, numberOfThreads);
+            } else {
+                this->matrix.multiplyWithVectorParallel(x, result, b, numberOfThreads);
+            }
         }
                 
         template<typename ValueType>
-        void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+        void NativeMultiplier<ValueType>::multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
 #ifdef STORM_HAVE_INTELTBB
-            this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+            if (useIntelTbb()) {
+                this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+                return;
+            }
 #endif
+            uint64_t numberOfThreads = env.solver().multiplier().getNumberOfThreads();
+            if (soaMatrix) {
+                soaMatrix->multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices, numberOfThreads);
+            } else {
+                this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices, numberOfThreads);
+            }
         }
 
         template class NativeMultiplier<double>;
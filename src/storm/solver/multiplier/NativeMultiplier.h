@@ -3,11 +3,17 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace storage {
         template<typename ValueType>
         class SparseMatrix;
+        
+        template<typename ValueType>
+        class SoaSparseMatrix;
+        
+        class MulticolorOrdering;
     }
     
     namespace solver {
@@ -16,25 +22,72 @@ namespace storm {
         class NativeMultiplier : public Multiplier<ValueType> {
         public:
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-            virtual ~NativeMultiplier() = default;
+            
+            /*!
+             * Creates a multiplier that takes ownership of the given matrix. If the environment requests the
+             * structure-of-arrays layout, the entries of the matrix are released once the SoA copy is created, so the
+             * matrix is only held once. Multicolor orderings are not available after that.
+             */
+            NativeMultiplier(storm::storage::SparseMatrix<ValueType>&& matrix);
+            virtual ~NativeMultiplier();
             
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyInterleaved(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const override;
+            virtual void multiplyInterleavedGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards = true) const override;
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
 
         private:
+            /*!
+             * Creates, adapts, or drops the SoA copy of the matrix according to the settings of the given environment.
+             */
+            void initialize(Environment const& env) const;
+            
+            /*!
+             * Replaces the owned matrix by a matrix with the same rows and row groups but without entries.
+             */
+            void releaseEntries() const;
+            
+            /*!
+             * Retrieves a multicolor ordering for the given row groups (or the rows if no groups are given), which is
+             * computed on the first request. The row groupings are only compared entry-wise if the given vector
+             * differs from the one of the previous request.
+             */
+            storm::storage::MulticolorOrdering const& getMulticolorOrdering(std::vector<uint64_t> const* rowGroupIndices) const;
+            
+            bool useIntelTbb() const;
+            bool useMulticolorOrdering(Environment const& env) const;
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves the number of threads for the multicolor Gauss-Seidel sweeps, which is one for exact value types.
+             */
+            uint64_t getNumberOfThreads(Environment const& env) const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
-            void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
-            void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            void multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+            // A copy of the matrix in structure-of-arrays layout (if requested by the environment). Unless the matrix
+            // is owned by this multiplier, this copy adds to the memory needed for the matrix.
+            mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType>> soaMatrix;
+            
+            // A flag that indicates whether the entries of the owned matrix were released, which makes the SoA copy
+            // the only representation of the entries.
+            mutable bool entriesReleased;
+            
+            // The instruction set that was requested by the environment when the SoA matrix was last configured.
+            mutable storm::utility::simd::InstructionSet requestedInstructionSet;
             
+            // A multicolor ordering of the matrix for Gauss-Seidel style multiplications (if requested by the environment).
+            mutable std::unique_ptr<storm::storage::MulticolorOrdering> multicolorOrdering;
         };
         
     }
@@ -132,6 +132,15 @@ namespace storm {
             return values[flagBucketPair.second];
         }
         
+        template<class ValueType, class Hash>
+        boost::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+            if (flagBucketPair.first) {
+                return values[flagBucketPair.second];
+            }
+            return boost::none;
+        }
+        
         template<class ValueType, class Hash>
         ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
             return values[bucket];
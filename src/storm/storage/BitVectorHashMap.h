@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <functional>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/BitVector.h"
 
 namespace storm {
@@ -102,6 +104,15 @@ namespace storm {
              */
             ValueType getValue(storm::storage::BitVector const& key) const;
 
+            /*!
+             * Retrieves the value associated with the given key if the key is contained in the map. As this does not
+             * modify the map, it may be called by several threads at once as long as the map is not modified.
+             *
+             * @param key The key to search.
+             * @return The value associated with the given key if it is contained in the map and none otherwise.
+             */
+            boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
             /*!
              * Retrieves the value associated with the given bucket.
              *
@@ -0,0 +1,291 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <new>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // The states of a bucket, which are stored in the two least significant bits of its status word.
+            uint64_t const EMPTY = 0;
+            uint64_t const WRITING = 1;
+            uint64_t const MOVED = 2;
+            uint64_t const OCCUPIED = 3;
+            uint64_t const STATE_MASK = 3;
+
+            // The number of buckets that a thread moves to the next table at once.
+            uint64_t const CHUNK_SIZE = 4096;
+
+            // The smallest size exponent of a table.
+            uint64_t const MINIMAL_SIZE_EXPONENT = 6;
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t sizeExponent, uint64_t wordsPerKey) : sizeExponent(sizeExponent), status(new std::atomic<uint64_t>[1ull << sizeExponent]), keys(new uint64_t[(1ull << sizeExponent) * wordsPerKey]), values(new ValueType[1ull << sizeExponent]), numberOfElements(0), next(nullptr), resizing(false), nextChunkToMove(0), numberOfMovedChunks(0) {
+            for (uint64_t bucket = 0; bucket < getCapacity(); ++bucket) {
+                status[bucket].store(EMPTY, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::~Table() {
+            delete next.load();
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Table::getCapacity() const {
+            return 1ull << sizeExponent;
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : bucketSize(bucketSize), wordsPerKey(bucketSize / 64), loadFactor(loadFactor) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Load factor must be in (0,1).");
+
+            // Choose the size such that the initial number of buckets can be inserted without resizing.
+            uint64_t sizeExponent = MINIMAL_SIZE_EXPONENT;
+            while ((1ull << sizeExponent) * loadFactor <= initialSize) {
+                ++sizeExponent;
+            }
+            firstTable = std::make_unique<Table>(sizeExponent, wordsPerKey);
+            currentTable.store(firstTable.get());
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            // Intentionally left empty (the tables are released by the first one).
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getHash(storm::storage::BitVector const& key) const {
+            // Move the hash value to the most significant bits, which determine the home bucket of the key.
+            uint64_t hash = static_cast<uint64_t>(hasher(key)) << (64 - sizeof(decltype(hasher(key))) * 8);
+            return hash & ~STATE_MASK;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::matches(Table const& table, uint64_t bucket, storm::storage::BitVector const& key) const {
+            uint64_t const* bucketKey = table.keys.get() + bucket * wordsPerKey;
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                if (bucketKey[word] != key.getAsInt(word * 64, 64)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::Table* ConcurrentBitVectorHashMap<ValueType, Hash>::getCurrentTable() const {
+            Table* table = currentTable.load(std::memory_order_acquire);
+            while (table->resizing.load(std::memory_order_acquire)) {
+                table = helpResize(*table);
+            }
+            return table;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::startResize(Table& table) const {
+            bool expected = false;
+            if (table.resizing.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                STORM_LOG_TRACE("Increasing size of concurrent hash map from " << table.getCapacity() << " to " << 2 * table.getCapacity() << ".");
+                try {
+                    table.next.store(new Table(table.sizeExponent + 1, wordsPerKey), std::memory_order_release);
+                } catch (...) {
+                    // Release the threads that wait for the next table, they continue with this one.
+                    table.resizing.store(false, std::memory_order_release);
+                    throw;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::Table* ConcurrentBitVectorHashMap<ValueType, Hash>::helpResize(Table& table) const {
+            // Wait until the thread that initiated the resize has allocated the next table (or failed to do so).
+            Table* nextTable;
+            while ((nextTable = table.next.load(std::memory_order_acquire)) == nullptr) {
+                if (!table.resizing.load(std::memory_order_acquire)) {
+                    return &table;
+                }
+                std::this_thread::yield();
+            }
+
+            uint64_t numberOfChunks = (table.getCapacity() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+            for (uint64_t chunk = table.nextChunkToMove.fetch_add(1, std::memory_order_relaxed); chunk < numberOfChunks; chunk = table.nextChunkToMove.fetch_add(1, std::memory_order_relaxed)) {
+                moveChunk(table, *nextTable, chunk);
+                table.numberOfMovedChunks.fetch_add(1, std::memory_order_release);
+            }
+            while (table.numberOfMovedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+                std::this_thread::yield();
+            }
+
+            Table* expected = &table;
+            currentTable.compare_exchange_strong(expected, nextTable, std::memory_order_acq_rel);
+            return nextTable;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::moveChunk(Table& table, Table& nextTable, uint64_t chunk) const {
+            uint64_t nextMask = nextTable.getCapacity() - 1;
+            uint64_t numberOfMovedElements = 0;
+            for (uint64_t bucket = chunk * CHUNK_SIZE, bucketEnd = std::min(table.getCapacity(), bucket + CHUNK_SIZE); bucket < bucketEnd; ++bucket) {
+                uint64_t status = table.status[bucket].load(std::memory_order_acquire);
+                // Seal empty buckets such that no key can be inserted into them anymore.
+                while (status == EMPTY || status == WRITING) {
+                    if (status == EMPTY) {
+                        if (table.status[bucket].compare_exchange_weak(status, MOVED, std::memory_order_acq_rel)) {
+                            break;
+                        }
+                    } else {
+                        std::this_thread::yield();
+                        status = table.status[bucket].load(std::memory_order_acquire);
+                    }
+                }
+                if ((status & STATE_MASK) != OCCUPIED) {
+                    continue;
+                }
+
+                // As the keys of the table are unique and no other thread inserts into the next table before all entries
+                // are moved, we only need to find an empty bucket.
+                uint64_t nextBucket = status >> (64 - nextTable.sizeExponent);
+                uint64_t expected = EMPTY;
+                while (!nextTable.status[nextBucket].compare_exchange_strong(expected, WRITING, std::memory_order_acq_rel)) {
+                    nextBucket = (nextBucket + 1) & nextMask;
+                    expected = EMPTY;
+                }
+                std::copy(table.keys.get() + bucket * wordsPerKey, table.keys.get() + (bucket + 1) * wordsPerKey, nextTable.keys.get() + nextBucket * wordsPerKey);
+                nextTable.values[nextBucket] = table.values[bucket];
+                nextTable.status[nextBucket].store(status, std::memory_order_release);
+                ++numberOfMovedElements;
+            }
+            nextTable.numberOfElements.fetch_add(numberOfMovedElements, std::memory_order_relaxed);
+        }
+
+        template<class ValueType, class Hash>
+        template<typename ValueGenerator>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddImpl(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator) {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = getHash(key);
+            uint64_t occupiedStatus = hash | OCCUPIED;
+
+            Table* table = getCurrentTable();
+            while (true) {
+                uint64_t mask = table->getCapacity() - 1;
+                uint64_t bucket = hash >> (64 - table->sizeExponent);
+                uint64_t status = EMPTY;
+                for (uint64_t probe = 0; probe <= mask; ++probe, bucket = (bucket + 1) & mask) {
+                    std::atomic<uint64_t>& bucketStatus = table->status[bucket];
+                    status = bucketStatus.load(std::memory_order_acquire);
+                    if (status == EMPTY && bucketStatus.compare_exchange_strong(status, WRITING, std::memory_order_acq_rel)) {
+                        // We claimed the bucket, so we can write the key and value before publishing them.
+                        uint64_t* bucketKey = table->keys.get() + bucket * wordsPerKey;
+                        for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                            bucketKey[word] = key.getAsInt(word * 64, 64);
+                        }
+                        ValueType value = valueGenerator();
+                        table->values[bucket] = value;
+                        bucketStatus.store(occupiedStatus, std::memory_order_release);
+
+                        if (table->numberOfElements.fetch_add(1, std::memory_order_relaxed) + 1 >= loadFactor * table->getCapacity()) {
+                            try {
+                                startResize(*table);
+                            } catch (std::bad_alloc const&) {
+                                // The key is inserted nonetheless. The resize is attempted again once the table is full.
+                            }
+                        }
+                        return std::make_pair(value, true);
+                    }
+
+                    // If another thread is currently writing to the bucket, we need to wait for it to check the key.
+                    while (status == WRITING) {
+                        std::this_thread::yield();
+                        status = bucketStatus.load(std::memory_order_acquire);
+                    }
+                    if (status == occupiedStatus && matches(*table, bucket, key)) {
+                        return std::make_pair(table->values[bucket], false);
+                    } else if (status == MOVED) {
+                        break;
+                    }
+                }
+
+                // If we get here, the table is being replaced or full. In both cases, we continue in the next table.
+                if (status != MOVED) {
+                    startResize(*table);
+                }
+                table = helpResize(*table);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = getHash(key);
+            uint64_t occupiedStatus = hash | OCCUPIED;
+
+            Table* table = getCurrentTable();
+            while (true) {
+                uint64_t mask = table->getCapacity() - 1;
+                uint64_t bucket = hash >> (64 - table->sizeExponent);
+                for (uint64_t probe = 0; probe <= mask; ++probe, bucket = (bucket + 1) & mask) {
+                    std::atomic<uint64_t> const& bucketStatus = table->status[bucket];
+                    uint64_t status = bucketStatus.load(std::memory_order_acquire);
+                    while (status == WRITING) {
+                        std::this_thread::yield();
+                        status = bucketStatus.load(std::memory_order_acquire);
+                    }
+                    if (status == EMPTY) {
+                        return std::make_pair(false, ValueType());
+                    } else if (status == occupiedStatus && matches(*table, bucket, key)) {
+                        return std::make_pair(true, table->values[bucket]);
+                    } else if (status == MOVED) {
+                        break;
+                    }
+                }
+
+                // The key was not found in this table, but it might have been inserted into the next one.
+                if (!table->resizing.load(std::memory_order_acquire)) {
+                    return std::make_pair(false, ValueType());
+                }
+                table = helpResize(*table);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator) {
+            return findOrAddImpl(key, valueGenerator);
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrAddImpl(key, [&value] () { return value; }).first;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return find(key).first;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            std::pair<bool, ValueType> flagValuePair = find(key);
+            STORM_LOG_ASSERT(flagValuePair.first, "Unknown key.");
+            return flagValuePair.second;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return getCurrentTable()->numberOfElements.load(std::memory_order_relaxed);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return getCurrentTable()->getCapacity();
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A hash map whose keys are bit vectors that can be queried and extended by several threads concurrently. As for
+         * the BitVectorHashMap, only queries and insertions are supported and the keys must be bit vectors with a length
+         * that is a multiple of 64.
+         *
+         * The map uses open addressing with linear probing. Each bucket has a status word that is claimed with a single
+         * compare-and-swap operation upon insertion, so queries and insertions do not take any locks. If the load of the
+         * map becomes too high, a table of twice the size is allocated and all threads that access the map help moving
+         * the entries (in chunks of buckets) to the new table before they continue. Tables that were replaced are only
+         * released upon destruction of the map, because other threads may still read from them. If the larger table
+         * cannot be allocated, the exception is raised in the thread that attempted the allocation, while the other
+         * threads continue with the current table.
+         *
+         * Unlike the BitVectorHashMap, the map does not expose the buckets of its keys, as they change whenever
+         * another thread triggers a resize.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of buckets that is initially available.
+             * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+             * increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.5);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the value obtained from the given generator. The generator is only invoked by the
+             * thread that actually inserts the key (and only once).
+             *
+             * @param key The key to search or insert.
+             * @param valueGenerator A function that produces the value for the key if it is not already contained.
+             * @return A pair whose first component is the value of the key and whose second component indicates
+             * whether the key was inserted by this call.
+             */
+            std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given key. If the key does not exist, the behaviour is undefined.
+             *
+             * @return The value associated with the given key.
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores. If other threads
+             * insert keys concurrently, the result is only a snapshot.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the capacity of the underlying container.
+             *
+             * @return The capacity of the underlying container.
+             */
+            uint64_t capacity() const;
+
+        private:
+            /*!
+             * The buckets of one generation of the map.
+             */
+            struct Table {
+                Table(uint64_t sizeExponent, uint64_t wordsPerKey);
+                ~Table();
+
+                uint64_t getCapacity() const;
+
+                // The capacity of the table is 2^sizeExponent.
+                uint64_t sizeExponent;
+
+                // For each bucket, a word that indicates whether the bucket is empty, currently being written, occupied
+                // or moved. Occupied buckets also store (the most significant bits of) the hash value of their key.
+                std::unique_ptr<std::atomic<uint64_t>[]> status;
+
+                // The keys and values of the buckets.
+                std::unique_ptr<uint64_t[]> keys;
+                std::unique_ptr<ValueType[]> values;
+
+                std::atomic<uint64_t> numberOfElements;
+
+                // The table that replaces this one (once it was allocated) and the flag that indicates that this
+                // table is being replaced (which is cleared again if the next table cannot be allocated).
+                std::atomic<Table*> next;
+                std::atomic<bool> resizing;
+
+                // Counters for distributing the chunks of buckets that are moved to the next table among the threads.
+                std::atomic<uint64_t> nextChunkToMove;
+                std::atomic<uint64_t> numberOfMovedChunks;
+            };
+
+            /*!
+             * Searches for the given key and inserts it if it is not found.
+             *
+             * @return The value of the key and a flag that indicates whether the key was inserted by this call.
+             */
+            template<typename ValueGenerator>
+            std::pair<ValueType, bool> findOrAddImpl(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator);
+
+            /*!
+             * Searches for the given key.
+             *
+             * @return A pair whose first component indicates whether the key was found and whose second component is
+             * the value of the key (if found).
+             */
+            std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the hash value of the given key such that its most significant bits are the ones of the 64-bit
+             * word and its two least significant bits are cleared.
+             */
+            uint64_t getHash(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Checks whether the given bucket of the given table holds the given key.
+             */
+            bool matches(Table const& table, uint64_t bucket, storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the current table. If the current table is being replaced, this thread helps moving the
+             * entries first.
+             */
+            Table* getCurrentTable() const;
+
+            /*!
+             * Initiates the replacement of the given table (unless it is already being replaced). If the next table
+             * cannot be allocated, the replacement is called off and the exception is passed on to the caller.
+             */
+            void startResize(Table& table) const;
+
+            /*!
+             * Helps moving the entries of the given table to the next table and waits until all entries are moved.
+             *
+             * @return The next table or the given table if its replacement was called off.
+             */
+            Table* helpResize(Table& table) const;
+
+            /*!
+             * Moves the entries of the given chunk of buckets to the next table.
+             */
+            void moveChunk(Table& table, Table& nextTable, uint64_t chunk) const;
+
+            // The size of the keys in bits and in 64-bit words.
+            uint64_t bucketSize;
+            uint64_t wordsPerKey;
+
+            // The load factor that determines when the table is replaced.
+            double loadFactor;
+
+            // The first table, which (transitively) owns all subsequent tables.
+            std::unique_ptr<Table> firstTable;
+
+            // The most recent table (or one of its predecessors, if the pointer was not yet advanced).
+            mutable std::atomic<Table*> currentTable;
+
+            // Functor object that is used to hash the keys.
+            Hash hasher;
+        };
+
+    }
+}
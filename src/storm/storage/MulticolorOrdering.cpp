@@ -0,0 +1,140 @@
+#include "storm/storage/MulticolorOrdering.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        // The minimal number of groups per chunk. Smaller colors are not worth being distributed among threads.
+        static const uint64_t minimalChunkSize = 1024;
+
+        template<typename ValueType>
+        MulticolorOrdering::MulticolorOrdering(SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const* groups) {
+            uint64_t const numberOfGroups = groups ? groups->size() - 1 : matrix.getRowCount();
+            STORM_LOG_THROW(matrix.getColumnCount() == numberOfGroups, storm::exceptions::InvalidArgumentException, "Multicolor ordering requires a square matrix, but the matrix has " << numberOfGroups << " groups and " << matrix.getColumnCount() << " columns.");
+            if (groups) {
+                rowGroupIndices = *groups;
+            }
+            auto firstRow = [&] (uint64_t group) { return groups ? (*groups)[group] : group; };
+
+            // Build the (undirected) dependency graph between the groups, ignoring self-loops.
+            std::vector<uint64_t> neighborIndications(numberOfGroups + 1, 0);
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                for (uint64_t row = firstRow(group), endRow = firstRow(group + 1); row < endRow; ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != group) {
+                            ++neighborIndications[group + 1];
+                            ++neighborIndications[entry.getColumn() + 1];
+                        }
+                    }
+                }
+            }
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                neighborIndications[group + 1] += neighborIndications[group];
+            }
+            std::vector<uint64_t> neighbors(neighborIndications.back());
+            std::vector<uint64_t> nextNeighbor(neighborIndications.begin(), neighborIndications.end() - 1);
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                for (uint64_t row = firstRow(group), endRow = firstRow(group + 1); row < endRow; ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != group) {
+                            neighbors[nextNeighbor[group]++] = entry.getColumn();
+                            neighbors[nextNeighbor[entry.getColumn()]++] = group;
+                        }
+                    }
+                }
+            }
+
+            // Greedily assign each group the smallest color that none of its (already colored) neighbors has.
+            uint64_t const uncolored = std::numeric_limits<uint64_t>::max();
+            std::vector<uint64_t> colors(numberOfGroups, uncolored);
+            std::vector<uint64_t> forbiddenForGroup;
+            uint64_t numberOfColors = 0;
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                for (uint64_t index = neighborIndications[group]; index < neighborIndications[group + 1]; ++index) {
+                    uint64_t neighborColor = colors[neighbors[index]];
+                    if (neighborColor != uncolored) {
+                        forbiddenForGroup[neighborColor] = group;
+                    }
+                }
+                uint64_t color = 0;
+                while (color < numberOfColors && forbiddenForGroup[color] == group) {
+                    ++color;
+                }
+                if (color == numberOfColors) {
+                    ++numberOfColors;
+                    forbiddenForGroup.push_back(uncolored);
+                }
+                colors[group] = color;
+            }
+
+            // Sort the groups by their color (stable, so the groups of one color are in ascending order).
+            colorIndications.assign(numberOfColors + 1, 0);
+            for (auto color : colors) {
+                ++colorIndications[color + 1];
+            }
+            for (uint64_t color = 0; color < numberOfColors; ++color) {
+                colorIndications[color + 1] += colorIndications[color];
+            }
+            orderedGroups.resize(numberOfGroups);
+            std::vector<uint64_t> nextPosition(colorIndications.begin(), colorIndications.end() - 1);
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                orderedGroups[nextPosition[colors[group]]++] = group;
+            }
+            STORM_LOG_DEBUG("Computed multicolor ordering of " << numberOfGroups << " groups with " << numberOfColors << " colors.");
+        }
+
+        uint64_t MulticolorOrdering::getNumberOfColors() const {
+            return colorIndications.size() - 1;
+        }
+
+        uint64_t MulticolorOrdering::getNumberOfGroups() const {
+            return orderedGroups.size();
+        }
+
+        std::vector<uint64_t> const& MulticolorOrdering::getOrderedGroups() const {
+            return orderedGroups;
+        }
+
+        std::vector<uint64_t> const& MulticolorOrdering::getColorIndications() const {
+            return colorIndications;
+        }
+
+        bool MulticolorOrdering::isComputedFor(std::vector<uint64_t> const* groups) const {
+            if (groups) {
+                return rowGroupIndices == *groups;
+            }
+            return rowGroupIndices.empty();
+        }
+
+        void MulticolorOrdering::process(bool reverse, uint64_t numberOfThreads, std::function<void(uint64_t const*, uint64_t const*)> const& processGroups) const {
+            uint64_t const numberOfColors = getNumberOfColors();
+            for (uint64_t i = 0; i < numberOfColors; ++i) {
+                uint64_t const color = reverse ? numberOfColors - 1 - i : i;
+                uint64_t const* colorBegin = orderedGroups.data() + colorIndications[color];
+                uint64_t const colorSize = colorIndications[color + 1] - colorIndications[color];
+                uint64_t const numberOfChunks = std::max<uint64_t>(1, std::min(numberOfThreads, colorSize / minimalChunkSize));
+                storm::utility::parallel::execute(numberOfThreads, numberOfChunks, [&] (uint64_t chunk) {
+                    processGroups(colorBegin + (colorSize * chunk) / numberOfChunks, colorBegin + (colorSize * (chunk + 1)) / numberOfChunks);
+                });
+            }
+        }
+
+        template MulticolorOrdering::MulticolorOrdering(SparseMatrix<double> const& matrix, std::vector<uint64_t> const* rowGroupIndices);
+#ifdef STORM_HAVE_CARL
+        template MulticolorOrdering::MulticolorOrdering(SparseMatrix<storm::RationalNumber> const& matrix, std::vector<uint64_t> const* rowGroupIndices);
+        template MulticolorOrdering::MulticolorOrdering(SparseMatrix<storm::RationalFunction> const& matrix, std::vector<uint64_t> const* rowGroupIndices);
+#endif
+
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * A coloring of the row groups of a square (row-grouped) matrix such that no two groups of the same color
+         * depend on each other, i.e., no row of one of the groups has an entry in the column of the other group. A
+         * Gauss-Seidel sweep that visits the colors one after another is therefore a Gauss-Seidel sweep wrt. a
+         * permuted order of the groups, in which all groups of one color can be processed in parallel.
+         */
+        class MulticolorOrdering {
+        public:
+            /*!
+             * Computes a greedy coloring of the dependency graph of the given matrix.
+             *
+             * @param matrix The matrix. The number of columns must be equal to the number of groups.
+             * @param rowGroupIndices If given, the row groups of the matrix. Otherwise, each row is a group.
+             */
+            template<typename ValueType>
+            MulticolorOrdering(SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const* rowGroupIndices = nullptr);
+
+            /*!
+             * Retrieves the number of colors.
+             */
+            uint64_t getNumberOfColors() const;
+
+            /*!
+             * Retrieves the number of groups that have been colored.
+             */
+            uint64_t getNumberOfGroups() const;
+
+            /*!
+             * Retrieves the groups ordered by their color. The groups of color c are found at the positions
+             * getColorIndications()[c] to getColorIndications()[c + 1] (exclusive) of this vector.
+             */
+            std::vector<uint64_t> const& getOrderedGroups() const;
+
+            /*!
+             * Retrieves the indices at which the groups of each color begin in the ordered groups.
+             */
+            std::vector<uint64_t> const& getColorIndications() const;
+
+            /*!
+             * Retrieves whether this ordering was computed for the given row grouping.
+             */
+            bool isComputedFor(std::vector<uint64_t> const* rowGroupIndices) const;
+
+            /*!
+             * Processes the colors one after another (in reverse order if requested). The groups of one color are split
+             * into chunks that are passed to the given function, where the chunks of a color are processed in parallel
+             * using the given number of threads.
+             */
+            void process(bool reverse, uint64_t numberOfThreads, std::function<void(uint64_t const* groupsBegin, uint64_t const* groupsEnd)> const& processGroups) const;
+
+        private:
+            // The groups ordered by their color.
+            std::vector<uint64_t> orderedGroups;
+
+            // The indices at which the groups of each color begin.
+            std::vector<uint64_t> colorIndications;
+
+            // The row grouping for which the ordering was computed (empty if each row is a group).
+            std::vector<uint64_t> rowGroupIndices;
+        };
+
+    }
+}
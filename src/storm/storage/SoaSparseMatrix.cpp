@@ -0,0 +1,383 @@
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/SoaSparseMatrixKernels.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        SoaSparseMatrix<ValueType>::SoaSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices) : rowCount(matrix.getRowCount()), columnCount(matrix.getColumnCount()), instructionSet(storm::utility::simd::InstructionSet::Scalar) {
+            // The vectorized kernels interpret 32-bit column indices as signed integers, so we only narrow the indices
+            // if they are below 2^31.
+            narrowColumns = allowNarrowColumnIndices && columnCount <= static_cast<index_type>(std::numeric_limits<int32_t>::max());
+            index_type const entryCount = matrix.getEntryCount();
+
+            rowIndications.reserve(rowCount + 1);
+            values.reserve(entryCount);
+            if (narrowColumns) {
+                narrowColumnIndices.reserve(entryCount);
+            } else {
+                wideColumnIndices.reserve(entryCount);
+            }
+
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < rowCount; ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (narrowColumns) {
+                        narrowColumnIndices.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    } else {
+                        wideColumnIndices.push_back(entry.getColumn());
+                    }
+                    values.push_back(entry.getValue());
+                }
+                rowIndications.push_back(values.size());
+            }
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getRowCount() const {
+            return rowCount;
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        bool SoaSparseMatrix<ValueType>::hasNarrowColumnIndices() const {
+            return narrowColumns;
+        }
+
+        template<typename ValueType>
+        std::vector<typename SoaSparseMatrix<ValueType>::index_type> const& SoaSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> const& SoaSparseMatrix<ValueType>::getValues() const {
+            return values;
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::setInstructionSet(storm::utility::simd::InstructionSet const& newInstructionSet) {
+            STORM_LOG_THROW(storm::utility::simd::isSupported(newInstructionSet), storm::exceptions::NotSupportedException, "The instruction set " << newInstructionSet << " is not supported by this processor.");
+            instructionSet = newInstructionSet;
+        }
+
+        template<typename ValueType>
+        storm::utility::simd::InstructionSet const& SoaSparseMatrix<ValueType>::getInstructionSet() const {
+            return instructionSet;
+        }
+
+        template<typename ValueType>
+        bool SoaSparseMatrix<ValueType>::multiplyWithVectorVectorized(index_type, index_type, std::vector<ValueType> const&, std::vector<ValueType>&, std::vector<ValueType> const*) const {
+            return false;
+        }
+
+        template<typename ValueType>
+        bool SoaSparseMatrix<ValueType>::multiplyAndReduceVectorized(storm::solver::OptimizationDirection const&, uint64_t, uint64_t, std::vector<uint64_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*) const {
+            return false;
+        }
+
+        template<>
+        bool SoaSparseMatrix<double>::multiplyWithVectorVectorized(index_type startRow, index_type endRow, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) const {
+            if (instructionSet == storm::utility::simd::InstructionSet::Scalar) {
+                return false;
+            }
+            if (hasNarrowColumnIndices()) {
+                soa::KernelArguments<uint32_t> arguments = {rowIndications.data(), narrowColumnIndices.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data()};
+                soa::multiplyRows(instructionSet, arguments, startRow, endRow);
+            } else {
+                soa::KernelArguments<uint64_t> arguments = {rowIndications.data(), wideColumnIndices.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data()};
+                soa::multiplyRows(instructionSet, arguments, startRow, endRow);
+            }
+            return true;
+        }
+
+        template<>
+        bool SoaSparseMatrix<double>::multiplyAndReduceVectorized(storm::solver::OptimizationDirection const& dir, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) const {
+            if (instructionSet == storm::utility::simd::InstructionSet::Scalar) {
+                return false;
+            }
+            if (hasNarrowColumnIndices()) {
+                soa::KernelArguments<uint32_t> arguments = {rowIndications.data(), narrowColumnIndices.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data()};
+                soa::multiplyAndReduceRowGroups(instructionSet, dir == storm::OptimizationDirection::Minimize, arguments, rowGroupIndices.data(), choices ? choices->data() : nullptr, startGroup, endGroup);
+            } else {
+                soa::KernelArguments<uint64_t> arguments = {rowIndications.data(), wideColumnIndices.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data()};
+                soa::multiplyAndReduceRowGroups(instructionSet, dir == storm::OptimizationDirection::Minimize, arguments, rowGroupIndices.data(), choices ? choices->data() : nullptr, startGroup, endGroup);
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            // If the vector and the result are aliases, we need a temporary vector.
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased. Using temporary, which is potentially slow.");
+                std::vector<ValueType> temporary(result.size());
+                this->multiplyWithVectorForward(vector, temporary, summand);
+                std::swap(result, temporary);
+            } else {
+                this->multiplyWithVectorForward(vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            if (multiplyWithVectorVectorized(0, rowCount, vector, result, summand)) {
+                return;
+            }
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorForward(narrowColumnIndices.data(), 0, rowCount, vector, result, summand);
+            } else {
+                multiplyWithVectorForward(wideColumnIndices.data(), 0, rowCount, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorBackward(narrowColumnIndices.data(), vector, result, summand);
+            } else {
+                multiplyWithVectorBackward(wideColumnIndices.data(), vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnIndexType>
+        ValueType SoaSparseMatrix<ValueType>::multiplyRow(ColumnIndexType const* columns, index_type row, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand) const {
+            ValueType result = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                result += values[entry] * vector[columns[entry]];
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        template<typename ColumnIndexType>
+        void SoaSparseMatrix<ValueType>::multiplyRowWithVectors(ColumnIndexType const* columns, index_type row, std::vector<ValueType> const& vector1, ValueType& value1, std::vector<ValueType> const& vector2, ValueType& value2) const {
+            for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                value1 += values[entry] * vector1[columns[entry]];
+                value2 += values[entry] * vector2[columns[entry]];
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnIndexType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorForward(ColumnIndexType const* columns, index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            for (index_type row = startRow; row < endRow; ++row) {
+                result[row] = multiplyRow(columns, row, vector, summand);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnIndexType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorBackward(ColumnIndexType const* columns, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            for (index_type row = rowCount; row > 0; --row) {
+                result[row - 1] = multiplyRow(columns, row - 1, vector, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            // If the vector and the result are aliases, we need a temporary vector.
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+                std::vector<ValueType> temporary(result);
+                this->multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, temporary, choices);
+                std::swap(result, temporary);
+            } else {
+                this->multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (multiplyAndReduceVectorized(dir, 0, rowGroupIndices.size() - 1, rowGroupIndices, vector, summand, result, choices)) {
+                return;
+            }
+            multiplyAndReduceRowGroups<false>(dir, 0, rowGroupIndices.size() - 1, rowGroupIndices, vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRowGroups<true>(dir, 0, rowGroupIndices.size() - 1, rowGroupIndices, vector, summand, result, choices);
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SoaSparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void SoaSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        template<bool Backward>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceRowGroups(storm::solver::OptimizationDirection const& dir, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceRowGroups<storm::utility::ElementLess<ValueType>, Backward>(narrowColumnIndices.data(), startGroup, endGroup, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceRowGroups<storm::utility::ElementLess<ValueType>, Backward>(wideColumnIndices.data(), startGroup, endGroup, rowGroupIndices, vector, summand, result, choices);
+                }
+            } else {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceRowGroups<storm::utility::ElementGreater<ValueType>, Backward>(narrowColumnIndices.data(), startGroup, endGroup, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceRowGroups<storm::utility::ElementGreater<ValueType>, Backward>(wideColumnIndices.data(), startGroup, endGroup, rowGroupIndices, vector, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare, bool Backward, typename ColumnIndexType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceRowGroups(ColumnIndexType const* columns, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedRow;
+
+            for (uint64_t i = startGroup; i < endGroup; ++i) {
+                uint64_t const group = Backward ? endGroup - 1 - (i - startGroup) : i;
+                uint64_t const firstRow = rowGroupIndices[group];
+                uint64_t const groupSize = rowGroupIndices[group + 1] - firstRow;
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupSize == 0) {
+                    continue;
+                }
+
+                // Within the group, rows are processed in the same direction as the groups.
+                uint64_t row = Backward ? firstRow + groupSize - 1 : firstRow;
+                ValueType currentValue = multiplyRow(columns, row, vector, summand);
+                if (choices) {
+                    selectedRow = row;
+                    if (row - firstRow == (*choices)[group]) {
+                        oldSelectedChoiceValue = currentValue;
+                    }
+                }
+
+                for (uint64_t j = 1; j < groupSize; ++j) {
+                    row = Backward ? row - 1 : row + 1;
+                    ValueType newValue = multiplyRow(columns, row, vector, summand);
+
+                    if (choices && row - firstRow == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+
+                    if (compare(newValue, currentValue)) {
+                        currentValue = std::move(newValue);
+                        if (choices) {
+                            selectedRow = row;
+                        }
+                    }
+                }
+
+                // Finally write value to target vector.
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedRow - firstRow;
+                }
+                result[group] = std::move(currentValue);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand, uint64_t numberOfThreads) const {
+            // If the vector and the result are aliases, we need a temporary vector.
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased. Using temporary, which is potentially slow.");
+                std::vector<ValueType> temporary(result.size());
+                this->multiplyWithVectorParallel(vector, temporary, summand, numberOfThreads);
+                std::swap(result, temporary);
+                return;
+            }
+
+            std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, nullptr, numberOfThreads);
+            storm::utility::parallel::execute(numberOfThreads, ranges.size() - 1, [&] (uint64_t range) {
+                if (multiplyWithVectorVectorized(ranges[range], ranges[range + 1], vector, result, summand)) {
+                    return;
+                }
+                if (hasNarrowColumnIndices()) {
+                    multiplyWithVectorForward(narrowColumnIndices.data(), ranges[range], ranges[range + 1], vector, result, summand);
+                } else {
+                    multiplyWithVectorForward(wideColumnIndices.data(), ranges[range], ranges[range + 1], vector, result, summand);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const {
+            // If the vector and the result are aliases, we need a temporary vector.
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+                std::vector<ValueType> temporary(result);
+                this->multiplyAndReduceParallel(dir, rowGroupIndices, vector, summand, temporary, choices, numberOfThreads);
+                std::swap(result, temporary);
+                return;
+            }
+
+            std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, &rowGroupIndices, numberOfThreads);
+            storm::utility::parallel::execute(numberOfThreads, ranges.size() - 1, [&] (uint64_t range) {
+                if (multiplyAndReduceVectorized(dir, ranges[range], ranges[range + 1], rowGroupIndices, vector, summand, result, choices)) {
+                    return;
+                }
+                multiplyAndReduceRowGroups<false>(dir, ranges[range], ranges[range + 1], rowGroupIndices, vector, summand, result, choices);
+            });
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SoaSparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        ValueType SoaSparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+            if (hasNarrowColumnIndices()) {
+                return multiplyRow(narrowColumnIndices.data(), row, vector, nullptr);
+            } else {
+                return multiplyRow(wideColumnIndices.data(), row, vector, nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyRowWithVectors(index_type row, std::vector<ValueType> const& vector1, ValueType& value1, std::vector<ValueType> const& vector2, ValueType& value2) const {
+            if (hasNarrowColumnIndices()) {
+                multiplyRowWithVectors(narrowColumnIndices.data(), row, vector1, value1, vector2, value2);
+            } else {
+                multiplyRowWithVectors(wideColumnIndices.data(), row, vector1, value1, vector2, value2);
+            }
+        }
+
+        template class SoaSparseMatrix<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class SoaSparseMatrix<storm::RationalNumber>;
+        template class SoaSparseMatrix<storm::RationalFunction>;
+#endif
+
+    }
+}
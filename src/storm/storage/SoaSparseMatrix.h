@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only copy of a sparse matrix in compressed row storage format that stores the column indices and the
+         * values of the entries in two separate arrays (structure of arrays) rather than in one array of column-value
+         * pairs. If the number of columns is below 2^31, the column indices are stored using 32 bits. As matrix-vector
+         * multiplications on large matrices are typically bound by the memory bandwidth, this reduces the amount of
+         * data that needs to be moved per entry. Note that the copy is held in addition to the original matrix unless
+         * the owner of the matrix releases its entries (as the native multiplier does for matrices it owns).
+         *
+         * The multiplication methods mirror those of the sparse matrix. Within a row, entries are always summed up in
+         * ascending column order, so backward multiplications may differ from the ones of the sparse matrix in the
+         * last bits of floating point values.
+         *
+         * For double values, the forward multiplications can be carried out by vectorized kernels that gather the
+         * entries of the input vector (see setInstructionSet). These kernels sum up the entries of a row in a different
+         * order, so the results may again differ in the last bits.
+         */
+        template<typename ValueType>
+        class SoaSparseMatrix {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates a copy of the given matrix in structure-of-arrays layout.
+             *
+             * @param matrix The matrix to copy.
+             * @param allowNarrowColumnIndices If set, the column indices are stored using 32 bits whenever the column
+             * count of the matrix permits it.
+             */
+            SoaSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices = true);
+
+            /*!
+             * Returns the number of rows of the matrix.
+             */
+            index_type getRowCount() const;
+
+            /*!
+             * Returns the number of columns of the matrix.
+             */
+            index_type getColumnCount() const;
+
+            /*!
+             * Returns the number of entries in the matrix.
+             */
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves whether the column indices are stored using 32 bits.
+             */
+            bool hasNarrowColumnIndices() const;
+
+            /*!
+             * Retrieves the indices at which the rows begin. The entries of row i are found at the positions
+             * rowIndications[i] to rowIndications[i + 1] (exclusive) of the value and column arrays.
+             */
+            std::vector<index_type> const& getRowIndications() const;
+
+            /*!
+             * Retrieves the values of all entries.
+             */
+            std::vector<ValueType> const& getValues() const;
+
+            /*!
+             * Sets the instruction set used for the (forward) multiplications. Vectorized kernels are only used for
+             * double values; otherwise, the scalar code is used regardless of this setting.
+             *
+             * @param instructionSet The instruction set. Must be supported by the executing processor.
+             */
+            void setInstructionSet(storm::utility::simd::InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves the instruction set used for the (forward) multiplications.
+             */
+            storm::utility::simd::InstructionSet const& getInstructionSet() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector starting from the first (or last, respectively) row. The
+             * vector and the result may be the same, which yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+            void multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
+             * the result to the given result vector.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector. A choice
+             * is only updated if the value obtained with the 'new' choice is strictly better (wrt. to the optimization
+             * direction) than the value of the previous choice.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Multiplies and reduces starting from the first (or last, respectively) row group. The vector and the
+             * result may be the same, which yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Variants of multiplyWithVector and multiplyAndReduce that distribute the work among the given number of
+             * threads. The rows (or row groups, respectively) are split into ranges with roughly the same number of
+             * entries.
+             */
+            void multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand, uint64_t numberOfThreads) const;
+            void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const;
+
+            /*!
+             * Multiplies a single row of the matrix with the given vector and returns the result.
+             *
+             * @param row The index of the row with which to multiply
+             * @param vector The vector with which to multiply the row.
+             * @return the result of the multiplication.
+             */
+            ValueType multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const;
+
+            /*!
+             * Multiplies a single row of the matrix with each of the two given vectors and adds the results to the
+             * given values.
+             *
+             * @param row The index of the row with which to multiply
+             * @param vector1 The first vector with which to multiply the row.
+             * @param value1 The value to which the result of the first multiplication is added.
+             * @param vector2 The second vector with which to multiply the row.
+             * @param value2 The value to which the result of the second multiplication is added.
+             */
+            void multiplyRowWithVectors(index_type row, std::vector<ValueType> const& vector1, ValueType& value1, std::vector<ValueType> const& vector2, ValueType& value2) const;
+
+        private:
+            /*!
+             * Tries to carry out the multiplication (and reduction) of the given range with a vectorized kernel.
+             *
+             * @return True iff a vectorized kernel was applicable.
+             */
+            bool multiplyWithVectorVectorized(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const;
+            bool multiplyAndReduceVectorized(storm::solver::OptimizationDirection const& dir, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename ColumnIndexType>
+            ValueType multiplyRow(ColumnIndexType const* columns, index_type row, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand) const;
+
+            template<typename ColumnIndexType>
+            void multiplyRowWithVectors(ColumnIndexType const* columns, index_type row, std::vector<ValueType> const& vector1, ValueType& value1, std::vector<ValueType> const& vector2, ValueType& value2) const;
+
+            template<typename ColumnIndexType>
+            void multiplyWithVectorForward(ColumnIndexType const* columns, index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const;
+
+            template<typename ColumnIndexType>
+            void multiplyWithVectorBackward(ColumnIndexType const* columns, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const;
+
+            template<typename Compare, bool Backward, typename ColumnIndexType>
+            void multiplyAndReduceRowGroups(ColumnIndexType const* columns, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<bool Backward>
+            void multiplyAndReduceRowGroups(storm::solver::OptimizationDirection const& dir, uint64_t startGroup, uint64_t endGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            // The number of rows of the matrix.
+            index_type rowCount;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // The indices at which each row begins.
+            std::vector<index_type> rowIndications;
+
+            // A flag indicating whether the column indices are stored using 32 bits.
+            bool narrowColumns;
+
+            // The column indices of all entries if they are stored using 32 bits (empty otherwise).
+            std::vector<uint32_t> narrowColumnIndices;
+
+            // The column indices of all entries if they are stored using 64 bits (empty otherwise).
+            std::vector<index_type> wideColumnIndices;
+
+            // The values of all entries.
+            std::vector<ValueType> values;
+
+            // The instruction set used for the multiplications.
+            storm::utility::simd::InstructionSet instructionSet;
+        };
+
+    }
+}
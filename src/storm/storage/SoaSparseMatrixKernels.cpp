@@ -0,0 +1,207 @@
+#include "storm/storage/SoaSparseMatrixKernels.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+#ifdef STORM_HAVE_SIMD_DISPATCH
+#include <immintrin.h>
+
+// The kernels are compiled for the respective instruction set regardless of the flags of the remaining code base.
+// Whether they may be executed is checked at runtime.
+#define STORM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define STORM_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+namespace storm {
+    namespace storage {
+        namespace soa {
+
+#ifdef STORM_HAVE_SIMD_DISPATCH
+            namespace {
+                // Masks that select the first k of four lanes when starting at position 4 - k.
+                int64_t const avx2Mask64[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+                int32_t const avx2Mask32[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+
+                // Gathers the four entries of the vector at the given columns. As the gather instructions interpret
+                // the indices as signed integers, 32-bit indices must be below 2^31 (which is ensured by the matrix).
+                STORM_TARGET_AVX2 inline __m256d gatherAvx2(double const* vector, uint32_t const* columns) {
+                    return _mm256_i32gather_pd(vector, _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns)), 8);
+                }
+
+                STORM_TARGET_AVX2 inline __m256d gatherAvx2(double const* vector, uint64_t const* columns) {
+                    return _mm256_i64gather_pd(vector, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns)), 8);
+                }
+
+                // Gathers the first 'remaining' (one to three) entries with masked loads to not read beyond the arrays.
+                STORM_TARGET_AVX2 inline __m256d maskGatherAvx2(double const* vector, uint32_t const* columns, uint64_t remaining, __m256i mask) {
+                    __m128i mask32 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(avx2Mask32 + 4 - remaining));
+                    __m128i indices = _mm_maskload_epi32(reinterpret_cast<int const*>(columns), mask32);
+                    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), vector, indices, _mm256_castsi256_pd(mask), 8);
+                }
+
+                STORM_TARGET_AVX2 inline __m256d maskGatherAvx2(double const* vector, uint64_t const* columns, uint64_t, __m256i mask) {
+                    __m256i indices = _mm256_maskload_epi64(reinterpret_cast<long long const*>(columns), mask);
+                    return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), vector, indices, _mm256_castsi256_pd(mask), 8);
+                }
+
+                STORM_TARGET_AVX512 inline __m512d gatherAvx512(double const* vector, uint32_t const* columns) {
+                    return _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns)), vector, 8);
+                }
+
+                STORM_TARGET_AVX512 inline __m512d gatherAvx512(double const* vector, uint64_t const* columns) {
+                    return _mm512_i64gather_pd(_mm512_loadu_si512(columns), vector, 8);
+                }
+
+                STORM_TARGET_AVX512 inline __m512d maskGatherAvx512(double const* vector, uint32_t const* columns, __mmask8 mask) {
+                    __m256i indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns));
+                    return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, vector, 8);
+                }
+
+                STORM_TARGET_AVX512 inline __m512d maskGatherAvx512(double const* vector, uint64_t const* columns, __mmask8 mask) {
+                    return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, _mm512_maskz_loadu_epi64(mask, columns), vector, 8);
+                }
+
+                template<typename ColumnIndexType>
+                STORM_TARGET_AVX2 inline double multiplyRowAvx2(KernelArguments<ColumnIndexType> const& arguments, uint64_t row) {
+                    uint64_t entry = arguments.rowIndications[row];
+                    uint64_t const entryEnd = arguments.rowIndications[row + 1];
+                    __m256d sum = _mm256_setzero_pd();
+                    for (; entry + 4 <= entryEnd; entry += 4) {
+                        sum = _mm256_fmadd_pd(_mm256_loadu_pd(arguments.values + entry), gatherAvx2(arguments.vector, arguments.columns + entry), sum);
+                    }
+                    if (entry < entryEnd) {
+                        uint64_t const remaining = entryEnd - entry;
+                        __m256i mask = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(avx2Mask64 + 4 - remaining));
+                        __m256d vectorValues = maskGatherAvx2(arguments.vector, arguments.columns + entry, remaining, mask);
+                        sum = _mm256_fmadd_pd(_mm256_maskload_pd(arguments.values + entry, mask), vectorValues, sum);
+                    }
+                    __m128d low = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+                    double result = _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+                    return arguments.summand ? arguments.summand[row] + result : result;
+                }
+
+                template<typename ColumnIndexType>
+                STORM_TARGET_AVX512 inline double multiplyRowAvx512(KernelArguments<ColumnIndexType> const& arguments, uint64_t row) {
+                    uint64_t entry = arguments.rowIndications[row];
+                    uint64_t const entryEnd = arguments.rowIndications[row + 1];
+                    __m512d sum = _mm512_setzero_pd();
+                    for (; entry + 8 <= entryEnd; entry += 8) {
+                        sum = _mm512_fmadd_pd(_mm512_loadu_pd(arguments.values + entry), gatherAvx512(arguments.vector, arguments.columns + entry), sum);
+                    }
+                    if (entry < entryEnd) {
+                        __mmask8 const mask = static_cast<__mmask8>((1u << (entryEnd - entry)) - 1);
+                        __m512d vectorValues = maskGatherAvx512(arguments.vector, arguments.columns + entry, mask);
+                        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, arguments.values + entry), vectorValues, sum);
+                    }
+                    double result = _mm512_reduce_add_pd(sum);
+                    return arguments.summand ? arguments.summand[row] + result : result;
+                }
+
+                template<typename ColumnIndexType>
+                STORM_TARGET_AVX2 void multiplyRowsAvx2(KernelArguments<ColumnIndexType> const& arguments, uint64_t startRow, uint64_t endRow) {
+                    for (uint64_t row = startRow; row < endRow; ++row) {
+                        arguments.result[row] = multiplyRowAvx2(arguments, row);
+                    }
+                }
+
+                template<typename ColumnIndexType>
+                STORM_TARGET_AVX512 void multiplyRowsAvx512(KernelArguments<ColumnIndexType> const& arguments, uint64_t startRow, uint64_t endRow) {
+                    for (uint64_t row = startRow; row < endRow; ++row) {
+                        arguments.result[row] = multiplyRowAvx512(arguments, row);
+                    }
+                }
+
+                // The selection of the optimal row is written without branches (the compiler emits conditional moves)
+                // as for short rows, the outcome of the comparison is hard to predict.
+#define STORM_SOA_REDUCE_ROW_GROUPS(multiplyRowFunction)                                                                   \
+                    Compare compare;                                                                                        \
+                    for (uint64_t group = startGroup; group < endGroup; ++group) {                                          \
+                        uint64_t const firstRow = rowGroupIndices[group];                                                   \
+                        uint64_t const endRow = rowGroupIndices[group + 1];                                                 \
+                        if (firstRow == endRow) {                                                                           \
+                            continue;                                                                                       \
+                        }                                                                                                   \
+                        double currentValue = multiplyRowFunction(arguments, firstRow);                                     \
+                        uint64_t selectedChoice = 0;                                                                        \
+                        uint64_t const oldChoice = choices ? choices[group] : 0;                                            \
+                        double oldSelectedChoiceValue = currentValue;                                                       \
+                        for (uint64_t row = firstRow + 1; row < endRow; ++row) {                                            \
+                            double const newValue = multiplyRowFunction(arguments, row);                                    \
+                            uint64_t const choice = row - firstRow;                                                         \
+                            oldSelectedChoiceValue = choice == oldChoice ? newValue : oldSelectedChoiceValue;               \
+                            bool const better = compare(newValue, currentValue);                                            \
+                            currentValue = better ? newValue : currentValue;                                                \
+                            selectedChoice = better ? choice : selectedChoice;                                              \
+                        }                                                                                                   \
+                        arguments.result[group] = currentValue;                                                             \
+                        if (choices && compare(currentValue, oldSelectedChoiceValue)) {                                     \
+                            choices[group] = selectedChoice;                                                                \
+                        }                                                                                                   \
+                    }
+
+                template<typename Compare, typename ColumnIndexType>
+                STORM_TARGET_AVX2 void multiplyAndReduceRowGroupsAvx2(KernelArguments<ColumnIndexType> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                    STORM_SOA_REDUCE_ROW_GROUPS(multiplyRowAvx2)
+                }
+
+                template<typename Compare, typename ColumnIndexType>
+                STORM_TARGET_AVX512 void multiplyAndReduceRowGroupsAvx512(KernelArguments<ColumnIndexType> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                    STORM_SOA_REDUCE_ROW_GROUPS(multiplyRowAvx512)
+                }
+
+#undef STORM_SOA_REDUCE_ROW_GROUPS
+            }
+#endif
+
+            template<typename ColumnIndexType>
+            void multiplyRows(storm::utility::simd::InstructionSet const& instructionSet, KernelArguments<ColumnIndexType> const& arguments, uint64_t startRow, uint64_t endRow) {
+                STORM_LOG_ASSERT(storm::utility::simd::isSupported(instructionSet), "Instruction set " << instructionSet << " is not supported.");
+                switch (instructionSet) {
+#ifdef STORM_HAVE_SIMD_DISPATCH
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        multiplyRowsAvx2(arguments, startRow, endRow);
+                        return;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        multiplyRowsAvx512(arguments, startRow, endRow);
+                        return;
+#endif
+                    default:
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "There is no vectorized kernel for instruction set " << instructionSet << ".");
+                }
+            }
+
+            template<typename ColumnIndexType>
+            void multiplyAndReduceRowGroups(storm::utility::simd::InstructionSet const& instructionSet, bool minimize, KernelArguments<ColumnIndexType> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup) {
+                STORM_LOG_ASSERT(storm::utility::simd::isSupported(instructionSet), "Instruction set " << instructionSet << " is not supported.");
+                switch (instructionSet) {
+#ifdef STORM_HAVE_SIMD_DISPATCH
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        if (minimize) {
+                            multiplyAndReduceRowGroupsAvx2<storm::utility::ElementLess<double>, ColumnIndexType>(arguments, rowGroupIndices, choices, startGroup, endGroup);
+                        } else {
+                            multiplyAndReduceRowGroupsAvx2<storm::utility::ElementGreater<double>, ColumnIndexType>(arguments, rowGroupIndices, choices, startGroup, endGroup);
+                        }
+                        return;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        if (minimize) {
+                            multiplyAndReduceRowGroupsAvx512<storm::utility::ElementLess<double>, ColumnIndexType>(arguments, rowGroupIndices, choices, startGroup, endGroup);
+                        } else {
+                            multiplyAndReduceRowGroupsAvx512<storm::utility::ElementGreater<double>, ColumnIndexType>(arguments, rowGroupIndices, choices, startGroup, endGroup);
+                        }
+                        return;
+#endif
+                    default:
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "There is no vectorized kernel for instruction set " << instructionSet << ".");
+                }
+            }
+
+            template void multiplyRows(storm::utility::simd::InstructionSet const& instructionSet, KernelArguments<uint32_t> const& arguments, uint64_t startRow, uint64_t endRow);
+            template void multiplyRows(storm::utility::simd::InstructionSet const& instructionSet, KernelArguments<uint64_t> const& arguments, uint64_t startRow, uint64_t endRow);
+            template void multiplyAndReduceRowGroups(storm::utility::simd::InstructionSet const& instructionSet, bool minimize, KernelArguments<uint32_t> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup);
+            template void multiplyAndReduceRowGroups(storm::utility::simd::InstructionSet const& instructionSet, bool minimize, KernelArguments<uint64_t> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup);
+
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+        namespace soa {
+
+            /*!
+             * The data of a matrix in structure-of-arrays layout with 32-bit or 64-bit column indices together with the
+             * vectors involved in a multiplication. 32-bit column indices must be below 2^31, because the gather
+             * instructions interpret them as signed integers.
+             */
+            template<typename ColumnIndexType>
+            struct KernelArguments {
+                uint64_t const* rowIndications;
+                ColumnIndexType const* columns;
+                double const* values;
+                double const* vector;
+                double const* summand;
+                double* result;
+            };
+
+            /*!
+             * Computes result[row] = summand[row] + sum_j values[j] * vector[columns[j]] for all rows in the given
+             * range using vectorized instructions that gather the entries of the vector. Rows are processed in
+             * ascending order, so the vector and the result may be the same (Gauss-Seidel style).
+             *
+             * @param instructionSet The instruction set to use. Must be supported by the processor and not be scalar.
+             */
+            template<typename ColumnIndexType>
+            void multiplyRows(storm::utility::simd::InstructionSet const& instructionSet, KernelArguments<ColumnIndexType> const& arguments, uint64_t startRow, uint64_t endRow);
+
+            /*!
+             * Multiplies the rows of all row groups in the given range and writes the minimum (or maximum) value of
+             * each group to the result. The comparison and the tracking of choices behave exactly like the scalar
+             * kernels of the sparse matrix. Only the values of the rows may differ in the last bits, because the
+             * entries are summed up in a different order.
+             *
+             * @param instructionSet The instruction set to use. Must be supported by the processor and not be scalar.
+             * @param choices If not null, the choices are updated if a strictly better choice was found.
+             */
+            template<typename ColumnIndexType>
+            void multiplyAndReduceRowGroups(storm::utility::simd::InstructionSet const& instructionSet, bool minimize, KernelArguments<ColumnIndexType> const& arguments, uint64_t const* rowGroupIndices, uint_fast64_t* choices, uint64_t startGroup, uint64_t endGroup);
+
+        }
+    }
+}
@@ -2,12 +2,14 @@
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/MulticolorOrdering.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -1617,21 +1619,24 @@ namespace storm {
             }
         }
         
-#ifdef STORM_HAVE_INTELTBB
         template <typename ValueType>
-        class TbbMultAddFunctor {
+        class MultAddFunctor {
         public:
             typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
             
-            TbbMultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand) : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
+            MultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand) : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
                 // Intentionally left empty.
             }
             
+#ifdef STORM_HAVE_INTELTBB
             void operator()(tbb::blocked_range<index_type> const& range) const {
-                index_type startRow = range.begin();
-                index_type endRow = range.end();
+                (*this)(range.begin(), range.end());
+            }
+#endif
+            
+            void operator()(index_type startRow, index_type endRow) const {
                 typename std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
                 const_iterator it = columnsAndEntries.begin() + *rowIterator;
                 const_iterator ite;
@@ -1661,6 +1666,7 @@ namespace storm {
             std::vector<value_type> const* summand;
         };
         
+#ifdef STORM_HAVE_INTELTBB
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
             if (&vector == &result) {
@@ -1669,11 +1675,82 @@ namespace storm {
                 multiplyWithVectorParallel(vector, tmpVector);
                 result = std::move(tmpVector);
             } else {
-                tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100), TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
+                tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100), MultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
             }
         }
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand, uint64_t numberOfThreads) const {
+            if (&vector == &result) {
+                STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+                std::vector<ValueType> tmpVector(this->getRowCount());
+                multiplyWithVectorParallel(vector, tmpVector, summand, numberOfThreads);
+                result = std::move(tmpVector);
+            } else {
+                std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, nullptr, numberOfThreads);
+                MultAddFunctor<ValueType> functor(columnsAndValues, rowIndications, vector, result, summand);
+                storm::utility::parallel::execute(numberOfThreads, ranges.size() - 1, [&] (uint64_t range) { functor(ranges[range], ranges[range + 1]); });
+            }
+        }
+        
+        template<typename ValueType>
+        void multiplyWithInterleavedVectorsInRange(std::vector<MatrixEntry<typename SparseMatrix<ValueType>::index_type, ValueType>> const& columnsAndValues, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& vectors, std::vector<ValueType>& result, std::vector<ValueType> const* summands, uint64_t numberOfVectors, uint64_t startRow, uint64_t endRow) {
+            for (uint64_t row = startRow; row < endRow; ++row) {
+                auto resultIt = result.begin() + row * numberOfVectors;
+                auto resultIte = resultIt + numberOfVectors;
+                if (summands) {
+                    std::copy(summands->begin() + row * numberOfVectors, summands->begin() + (row + 1) * numberOfVectors, resultIt);
+                } else {
+                    std::fill(resultIt, resultIte, storm::utility::zero<ValueType>());
+                }
+                for (auto entryIt = columnsAndValues.begin() + rowIndications[row], entryIte = columnsAndValues.begin() + rowIndications[row + 1]; entryIt != entryIte; ++entryIt) {
+                    auto vectorIt = vectors.begin() + entryIt->getColumn() * numberOfVectors;
+                    for (auto it = resultIt; it != resultIte; ++it, ++vectorIt) {
+                        *it += entryIt->getValue() * *vectorIt;
+                    }
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithInterleavedVectors(std::vector<ValueType> const& vectors, std::vector<ValueType>& result, std::vector<value_type> const* summands, uint64_t numberOfVectors, uint64_t numberOfThreads) const {
+            STORM_LOG_ASSERT(&vectors != &result, "The input and the result of the multiplication must not be the same.");
+            STORM_LOG_ASSERT(vectors.size() == this->getColumnCount() * numberOfVectors, "Unexpected size of the input vectors.");
+            STORM_LOG_ASSERT(result.size() == this->getRowCount() * numberOfVectors, "Unexpected size of the result vectors.");
+            if (numberOfThreads > 1) {
+                std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, nullptr, numberOfThreads);
+                storm::utility::parallel::execute(numberOfThreads, ranges.size() - 1, [&] (uint64_t range) { multiplyWithInterleavedVectorsInRange(columnsAndValues, rowIndications, vectors, result, summands, numberOfVectors, ranges[range], ranges[range + 1]); });
+            } else {
+                multiplyWithInterleavedVectorsInRange(columnsAndValues, rowIndications, vectors, result, summands, numberOfVectors, 0, this->getRowCount());
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithInterleavedVectorsGaussSeidel(std::vector<ValueType>& vectors, std::vector<value_type> const* summands, uint64_t numberOfVectors, bool backward) const {
+            STORM_LOG_ASSERT(this->getRowCount() == this->getColumnCount(), "Gauss-Seidel style multiplications require a square matrix.");
+            STORM_LOG_ASSERT(vectors.size() == this->getRowCount() * numberOfVectors, "Unexpected size of the vectors.");
+            // The values of a row are first accumulated separately as the row may refer to itself.
+            std::vector<ValueType> rowValues(numberOfVectors);
+            uint64_t const rowCount = this->getRowCount();
+            for (uint64_t i = 0; i < rowCount; ++i) {
+                uint64_t row = backward ? rowCount - 1 - i : i;
+                if (summands) {
+                    std::copy(summands->begin() + row * numberOfVectors, summands->begin() + (row + 1) * numberOfVectors, rowValues.begin());
+                } else {
+                    std::fill(rowValues.begin(), rowValues.end(), storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : this->getRow(row)) {
+                    auto vectorIt = vectors.begin() + entry.getColumn() * numberOfVectors;
+                    for (auto& value : rowValues) {
+                        value += entry.getValue() * *vectorIt;
+                        ++vectorIt;
+                    }
+                }
+                std::copy(rowValues.begin(), rowValues.end(), vectors.begin() + row * numberOfVectors);
+            }
+        }
+        
         template<typename ValueType>
         ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
             ValueType result = storm::utility::zero<ValueType>();
@@ -1718,6 +1795,34 @@ namespace storm {
         }
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, MulticolorOrdering const& ordering, uint64_t numberOfThreads) const {
+            STORM_LOG_ASSERT(ordering.isComputedFor(nullptr), "The multicolor ordering does not match the rows of the matrix.");
+            ordering.process(false, numberOfThreads, [&] (uint64_t const* rowsBegin, uint64_t const* rowsEnd) {
+                for (uint64_t const* rowIt = rowsBegin; rowIt != rowsEnd; ++rowIt) {
+                    index_type const row = *rowIt;
+                    ValueType tmpValue = storm::utility::zero<ValueType>();
+                    ValueType diagonalElement = storm::utility::zero<ValueType>();
+                    for (auto const& entry : this->getRow(row)) {
+                        if (entry.getColumn() != row) {
+                            tmpValue += entry.getValue() * x[entry.getColumn()];
+                        } else {
+                            diagonalElement += entry.getValue();
+                        }
+                    }
+                    STORM_LOG_ASSERT(!storm::utility::isZero(diagonalElement), "Diagonal element of row " << row << " is zero.");
+                    x[row] = ((storm::utility::one<ValueType>() - omega) * x[row]) + (omega / diagonalElement) * (b[row] - tmpValue);
+                }
+            });
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<Interval>::performSuccessiveOverRelaxationStep(Interval, std::vector<Interval>&, std::vector<Interval> const&, MulticolorOrdering const&, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::performWalkerChaeStep(std::vector<ValueType> const& x, std::vector<ValueType> const& columnSums, std::vector<ValueType> const& b, std::vector<ValueType> const& ax, std::vector<ValueType>& result) const {
             const_iterator it = this->begin();
@@ -1929,22 +2034,26 @@ namespace storm {
         }
 #endif
         
-#ifdef STORM_HAVE_INTELTBB
         template <typename ValueType, typename Compare>
-        class TbbMultAddReduceFunctor {
+        class MultAddReduceFunctor {
         public:
             typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
             
-            TbbMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand, std::vector<uint_fast64_t>* choices) : rowGroupIndices(rowGroupIndices), columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand), choices(choices) {
+            MultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand, std::vector<uint_fast64_t>* choices) : rowGroupIndices(rowGroupIndices), columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand), choices(choices) {
                 // Intentionally left empty.
             }
             
+#ifdef STORM_HAVE_INTELTBB
             void operator()(tbb::blocked_range<index_type> const& range) const {
-
-                auto groupIt = rowGroupIndices.begin() + range.begin();
-                auto groupIte = rowGroupIndices.begin() + range.end();
+                (*this)(range.begin(), range.end());
+            }
+#endif
+            
+            void operator()(index_type startGroup, index_type endGroup) const {
+                auto groupIt = rowGroupIndices.begin() + startGroup;
+                auto groupIte = rowGroupIndices.begin() + endGroup;
                 
                 auto rowIt = rowIndications.begin() + *groupIt;
                 auto elementIt = columnsAndEntries.begin() + *rowIt;
@@ -1954,10 +2063,10 @@ namespace storm {
                 }
                 typename std::vector<uint_fast64_t>::iterator choiceIt;
                 if (choices) {
-                    choiceIt = choices->begin() + range.begin();
+                    choiceIt = choices->begin() + startGroup;
                 }
                 
-                auto resultIt = result.begin() + range.begin();
+                auto resultIt = result.begin() + startGroup;
                 
                 // Variables for correctly tracking choices (only update if new choice is strictly better).
                 ValueType oldSelectedChoiceValue;
@@ -2026,12 +2135,13 @@ namespace storm {
             std::vector<uint_fast64_t>* choices;
         };
         
+#ifdef STORM_HAVE_INTELTBB
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             if (dir == storm::OptimizationDirection::Minimize) {
-                tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
+                tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), MultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
             } else {
-                tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
+                tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), MultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
             }
         }
         
@@ -2043,6 +2153,114 @@ namespace storm {
 #endif
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                multiplyAndReduceParallel<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices, numberOfThreads);
+            } else {
+                multiplyAndReduceParallel<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices, numberOfThreads);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const {
+            // If the vector and the result are aliases, we need a temporary vector.
+            if (&vector == &result) {
+                STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+                std::vector<ValueType> temporary(result);
+                multiplyAndReduceParallel<Compare>(rowGroupIndices, vector, summand, temporary, choices, numberOfThreads);
+                std::swap(result, temporary);
+            } else {
+                std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, &rowGroupIndices, numberOfThreads);
+                MultAddReduceFunctor<ValueType, Compare> functor(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices);
+                storm::utility::parallel::execute(numberOfThreads, ranges.size() - 1, [&] (uint64_t range) { functor(ranges[range], ranges[range + 1]); });
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* summand, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorMulticolor(MulticolorOrdering const& ordering, std::vector<ValueType>& x, std::vector<ValueType> const* summand, bool backward, uint64_t numberOfThreads) const {
+            STORM_LOG_ASSERT(ordering.isComputedFor(nullptr), "The multicolor ordering does not match the rows of the matrix.");
+            ordering.process(backward, numberOfThreads, [&] (uint64_t const* rowsBegin, uint64_t const* rowsEnd) {
+                for (uint64_t const* rowIt = rowsBegin; rowIt != rowsEnd; ++rowIt) {
+                    ValueType newValue = summand ? (*summand)[*rowIt] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : this->getRow(*rowIt)) {
+                        newValue += entry.getValue() * x[entry.getColumn()];
+                    }
+                    x[*rowIt] = std::move(newValue);
+                }
+            });
+        }
+        
+        template<typename ValueType, typename Compare>
+        void multiplyAndReduceGroupsMulticolor(SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices, MulticolorOrdering const& ordering, std::vector<ValueType>& x, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices, bool backward, uint64_t numberOfThreads) {
+            ordering.process(backward, numberOfThreads, [&] (uint64_t const* groupsBegin, uint64_t const* groupsEnd) {
+                Compare compare;
+                
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                ValueType oldSelectedChoiceValue;
+                uint64_t selectedChoice;
+                
+                for (uint64_t const* groupIt = groupsBegin; groupIt != groupsEnd; ++groupIt) {
+                    uint64_t const group = *groupIt;
+                    uint64_t const firstRow = rowGroupIndices[group];
+                    uint64_t const endRow = rowGroupIndices[group + 1];
+                    
+                    // Only multiply and reduce if there is at least one row in the group.
+                    if (firstRow == endRow) {
+                        continue;
+                    }
+                    
+                    ValueType currentValue;
+                    for (uint64_t row = firstRow; row < endRow; ++row) {
+                        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                        for (auto const& entry : matrix.getRow(row)) {
+                            newValue += entry.getValue() * x[entry.getColumn()];
+                        }
+                        
+                        if (choices && row - firstRow == (*choices)[group]) {
+                            oldSelectedChoiceValue = newValue;
+                        }
+                        
+                        if (row == firstRow || compare(newValue, currentValue)) {
+                            currentValue = std::move(newValue);
+                            selectedChoice = row - firstRow;
+                        }
+                    }
+                    
+                    // Finally write value to target vector.
+                    if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                        (*choices)[group] = selectedChoice;
+                    }
+                    x[group] = std::move(currentValue);
+                }
+            });
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceMulticolor(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, MulticolorOrdering const& ordering, std::vector<ValueType>& x, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices, bool backward, uint64_t numberOfThreads) const {
+            STORM_LOG_ASSERT(ordering.isComputedFor(&rowGroupIndices), "The multicolor ordering does not match the row groups.");
+            if (dir == storm::OptimizationDirection::Minimize) {
+                multiplyAndReduceGroupsMulticolor<ValueType, storm::utility::ElementLess<ValueType>>(*this, rowGroupIndices, ordering, x, summand, choices, backward, numberOfThreads);
+            } else {
+                multiplyAndReduceGroupsMulticolor<ValueType, storm::utility::ElementGreater<ValueType>>(*this, rowGroupIndices, ordering, x, summand, choices, backward, numberOfThreads);
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceMulticolor(OptimizationDirection const&, std::vector<uint64_t> const&, MulticolorOrdering const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*, std::vector<uint_fast64_t>*, bool, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             
@@ -40,6 +40,8 @@ namespace storm {
         template<typename T>
         class SparseMatrix;
         
+        class MulticolorOrdering;
+        
         typedef uint_fast64_t SparseMatrixIndexType;
         
         template<typename IndexType, typename ValueType>
@@ -893,6 +895,37 @@ namespace storm {
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 #endif
             
+            /*!
+             * Multiplies the matrix with the given vector using the given number of threads. The rows are split into
+             * ranges with roughly the same number of entries.
+             */
+            void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand, uint64_t numberOfThreads) const;
+            
+            /*!
+             * Multiplies the matrix with several vectors at once. The vectors are stored interleaved, i.e., the i-th
+             * entry of the j-th vector is located at position i * numberOfVectors + j. This holds analogously for the
+             * result and the summands. As the entries of a row are only loaded once for all vectors, this is faster
+             * than multiplying the matrix with each vector separately.
+             *
+             * @param vectors The interleaved vectors with which to multiply the matrix.
+             * @param result The interleaved vectors that are supposed to hold the results. Must not be the same as the input.
+             * @param summands If given, these (interleaved) summands will be added to the results of the multiplication.
+             * @param numberOfVectors The number of vectors.
+             * @param numberOfThreads The number of threads to use.
+             */
+            void multiplyWithInterleavedVectors(std::vector<value_type> const& vectors, std::vector<value_type>& result, std::vector<value_type> const* summands, uint64_t numberOfVectors, uint64_t numberOfThreads = 1) const;
+            
+            /*!
+             * Performs a Gauss-Seidel style (in-place) multiplication of the matrix with several interleaved vectors
+             * (see multiplyWithInterleavedVectors).
+             *
+             * @param vectors The interleaved vectors with which to multiply. The results are written to the very same vectors.
+             * @param summands If given, these (interleaved) summands will be added to the results of the multiplication.
+             * @param numberOfVectors The number of vectors.
+             * @param backward If set, the rows are processed from the last to the first one.
+             */
+            void multiplyWithInterleavedVectorsGaussSeidel(std::vector<value_type>& vectors, std::vector<value_type> const* summands, uint64_t numberOfVectors, bool backward = true) const;
+            
             /*!
              * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
              * the result to the given result vector.
@@ -921,6 +954,33 @@ namespace storm {
             template<typename Compare>
             void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
 #endif
+            
+            /*!
+             * Multiplies and reduces using the given number of threads. The row groups are split into ranges with
+             * roughly the same number of entries.
+             */
+            void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const;
+            template<typename Compare>
+            void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t numberOfThreads) const;
+            
+            /*!
+             * Performs a Gauss-Seidel style (in-place) multiplication that visits the rows color by color according to
+             * the given multicolor ordering. The rows of one color are processed in parallel.
+             *
+             * @param ordering A multicolor ordering of the rows of this matrix.
+             * @param x The vector with which to multiply. The result is written to the very same vector.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param backward If set, the colors are visited in reverse order.
+             * @param numberOfThreads The number of threads to use.
+             */
+            void multiplyWithVectorMulticolor(MulticolorOrdering const& ordering, std::vector<value_type>& x, std::vector<value_type> const* summand, bool backward, uint64_t numberOfThreads) const;
+            
+            /*!
+             * Performs a Gauss-Seidel style (in-place) multiplication and reduction that visits the row groups color
+             * by color according to the given multicolor ordering. The groups of one color are processed in parallel.
+             * Choices are only updated if the new choice is strictly better.
+             */
+            void multiplyAndReduceMulticolor(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, MulticolorOrdering const& ordering, std::vector<ValueType>& x, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices, bool backward, uint64_t numberOfThreads) const;
 
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
@@ -964,6 +1024,12 @@ namespace storm {
              * @param b The 'right-hand side' of the problem.
              */
             void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Performs one step of the successive over-relaxation technique, where the rows are visited color by
+             * color according to the given multicolor ordering and the rows of one color are processed in parallel.
+             */
+            void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, MulticolorOrdering const& ordering, uint64_t numberOfThreads) const;
 
             /*!
              * Performs one step of the Walker-Chae technique.
@@ -1,10 +1,19 @@
 #include <storm/utility/vector.h>
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -152,6 +161,616 @@ namespace storm {
             }
         }
 
+        // Subproblems (and worklists) of the parallel SCC decomposition with less states are processed sequentially.
+        uint64_t const parallelSccThreshold = 1 << 14;
+        
+        // Systems with less states are decomposed sequentially, as the parallel SCC decomposition would not pay off.
+        uint64_t const parallelSccMinimalNumberOfStates = 4 * parallelSccThreshold;
+        
+        // The color of states whose SCC is already known.
+        uint64_t const parallelSccNoColor = std::numeric_limits<uint64_t>::max();
+        
+        /*!
+         * Computes the SCCs in parallel following the Multistep approach (Slota et al., "BFS and Coloring-Based Parallel
+         * Algorithms for Strongly Connected Components and Related Problems"). The states are partitioned into
+         * subproblems, each of which is a union of SCCs and is identified by a color. For each subproblem, states without
+         * predecessors or successors in the subproblem are trimmed first as they form singleton SCCs. Then, the first
+         * subproblem is split at the SCC of a pivot state that is obtained by a forward and a backward search (which
+         * typically finds a giant SCC). Further large subproblems are split by propagating state indices forward
+         * (coloring) and small subproblems are decomposed with Tarjan's algorithm. Independent subproblems are processed
+         * in parallel, large ones additionally use parallel trimming, searches and coloring.
+         *
+         * Apart from the predecessors, the algorithm stores four values per state: the color, the SCC and two values
+         * whose meaning depends on the step that is currently applied to the subproblem of the state.
+         */
+        template <typename ValueType>
+        class ParallelSccDecomposition {
+        public:
+            ParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices, uint64_t numberOfThreads) : transitionMatrix(transitionMatrix), subsystem(subsystem), choices(choices), numberOfThreads(numberOfThreads), numberOfStates(transitionMatrix.getRowGroupCount()), nextColor(1), numberOfFoundSccs(0) {
+                // Intentionally left empty.
+            }
+            
+            /*!
+             * Computes the SCCs. The results have the same format as the ones of the GCM algorithm. In particular, the
+             * SCCs are numbered in a reverse topological order, i.e., an SCC only reaches SCCs with a smaller index.
+             *
+             * @param nonTrivialStates A bit vector where entries for non-trivial states are set to true.
+             * @param stateToSccMapping A mapping from states to the SCC indices they belong to.
+             * @param sccCount The number of SCCs. As a side effect of this function, this count is increased.
+             * @param sccDepths If given, the depths of the SCCs are appended to this vector.
+             */
+            void perform(storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount, std::vector<uint_fast64_t>* sccDepths) {
+                initialize();
+                
+                // Process the subproblems round by round. Large subproblems that are created while processing a round
+                // are deferred to the next round such that they can be processed in parallel.
+                std::vector<Subproblem> subproblems(1);
+                subproblems.front().color = 0;
+                subproblems.front().splitAtPivot = true;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (isInSubsystem(state)) {
+                        subproblems.front().states.push_back(state);
+                    }
+                }
+                while (!subproblems.empty()) {
+                    std::vector<std::vector<Subproblem>> deferredSubproblems(subproblems.size());
+                    bool exclusive = subproblems.size() == 1;
+                    storm::utility::parallel::execute(numberOfThreads, subproblems.size(), [&] (uint64_t index) { processSubproblem(std::move(subproblems[index]), deferredSubproblems[index], exclusive); });
+                    subproblems.clear();
+                    for (auto& deferred : deferredSubproblems) {
+                        std::move(deferred.begin(), deferred.end(), std::back_inserter(subproblems));
+                    }
+                }
+                
+                sortSccsTopologically(nonTrivialStates, stateToSccMapping, sccCount, sccDepths);
+            }
+            
+        private:
+            struct Subproblem {
+                uint64_t color;
+                std::vector<uint64_t> states;
+                // If set, the subproblem is split at the SCC of a pivot state. Otherwise, the coloring approach is used.
+                bool splitAtPivot = false;
+            };
+            
+            bool isInSubsystem(uint64_t state) const {
+                return !subsystem || subsystem->get(state);
+            }
+            
+            template <typename Callback>
+            void forEachSuccessor(uint64_t state, Callback const& callback) const {
+                for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+                    if (choices && !choices->get(row)) {
+                        continue;
+                    }
+                    for (auto const& successor : transitionMatrix.getRow(row)) {
+                        if (isInSubsystem(successor.getColumn()) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                            callback(successor.getColumn());
+                        }
+                    }
+                }
+            }
+            
+            template <typename Callback>
+            void forEachPredecessor(uint64_t state, Callback const& callback) const {
+                for (uint64_t index = backwardIndications[state], indexEnd = backwardIndications[state + 1]; index != indexEnd; ++index) {
+                    callback(backwardStates[index]);
+                }
+            }
+            
+            uint64_t getNumberOfChunks(uint64_t numberOfItems, bool parallel) const {
+                if (!parallel || numberOfItems < parallelSccThreshold) {
+                    return 1;
+                }
+                return std::min<uint64_t>(4 * numberOfThreads, numberOfItems / (parallelSccThreshold / 4));
+            }
+            
+            /*!
+             * Splits the given states into chunks and calls the given function for each of them (in parallel if requested).
+             */
+            void executeOnChunks(std::vector<uint64_t> const& states, bool parallel, std::function<void(std::vector<uint64_t>::const_iterator, std::vector<uint64_t>::const_iterator, uint64_t)> const& function) const {
+                uint64_t numberOfChunks = getNumberOfChunks(states.size(), parallel);
+                storm::utility::parallel::execute(numberOfThreads, numberOfChunks, [&] (uint64_t chunk) { function(states.begin() + states.size() * chunk / numberOfChunks, states.begin() + states.size() * (chunk + 1) / numberOfChunks, chunk); });
+            }
+            
+            /*!
+             * Calls the given function for all states of the worklist and the states that it adds to the worklist. If
+             * requested and the worklist is large, the states are processed in parallel (in which case the function needs
+             * to make sure that no state is added twice).
+             */
+            void processWorklist(std::vector<uint64_t>&& worklist, bool parallel, std::function<void(uint64_t, std::vector<uint64_t>&)> const& function) const {
+                std::vector<std::vector<uint64_t>> newWorklists;
+                while (!worklist.empty()) {
+                    uint64_t numberOfChunks = getNumberOfChunks(worklist.size(), parallel);
+                    if (numberOfChunks == 1) {
+                        // Continue sequentially until the worklist is large enough to be split.
+                        while (!worklist.empty() && (!parallel || worklist.size() < parallelSccThreshold)) {
+                            uint64_t state = worklist.back();
+                            worklist.pop_back();
+                            function(state, worklist);
+                        }
+                    } else {
+                        newWorklists.assign(numberOfChunks, std::vector<uint64_t>());
+                        executeOnChunks(worklist, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t chunk) {
+                            for (; stateIt != stateIte; ++stateIt) {
+                                function(*stateIt, newWorklists[chunk]);
+                            }
+                        });
+                        worklist.clear();
+                        for (auto const& newWorklist : newWorklists) {
+                            worklist.insert(worklist.end(), newWorklist.begin(), newWorklist.end());
+                        }
+                    }
+                }
+            }
+            
+            void initialize() {
+                colors.reset(new std::atomic<uint64_t>[numberOfStates]);
+                firstStateValues.reset(new std::atomic<uint64_t>[numberOfStates]);
+                secondStateValues.reset(new std::atomic<uint64_t>[numberOfStates]);
+                rawSccIndices.assign(numberOfStates, 0);
+                
+                // Compute the predecessors of all states. They are sorted afterwards, so the result is deterministic.
+                std::atomic<uint64_t>* inDegrees = firstStateValues.get();
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    colors[state].store(isInSubsystem(state) ? 0 : parallelSccNoColor, std::memory_order_relaxed);
+                    inDegrees[state].store(0, std::memory_order_relaxed);
+                }
+                std::vector<uint64_t> states(numberOfStates);
+                std::iota(states.begin(), states.end(), 0);
+                bool parallel = numberOfThreads > 1;
+                executeOnChunks(states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        if (isInSubsystem(*stateIt)) {
+                            forEachSuccessor(*stateIt, [&] (uint64_t successor) { inDegrees[successor].fetch_add(1, std::memory_order_relaxed); });
+                        }
+                    }
+                });
+                backwardIndications.assign(numberOfStates + 1, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    backwardIndications[state + 1] = backwardIndications[state] + inDegrees[state].load(std::memory_order_relaxed);
+                    inDegrees[state].store(backwardIndications[state], std::memory_order_relaxed);
+                }
+                backwardStates.resize(backwardIndications.back());
+                executeOnChunks(states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        uint64_t state = *stateIt;
+                        if (isInSubsystem(state)) {
+                            forEachSuccessor(state, [&] (uint64_t successor) { backwardStates[inDegrees[successor].fetch_add(1, std::memory_order_relaxed)] = state; });
+                        }
+                    }
+                });
+                executeOnChunks(states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        std::sort(backwardStates.begin() + backwardIndications[*stateIt], backwardStates.begin() + backwardIndications[*stateIt + 1]);
+                    }
+                });
+            }
+            
+            /*!
+             * Iteratively removes the states of the subproblem that do not have a predecessor or a successor within the
+             * subproblem and assigns each of them to a singleton SCC.
+             *
+             * @return The remaining states of the subproblem.
+             */
+            std::vector<uint64_t> trim(Subproblem const& subproblem, bool parallel) {
+                uint64_t const color = subproblem.color;
+                auto isInSubproblem = [&] (uint64_t state) { return colors[state].load(std::memory_order_relaxed) == color; };
+                std::atomic<uint64_t>* inDegrees = firstStateValues.get();
+                std::atomic<uint64_t>* outDegrees = secondStateValues.get();
+                
+                // A state is removed by the thread that claims it, i.e., changes its color.
+                auto claim = [&] (uint64_t state, std::vector<uint64_t>& worklist) {
+                    uint64_t expected = color;
+                    if (colors[state].compare_exchange_strong(expected, parallelSccNoColor, std::memory_order_relaxed)) {
+                        worklist.push_back(state);
+                    }
+                };
+                
+                // Compute the degrees within the subproblem and claim the states for which one of them is zero.
+                executeOnChunks(subproblem.states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        uint64_t inDegree = 0;
+                        uint64_t outDegree = 0;
+                        forEachSuccessor(*stateIt, [&] (uint64_t successor) { outDegree += isInSubproblem(successor) ? 1 : 0; });
+                        forEachPredecessor(*stateIt, [&] (uint64_t predecessor) { inDegree += isInSubproblem(predecessor) ? 1 : 0; });
+                        inDegrees[*stateIt].store(inDegree, std::memory_order_relaxed);
+                        outDegrees[*stateIt].store(outDegree, std::memory_order_relaxed);
+                    }
+                });
+                std::vector<std::vector<uint64_t>> worklists(getNumberOfChunks(subproblem.states.size(), parallel));
+                executeOnChunks(subproblem.states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t chunk) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        if (inDegrees[*stateIt].load(std::memory_order_relaxed) == 0 || outDegrees[*stateIt].load(std::memory_order_relaxed) == 0) {
+                            claim(*stateIt, worklists[chunk]);
+                        }
+                    }
+                });
+                std::vector<uint64_t> worklist;
+                for (auto const& chunkWorklist : worklists) {
+                    worklist.insert(worklist.end(), chunkWorklist.begin(), chunkWorklist.end());
+                }
+                
+                // Remove the claimed states, which might in turn lead to claiming their neighbors.
+                processWorklist(std::move(worklist), parallel, [&] (uint64_t state, std::vector<uint64_t>& worklist) {
+                    rawSccIndices[state] = numberOfFoundSccs.fetch_add(1, std::memory_order_relaxed);
+                    forEachSuccessor(state, [&] (uint64_t successor) {
+                        if (isInSubproblem(successor) && inDegrees[successor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            claim(successor, worklist);
+                        }
+                    });
+                    forEachPredecessor(state, [&] (uint64_t predecessor) {
+                        if (isInSubproblem(predecessor) && outDegrees[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            claim(predecessor, worklist);
+                        }
+                    });
+                });
+                
+                std::vector<uint64_t> remainingStates;
+                for (auto state : subproblem.states) {
+                    if (isInSubproblem(state)) {
+                        remainingStates.push_back(state);
+                    }
+                }
+                return remainingStates;
+            }
+            
+            /*!
+             * Marks all states of the subproblem that are forward (or backward) reachable from the given pivot state with
+             * the color of the subproblem. The marks of the states of the subproblem need to be reset beforehand.
+             */
+            void search(uint64_t color, uint64_t pivot, bool forward, bool parallel) {
+                std::atomic<uint64_t>* marks = forward ? firstStateValues.get() : secondStateValues.get();
+                auto visit = [&] (uint64_t state, std::vector<uint64_t>& worklist) {
+                    if (colors[state].load(std::memory_order_relaxed) == color && marks[state].load(std::memory_order_relaxed) != color && marks[state].exchange(color, std::memory_order_relaxed) != color) {
+                        worklist.push_back(state);
+                    }
+                };
+                
+                std::vector<uint64_t> worklist;
+                visit(pivot, worklist);
+                processWorklist(std::move(worklist), parallel, [&] (uint64_t state, std::vector<uint64_t>& worklist) {
+                    if (forward) {
+                        forEachSuccessor(state, [&] (uint64_t successor) { visit(successor, worklist); });
+                    } else {
+                        forEachPredecessor(state, [&] (uint64_t predecessor) { visit(predecessor, worklist); });
+                    }
+                });
+            }
+            
+            /*!
+             * Splits the (large) subproblem into the SCC of a pivot state with many predecessors and successors, which is
+             * likely to be a large SCC, and the three remaining subproblems (only forward reachable, only backward
+             * reachable, neither).
+             */
+            void splitAtPivotScc(uint64_t color, std::vector<uint64_t> const& states, bool parallel, std::vector<Subproblem>& newSubproblems) {
+                // The pivot is selected based on the degrees obtained while trimming. Afterwards, the same storage holds
+                // the marks of the searches.
+                std::atomic<uint64_t>* inDegrees = firstStateValues.get();
+                std::atomic<uint64_t>* outDegrees = secondStateValues.get();
+                std::atomic<uint64_t>* forwardMarks = firstStateValues.get();
+                std::atomic<uint64_t>* backwardMarks = secondStateValues.get();
+                uint64_t pivot = states.front();
+                uint64_t bestDegreeProduct = 0;
+                for (auto state : states) {
+                    uint64_t degreeProduct = inDegrees[state].load(std::memory_order_relaxed) * outDegrees[state].load(std::memory_order_relaxed);
+                    if (degreeProduct > bestDegreeProduct) {
+                        pivot = state;
+                        bestDegreeProduct = degreeProduct;
+                    }
+                }
+                executeOnChunks(states, parallel, [&] (std::vector<uint64_t>::const_iterator stateIt, std::vector<uint64_t>::const_iterator stateIte, uint64_t) {
+                    for (; stateIt != stateIte; ++stateIt) {
+                        forwardMarks[*stateIt].store(parallelSccNoColor, std::memory_order_relaxed);
+                        backwardMarks[*stateIt].store(parallelSccNoColor, std::memory_order_relaxed);
+                    }
+                });
+                search(color, pivot, true, parallel);
+                search(color, pivot, false, parallel);
+                
+                uint64_t const scc = numberOfFoundSccs.fetch_add(1, std::memory_order_relaxed);
+                newSubproblems.resize(3);
+                for (auto& newSubproblem : newSubproblems) {
+                    newSubproblem.color = nextColor.fetch_add(1, std::memory_order_relaxed);
+                }
+                for (auto state : states) {
+                    bool forwardReachable = forwardMarks[state].load(std::memory_order_relaxed) == color;
+                    bool backwardReachable = backwardMarks[state].load(std::memory_order_relaxed) == color;
+                    if (forwardReachable && backwardReachable) {
+                        rawSccIndices[state] = scc;
+                        colors[state].store(parallelSccNoColor, std::memory_order_relaxed);
+                    } else {
+                        Subproblem& newSubproblem = newSubproblems[forwardReachable ? 0 : (backwardReachable ? 1 : 2)];
+                        colors[state].store(newSubproblem.color, std::memory_order_relaxed);
+                        newSubproblem.states.push_back(state);
+                    }
+                }
+            }
+            
+            /*!
+             * Propagates the largest state index forward until each state is labeled with the largest index of a state
+             * that reaches it. The states that have the same label as a root (a state labeled with its own index) and
+             * reach that root form its SCC. All such SCCs are removed and the remaining states form a new subproblem.
+             */
+            void splitByColoring(uint64_t color, std::vector<uint64_t> const& states, bool parallel, std::vector<Subproblem>& newSubproblems) {
+                auto isInSubproblem = [&] (uint64_t state) { return colors[state].load(std::memory_order_relaxed) == color; };
+                // For each state the largest index of a state that reaches it and whether it is queued.
+                std::atomic<uint64_t>* labels = firstStateValues.get();
+                std::atomic<uint64_t>* queued = secondStateValues.get();
+                for (auto state : states) {
+                    labels[state].store(state, std::memory_order_relaxed);
+                    queued[state].store(1, std::memory_order_relaxed);
+                }
+                
+                // A state is queued again if its label increases after it was processed.
+                processWorklist(std::vector<uint64_t>(states), parallel, [&] (uint64_t state, std::vector<uint64_t>& worklist) {
+                    queued[state].store(0);
+                    uint64_t label = labels[state].load();
+                    forEachSuccessor(state, [&] (uint64_t successor) {
+                        if (isInSubproblem(successor)) {
+                            uint64_t successorLabel = labels[successor].load();
+                            while (successorLabel < label && !labels[successor].compare_exchange_weak(successorLabel, label)) {
+                                // Intentionally left empty.
+                            }
+                            if (successorLabel < label && queued[successor].exchange(1) == 0) {
+                                worklist.push_back(successor);
+                            }
+                        }
+                    });
+                });
+                
+                // The SCCs of the roots are independent, so they can be computed in parallel.
+                std::vector<uint64_t> roots;
+                for (auto state : states) {
+                    if (labels[state].load(std::memory_order_relaxed) == state) {
+                        roots.push_back(state);
+                    }
+                }
+                executeOnChunks(roots, parallel, [&] (std::vector<uint64_t>::const_iterator rootIt, std::vector<uint64_t>::const_iterator rootIte, uint64_t) {
+                    std::vector<uint64_t> stack;
+                    for (; rootIt != rootIte; ++rootIt) {
+                        uint64_t const root = *rootIt;
+                        uint64_t const scc = numberOfFoundSccs.fetch_add(1, std::memory_order_relaxed);
+                        rawSccIndices[root] = scc;
+                        colors[root].store(parallelSccNoColor, std::memory_order_relaxed);
+                        stack.push_back(root);
+                        while (!stack.empty()) {
+                            uint64_t state = stack.back();
+                            stack.pop_back();
+                            forEachPredecessor(state, [&] (uint64_t predecessor) {
+                                if (isInSubproblem(predecessor) && labels[predecessor].load(std::memory_order_relaxed) == root) {
+                                    rawSccIndices[predecessor] = scc;
+                                    colors[predecessor].store(parallelSccNoColor, std::memory_order_relaxed);
+                                    stack.push_back(predecessor);
+                                }
+                            });
+                        }
+                    }
+                });
+                
+                newSubproblems.resize(1);
+                newSubproblems.front().color = nextColor.fetch_add(1, std::memory_order_relaxed);
+                for (auto state : states) {
+                    if (isInSubproblem(state)) {
+                        colors[state].store(newSubproblems.front().color, std::memory_order_relaxed);
+                        newSubproblems.front().states.push_back(state);
+                    }
+                }
+            }
+            
+            /*!
+             * Computes the SCCs of the given (small) subproblem with Tarjan's algorithm.
+             */
+            void decomposeSequentially(uint64_t color, std::vector<uint64_t> const& states) {
+                // Build the (local) transition relation of the subproblem.
+                std::atomic<uint64_t>* localIndices = firstStateValues.get();
+                for (uint64_t localIndex = 0; localIndex < states.size(); ++localIndex) {
+                    localIndices[states[localIndex]].store(localIndex, std::memory_order_relaxed);
+                }
+                std::vector<uint64_t> successorIndications(1, 0);
+                std::vector<uint64_t> successors;
+                for (auto state : states) {
+                    forEachSuccessor(state, [&] (uint64_t successor) {
+                        if (colors[successor].load(std::memory_order_relaxed) == color) {
+                            successors.push_back(localIndices[successor].load(std::memory_order_relaxed));
+                        }
+                    });
+                    successorIndications.push_back(successors.size());
+                }
+                
+                uint64_t const unvisited = std::numeric_limits<uint64_t>::max();
+                std::vector<uint64_t> indices(states.size(), unvisited);
+                std::vector<uint64_t> lowlinks(states.size());
+                std::vector<uint64_t> nextSuccessors(successorIndications.begin(), successorIndications.end() - 1);
+                std::vector<bool> onStack(states.size(), false);
+                std::vector<uint64_t> sccStack;
+                std::vector<uint64_t> callStack;
+                uint64_t currentIndex = 0;
+                auto visit = [&] (uint64_t localState) {
+                    indices[localState] = lowlinks[localState] = currentIndex++;
+                    sccStack.push_back(localState);
+                    onStack[localState] = true;
+                    callStack.push_back(localState);
+                };
+                for (uint64_t root = 0; root < states.size(); ++root) {
+                    if (indices[root] != unvisited) {
+                        continue;
+                    }
+                    visit(root);
+                    while (!callStack.empty()) {
+                        uint64_t localState = callStack.back();
+                        if (nextSuccessors[localState] != successorIndications[localState + 1]) {
+                            uint64_t successor = successors[nextSuccessors[localState]++];
+                            if (indices[successor] == unvisited) {
+                                visit(successor);
+                            } else if (onStack[successor]) {
+                                lowlinks[localState] = std::min(lowlinks[localState], indices[successor]);
+                            }
+                            continue;
+                        }
+                        
+                        callStack.pop_back();
+                        if (!callStack.empty()) {
+                            lowlinks[callStack.back()] = std::min(lowlinks[callStack.back()], lowlinks[localState]);
+                        }
+                        if (lowlinks[localState] == indices[localState]) {
+                            uint64_t const scc = numberOfFoundSccs.fetch_add(1, std::memory_order_relaxed);
+                            uint64_t sccState;
+                            do {
+                                sccState = sccStack.back();
+                                sccStack.pop_back();
+                                onStack[sccState] = false;
+                                rawSccIndices[states[sccState]] = scc;
+                            } while (sccState != localState);
+                        }
+                    }
+                }
+                for (auto state : states) {
+                    colors[state].store(parallelSccNoColor, std::memory_order_relaxed);
+                }
+            }
+            
+            /*!
+             * Processes the given subproblem. Resulting subproblems are processed directly unless they are large, in
+             * which case they are added to the given deferred subproblems.
+             *
+             * @param exclusive If set, this is the only subproblem of the current round so that its trimming and searches
+             * can be parallelized.
+             */
+            void processSubproblem(Subproblem&& initialSubproblem, std::vector<Subproblem>& deferredSubproblems, bool exclusive) {
+                std::vector<Subproblem> stack;
+                stack.push_back(std::move(initialSubproblem));
+                while (!stack.empty()) {
+                    Subproblem subproblem = std::move(stack.back());
+                    stack.pop_back();
+                    bool parallel = exclusive && numberOfThreads > 1;
+                    
+                    std::vector<uint64_t> states = trim(subproblem, parallel);
+                    if (states.empty()) {
+                        continue;
+                    } else if (states.size() < parallelSccThreshold) {
+                        decomposeSequentially(subproblem.color, states);
+                        continue;
+                    }
+                    
+                    std::vector<Subproblem> newSubproblems;
+                    if (subproblem.splitAtPivot) {
+                        splitAtPivotScc(subproblem.color, states, parallel, newSubproblems);
+                    } else {
+                        splitByColoring(subproblem.color, states, parallel, newSubproblems);
+                    }
+                    for (auto& newSubproblem : newSubproblems) {
+                        if (newSubproblem.states.size() >= parallelSccThreshold) {
+                            deferredSubproblems.push_back(std::move(newSubproblem));
+                        } else if (!newSubproblem.states.empty()) {
+                            stack.push_back(std::move(newSubproblem));
+                        }
+                    }
+                }
+            }
+            
+            /*!
+             * Numbers the found SCCs such that an SCC only reaches SCCs with a smaller index and computes their depths.
+             * Starting from the bottom SCCs (ordered by their smallest state), an SCC is numbered as soon as all SCCs it
+             * reaches are numbered. Hence, the result does not depend on the order in which the SCCs were found.
+             */
+            void sortSccsTopologically(storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount, std::vector<uint_fast64_t>* sccDepths) const {
+                uint64_t numberOfSccs = numberOfFoundSccs.load();
+                
+                // Group the states by their SCCs and count the transitions leaving each SCC.
+                std::vector<uint64_t> sccStateIndications(numberOfSccs + 1, 0);
+                std::vector<uint64_t> remainingLeavingTransitions(numberOfSccs, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (isInSubsystem(state)) {
+                        uint64_t scc = rawSccIndices[state];
+                        ++sccStateIndications[scc + 1];
+                        forEachSuccessor(state, [&] (uint64_t successor) {
+                            if (successor == state) {
+                                nonTrivialStates.set(state, true);
+                            } else if (rawSccIndices[successor] != scc) {
+                                ++remainingLeavingTransitions[scc];
+                            }
+                        });
+                    }
+                }
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    sccStateIndications[scc + 1] += sccStateIndications[scc];
+                }
+                std::vector<uint64_t> sccStates(sccStateIndications.back());
+                std::vector<uint64_t> positions(sccStateIndications.begin(), sccStateIndications.end() - 1);
+                std::vector<uint64_t> queue;
+                queue.reserve(numberOfSccs);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (isInSubsystem(state)) {
+                        uint64_t scc = rawSccIndices[state];
+                        if (positions[scc] == sccStateIndications[scc] && remainingLeavingTransitions[scc] == 0) {
+                            queue.push_back(scc);
+                        }
+                        if (sccStateIndications[scc + 1] - sccStateIndications[scc] > 1) {
+                            nonTrivialStates.set(state, true);
+                        }
+                        sccStates[positions[scc]++] = state;
+                    }
+                }
+                
+                std::vector<uint64_t> depths(numberOfSccs, 0);
+                std::vector<uint64_t> sortedSccIndices(numberOfSccs);
+                for (uint64_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex) {
+                    uint64_t scc = queue[queueIndex];
+                    sortedSccIndices[scc] = sccCount + queueIndex;
+                    if (sccDepths) {
+                        sccDepths->push_back(depths[scc]);
+                    }
+                    for (uint64_t index = sccStateIndications[scc]; index < sccStateIndications[scc + 1]; ++index) {
+                        forEachPredecessor(sccStates[index], [&] (uint64_t predecessor) {
+                            uint64_t predecessorScc = rawSccIndices[predecessor];
+                            if (predecessorScc != scc) {
+                                depths[predecessorScc] = std::max(depths[predecessorScc], depths[scc] + 1);
+                                if (--remainingLeavingTransitions[predecessorScc] == 0) {
+                                    queue.push_back(predecessorScc);
+                                }
+                            }
+                        });
+                    }
+                }
+                STORM_LOG_ASSERT(queue.size() == numberOfSccs, "Unexpected number of sorted SCCs.");
+                
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (isInSubsystem(state)) {
+                        stateToSccMapping[state] = sortedSccIndices[rawSccIndices[state]];
+                    }
+                }
+                sccCount += numberOfSccs;
+            }
+            
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+            storm::storage::BitVector const* subsystem;
+            storm::storage::BitVector const* choices;
+            uint64_t numberOfThreads;
+            uint64_t numberOfStates;
+            
+            // The predecessors of the states within the subsystem.
+            std::vector<uint64_t> backwardIndications;
+            std::vector<uint64_t> backwardStates;
+            
+            // For each state the color of its subproblem.
+            std::unique_ptr<std::atomic<uint64_t>[]> colors;
+            // Two values for each state that are used by the step that is currently applied to its subproblem. As the
+            // subproblems are disjoint, the steps of different subproblems do not interfere.
+            // - Trimming: the number of predecessors (successors) in the subproblem that are not yet trimmed.
+            // - Splitting at a pivot: whether the state was found by the forward (backward) search.
+            // - Coloring: the largest index of a state that reaches the state and whether the state is queued.
+            // - Sequential decomposition: the index of the state within the subproblem (only the first value).
+            std::unique_ptr<std::atomic<uint64_t>[]> firstStateValues;
+            std::unique_ptr<std::atomic<uint64_t>[]> secondStateValues;
+            
+            // For each state the index of its SCC in the order in which the SCCs were found.
+            std::vector<uint64_t> rawSccIndices;
+            
+            std::atomic<uint64_t> nextColor;
+            std::atomic<uint64_t> numberOfFoundSccs;
+        };
+        
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
             
@@ -193,7 +812,10 @@ namespace storm {
                 
                 // Start the search for SCCs from every state in the block.
                 uint_fast64_t currentIndex = 0;
-                if (options.subsystemPtr) {
+                uint64_t numberOfSubsystemStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
+                if (options.threads > 1 && numberOfSubsystemStates >= parallelSccMinimalNumberOfStates) {
+                    ParallelSccDecomposition<ValueType>(transitionMatrix, options.subsystemPtr, options.choicesPtr, options.threads).perform(nonTrivialStates, stateToSccMapping, sccCount, sccDepthsPtr);
+                } else if (options.subsystemPtr) {
                     for (auto state : *options.subsystemPtr) {
                         if (!hasPreorderNumber.get(state)) {
                             performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, recursionStateStack, s, p, stateHasScc, stateToSccMapping, sccCount, options.isTopologicalSortForced, sccDepthsPtr);
@@ -31,6 +31,8 @@ namespace storm {
             StronglyConnectedComponentDecompositionOptions& forceTopologicalSort(bool value = true) { isTopologicalSortForced = value; return *this; }
             /// Sets if scc depths can be retrieved.
             StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true) { isComputeSccDepthsSet = value; return *this; }
+            /// Sets the number of threads. If more than one thread is used and the system is large, the SCCs are computed with a parallel algorithm (trimming, forward-backward search and coloring).
+            StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value) { threads = value; return *this; }
             
             storm::storage::BitVector const* subsystemPtr = nullptr;
             storm::storage::BitVector const* choicesPtr = nullptr;
@@ -38,6 +40,7 @@ namespace storm {
             bool areOnlyBottomSccsConsidered = false;
             bool isTopologicalSortForced = false;
             bool isComputeSccDepthsSet = false;
+            uint64_t threads = 1;
             
         };
         
@@ -304,7 +304,9 @@ namespace storm {
 
             // Check the reward models.
             for (auto const& rewardModel : this->getRewardModels()) {
-                rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables);
+                if (!rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables)) {
+                    return false;
+                }
             }
 
             // Initial construct.
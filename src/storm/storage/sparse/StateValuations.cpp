@@ -1,23 +1,62 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/OutOfRangeException.h"
 
 namespace storm {
     namespace storage {
         namespace sparse {
             
-            StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) : booleanValues(std::move(booleanValues)), integerValues(std::move(integerValues)), rationalValues(std::move(rationalValues)), observationLabelValues(std::move(observationLabelValues)) {
-                // Intentionally left empty
+            StateValuations::StateValuations() : numberOfRationalVariables(0), bitsPerValuation(1), numberOfStates(0) {
+                // Intentionally left empty.
+            }
+            
+            StateValuations::StateValuations(StateValuations const& layout, uint64_t numberOfStates) : variableToIndexMap(layout.variableToIndexMap), observationLabels(layout.observationLabels), booleanBitOffsets(layout.booleanBitOffsets), integerEncodings(layout.integerEncodings), labelBitOffsets(layout.labelBitOffsets), numberOfRationalVariables(layout.numberOfRationalVariables), bitsPerValuation(layout.bitsPerValuation), numberOfStates(numberOfStates), packedValuations(numberOfStates * layout.bitsPerValuation), rationalValues(numberOfStates * layout.numberOfRationalVariables) {
+                // Intentionally left empty.
+            }
+            
+            uint64_t StateValuations::getValuationOffset(storm::storage::sparse::state_type const& stateIndex) const {
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
+                return stateIndex * bitsPerValuation;
+            }
+            
+            bool StateValuations::getBooleanValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const {
+                return packedValuations.get(getValuationOffset(stateIndex) + booleanBitOffsets[index]);
+            }
+            
+            int64_t StateValuations::getIntegerValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const {
+                IntegerEncoding const& encoding = integerEncodings[index];
+                if (encoding.bitWidth == 0) {
+                    return encoding.lowerBound;
+                }
+                return encoding.lowerBound + static_cast<int64_t>(packedValuations.getAsInt(getValuationOffset(stateIndex) + encoding.bitOffset, encoding.bitWidth));
+            }
+            
+            storm::RationalNumber const& StateValuations::getRationalValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const {
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
+                return rationalValues[stateIndex * numberOfRationalVariables + index];
+            }
+            
+            int64_t StateValuations::getLabelValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const {
+                return static_cast<int64_t>(packedValuations.getAsInt(getValuationOffset(stateIndex) + labelBitOffsets[index], 64));
             }
             
-            typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-                STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-                STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-                return valuations[stateIndex];
+            void StateValuations::copyValuation(StateValuations const& source, storm::storage::sparse::state_type sourceState, storm::storage::sparse::state_type targetState) {
+                STORM_LOG_ASSERT(source.bitsPerValuation == bitsPerValuation && source.numberOfRationalVariables == numberOfRationalVariables, "Valuations have different layouts.");
+                uint64_t sourceOffset = source.getValuationOffset(sourceState);
+                uint64_t targetOffset = getValuationOffset(targetState);
+                // Copy the packed valuation in chunks of (at most) 64 bits without decoding the individual values.
+                for (uint64_t bit = 0; bit < bitsPerValuation; bit += 64) {
+                    uint64_t numberOfBits = std::min<uint64_t>(64, bitsPerValuation - bit);
+                    packedValuations.setFromInt(targetOffset + bit, numberOfBits, source.packedValuations.getAsInt(sourceOffset + bit, numberOfBits));
+                }
+                std::copy_n(source.rationalValues.begin() + sourceState * numberOfRationalVariables, numberOfRationalVariables, rationalValues.begin() + targetState * numberOfRationalVariables);
             }
 
             StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -26,9 +65,10 @@ namespace storm {
                                                                     typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                                     typename std::map<std::string, uint64_t>::const_iterator labelBegin,
                                                                     typename std::map<std::string, uint64_t>::const_iterator labelEnd,
-                                                                    StateValuation const* valuation) : variableIt(variableIt), labelIt(labelIt),
+                                                                    StateValuations const* valuations,
+                                                                    storm::storage::sparse::state_type state) : variableIt(variableIt), labelIt(labelIt),
                                                                     variableBegin(variableBegin), variableEnd(variableEnd),
-                                                                    labelBegin(labelBegin), labelEnd(labelEnd), valuation(valuation) {
+                                                                    labelBegin(labelBegin), labelEnd(labelEnd), valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
 
@@ -62,27 +102,27 @@ namespace storm {
 
             bool StateValuations::StateValueIterator::getBooleanValue() const {
                 STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-                return valuation->booleanValues[variableIt->second];
+                return valuations->getBooleanValueAtIndex(state, variableIt->second);
             }
             
             int64_t StateValuations::StateValueIterator::getIntegerValue() const {
                 STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-                return valuation->integerValues[variableIt->second];
+                return valuations->getIntegerValueAtIndex(state, variableIt->second);
             }
 
             int64_t StateValuations::StateValueIterator::getLabelValue() const {
                 STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-                STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(), "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-                return valuation->observationLabelValues[labelIt->second];
+                STORM_LOG_ASSERT(labelIt->second < valuations->labelBitOffsets.size(), "Label index " << labelIt->second << " larger than number of labels " << valuations->labelBitOffsets.size());
+                return valuations->getLabelValueAtIndex(state, labelIt->second);
             }
 
             storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
                 STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-                return valuation->rationalValues[variableIt->second];
+                return valuations->getRationalValueAtIndex(state, variableIt->second);
             }
             
             bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-                STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+                STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
                 return variableIt == other.variableIt && labelIt == other.labelIt;
             }
             bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -108,39 +148,39 @@ namespace storm {
                 return *this;
             }
             
-            StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation) : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+            StateValuations::StateValueIteratorRange::StateValueIteratorRange(StateValuations const& valuations, storm::storage::sparse::state_type state) : valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-                return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+                auto const& variableMap = valuations.variableToIndexMap;
+                auto const& labelMap = valuations.observationLabels;
+                return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), &valuations, state);
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-                return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(),  valuation);
+                auto const& variableMap = valuations.variableToIndexMap;
+                auto const& labelMap = valuations.observationLabels;
+                return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), &valuations, state);
             }
             
             bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-                auto const& valuation = getValuation(stateIndex);
                 STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-                return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+                return getBooleanValueAtIndex(stateIndex, variableToIndexMap.at(booleanVariable));
             }
             
-            int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+            int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
                 STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-                return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+                return getIntegerValueAtIndex(stateIndex, variableToIndexMap.at(integerVariable));
             }
             
             storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const {
-                auto const& valuation = getValuation(stateIndex);
                 STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-                return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+                return getRationalValueAtIndex(stateIndex, variableToIndexMap.at(rationalVariable));
             }
             
             bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-                auto const& valuation = valuations[stateIndex]; // Do not use getValuations, as that is only valid after adding stuff.
-                return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+                return stateIndex >= numberOfStates || !packedValuations.get(getValuationOffset(stateIndex));
             }
             
             std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
@@ -229,42 +269,6 @@ namespace storm {
                 return result;
             }
             
-            bool StateValuations::assertValuation(StateValuation const& valuation) const {
-                storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-                storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-                storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-                for (auto const& varIndex : variableToIndexMap) {
-                    storm::storage::BitVector* bv;
-                    if (varIndex.first.hasBooleanType()) {
-                        bv = &foundBooleanValues;
-                    } else if (varIndex.first.hasIntegerType()) {
-                        bv = &foundIntegerValues;
-                    } else if (varIndex.first.hasRationalType()) {
-                        bv = &foundRationalValues;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-                    }
-                    if (varIndex.second < bv->size()) {
-                        if (bv->get(varIndex.second)) {
-                            STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                            return false;
-                        }
-                        bv->set(varIndex.second, true);
-                    } else {
-                        STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-                        return false;
-                    }
-                }
-                if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-                    STORM_LOG_ERROR("Valuation has too many entries.");
-                }
-                return true;
-            }
-            
-            StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations) : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-                // Intentionally left empty
-            }
-            
             std::string StateValuations::getStateInfo(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
                 return this->toString(state);
@@ -272,11 +276,11 @@ namespace storm {
             
             typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-                return StateValueIteratorRange({variableToIndexMap, observationLabels,  &(valuations[state])});
+                return StateValueIteratorRange(*this, state);
             }
             
             uint_fast64_t StateValuations::getNumberOfStates() const {
-                return valuations.size();
+                return numberOfStates;
             }
 
             std::size_t StateValuations::hash() const {
@@ -284,28 +288,32 @@ namespace storm {
             }
             
             StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-                return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+                StateValuations result(*this, selectedStates.getNumberOfSetBits());
+                storm::storage::sparse::state_type newState = 0;
+                for (auto const& selectedState : selectedStates) {
+                    result.copyValuation(*this, selectedState, newState);
+                    ++newState;
+                }
+                return result;
             }
 
             StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-                std::vector<StateValuation> selectedValuations;
-                selectedValuations.reserve(selectedStates.size());
-                for (auto const& selectedState : selectedStates){
-                    if (selectedState < valuations.size()) {
-                        selectedValuations.push_back(valuations[selectedState]);
-                    } else {
-                        selectedValuations.emplace_back();
+                StateValuations result(*this, selectedStates.size());
+                for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+                    // States with an invalid index keep their empty valuation.
+                    if (selectedStates[newState] < numberOfStates) {
+                        result.copyValuation(*this, selectedStates[newState], newState);
                     }
                 }
-                return StateValuations(variableToIndexMap, std::move(selectedValuations));
+                return result;
             }
 
             StateValuations StateValuations::blowup(const std::vector<uint64_t> &mapNewToOld) const {
-                std::vector<StateValuation> newValuations;
-                for( auto const& oldState : mapNewToOld) {
-                    newValuations.push_back(valuations[oldState]);
+                StateValuations result(*this, mapNewToOld.size());
+                for (uint64_t newState = 0; newState < mapNewToOld.size(); ++newState) {
+                    result.copyValuation(*this, mapNewToOld[newState], newState);
                 }
-                return StateValuations(variableToIndexMap, std::move(newValuations));
+                return result;
             }
             
             StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -313,32 +321,73 @@ namespace storm {
             }
             
             void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-                STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+                if (variable.hasIntegerType()) {
+                    // Without further knowledge, all 64 bits are needed.
+                    addVariable(variable, 0, 64);
+                    return;
+                }
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
                 STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
                 if (variable.hasBooleanType()) {
                     currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
-                }
-                if (variable.hasIntegerType()) {
-                    currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                    currentStateValuations.booleanBitOffsets.push_back(currentStateValuations.bitsPerValuation);
+                    ++currentStateValuations.bitsPerValuation;
                 }
                 if (variable.hasRationalType()) {
                     currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+                    ++currentStateValuations.numberOfRationalVariables;
                 }
             }
+            
+            void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, uint64_t bitWidth) {
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
+                STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
+                STORM_LOG_ASSERT(variable.hasIntegerType(), "Variable " << variable.getName() << " has no integer type.");
+                STORM_LOG_ASSERT(bitWidth <= 64, "Illegal bit width " << bitWidth << ".");
+                currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                currentStateValuations.integerEncodings.push_back(StateValuations::IntegerEncoding{currentStateValuations.bitsPerValuation, bitWidth, lowerBound});
+                currentStateValuations.bitsPerValuation += bitWidth;
+            }
 
             void StateValuationsBuilder::addObservationLabel(const std::string &label) {
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a label, although a state has already been added before.");
                 currentStateValuations.observationLabels[label] = labelCount++;
+                currentStateValuations.labelBitOffsets.push_back(currentStateValuations.bitsPerValuation);
+                currentStateValuations.bitsPerValuation += 64;
             }
             
             void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,std::vector<int64_t>&& observationLabelValues) {
-                if (state > currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.resize(state);
-                }
-                if (state == currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(observationLabelValues));
+                StateValuations& valuations = currentStateValuations;
+                STORM_LOG_ASSERT(booleanValues.size() == valuations.booleanBitOffsets.size(), "Unexpected number of boolean values.");
+                STORM_LOG_ASSERT(integerValues.size() == valuations.integerEncodings.size(), "Unexpected number of integer values.");
+                STORM_LOG_ASSERT(rationalValues.size() == valuations.numberOfRationalVariables, "Unexpected number of rational values.");
+                STORM_LOG_ASSERT(observationLabelValues.size() == valuations.labelBitOffsets.size(), "Unexpected number of label values.");
+                
+                if (state >= valuations.numberOfStates) {
+                    // States may be added in any order, so we possibly leave a gap of empty valuations.
+                    valuations.numberOfStates = state + 1;
+                    valuations.packedValuations.grow(valuations.numberOfStates * valuations.bitsPerValuation);
+                    valuations.rationalValues.resize(valuations.numberOfStates * valuations.numberOfRationalVariables);
                 } else {
-                    STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-                    currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(observationLabelValues));
+                    STORM_LOG_ASSERT(valuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
+                }
+                
+                uint64_t offset = valuations.getValuationOffset(state);
+                valuations.packedValuations.set(offset);
+                for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+                    valuations.packedValuations.set(offset + valuations.booleanBitOffsets[index], booleanValues[index]);
+                }
+                for (uint64_t index = 0; index < integerValues.size(); ++index) {
+                    StateValuations::IntegerEncoding const& encoding = valuations.integerEncodings[index];
+                    uint64_t encodedValue = static_cast<uint64_t>(integerValues[index]) - static_cast<uint64_t>(encoding.lowerBound);
+                    STORM_LOG_THROW(encoding.bitWidth == 64 || (integerValues[index] >= encoding.lowerBound && (encodedValue >> encoding.bitWidth) == 0), storm::exceptions::OutOfRangeException, "Value " << integerValues[index] << " is out of the range of the corresponding variable.");
+                    if (encoding.bitWidth > 0) {
+                        valuations.packedValuations.setFromInt(offset + encoding.bitOffset, encoding.bitWidth, encodedValue);
+                    }
+                }
+                std::move(rationalValues.begin(), rationalValues.end(), valuations.rationalValues.begin() + state * valuations.numberOfRationalVariables);
+                for (uint64_t index = 0; index < observationLabelValues.size(); ++index) {
+                    valuations.packedValuations.setFromInt(offset + valuations.labelBitOffsets[index], 64, static_cast<uint64_t>(observationLabelValues[index]));
                 }
             }
 
@@ -355,11 +404,15 @@ namespace storm {
             }
             
             StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-                return std::move(currentStateValuations);
+                // The buffers are moved (instead of copied to buffers of the exact size), so the valuations are never held
+                // twice. This leaves the spare capacity of the buffers in place.
+                StateValuations result = std::move(currentStateValuations);
+                currentStateValuations = StateValuations();
                 booleanVarCount = 0;
                 integerVarCount = 0;
                 rationalVarCount = 0;
                 labelCount = 0;
+                return result;
             }
             
             template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const& , boost::optional<std::set<storm::expressions::Variable>> const&) const;
@@ -16,25 +16,19 @@ namespace storm {
             
             class StateValuationsBuilder;
             
-            // A structure holding information about the reachable state space that can be retrieved from the outside.
+            /*!
+             * A structure holding information about the reachable state space that can be retrieved from the outside.
+             *
+             * The valuations are stored in a compact way: the values of the boolean and integer variables as well as of the
+             * observation labels of each state are packed into a fixed number of bits (integers that are known to lie within
+             * a range are encoded relative to their lower bound, just like in the compressed states of the generators), and
+             * the values of rational variables are stored in a separate column. Values are only decoded when they are
+             * accessed.
+             */
             class StateValuations : public storm::models::sparse::StateAnnotation {
             public:
                 friend class StateValuationsBuilder;
 
-                class StateValuation {
-                public:
-                    friend class StateValuations;
-                    StateValuation() = default;
-                    StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues = {});
-    
-                private:
-                    
-                    std::vector<bool> booleanValues;
-                    std::vector<int64_t> integerValues;
-                    std::vector<storm::RationalNumber> rationalValues;
-                    std::vector<int64_t> observationLabelValues;
-                };
-                
                 class StateValueIterator {
                 public:
                     StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +37,8 @@ namespace storm {
                                        typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                        typename std::map<std::string, uint64_t>::const_iterator labelBegin,
                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
-                                       StateValuation const* valuation);
+                                       StateValuations const* valuations,
+                                       storm::storage::sparse::state_type state);
                     bool operator==(StateValueIterator const& other);
                     bool operator!=(StateValueIterator const& other);
                     StateValueIterator& operator++();
@@ -73,27 +68,31 @@ namespace storm {
                     typename std::map<std::string, uint64_t>::const_iterator labelBegin;
                     typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-                    StateValuation const* const valuation;
+                    StateValuations const* const valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
                 class StateValueIteratorRange {
                 public:
-                    StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation);
+                    StateValueIteratorRange(StateValuations const& valuations, storm::storage::sparse::state_type state);
                     StateValueIterator begin() const;
                     StateValueIterator end() const;
                 private:
-                    std::map<storm::expressions::Variable, uint64_t> const& variableMap;
-                    std::map<std::string, uint64_t> const& labelMap;
-                    StateValuation const* const valuation;
+                    StateValuations const& valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
-                StateValuations() = default;
+                StateValuations();
+                StateValuations(StateValuations const& other) = default;
+                StateValuations(StateValuations&& other) = default;
+                StateValuations& operator=(StateValuations const& other) = default;
+                StateValuations& operator=(StateValuations&& other) = default;
                 virtual ~StateValuations() = default;
                 virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
                 StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
                 
                 bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-                int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+                int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
                 storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const;
                 /// Returns true, if this valuation does not contain any value.
                 bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
@@ -128,20 +127,62 @@ namespace storm {
                  */
                 StateValuations selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const;
 
+                /*
+                 * Derive new state valuations from this in which the valuation of each new state is the one of the old state
+                 * it is mapped to.
+                 */
                 StateValuations blowup(std::vector<uint64_t> const& mapNewToOld) const;
 
                 virtual std::size_t hash() const;
                 
             private:
-                StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-                bool assertValuation(StateValuation const& valuation) const;
-                StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+                // The way an integer is packed into the valuation of a state.
+                struct IntegerEncoding {
+                    uint64_t bitOffset;
+                    uint64_t bitWidth;
+                    int64_t lowerBound;
+                };
+                
+                /*!
+                 * Creates empty state valuations for the given number of states that have the same variables and labels as the
+                 * given ones.
+                 */
+                StateValuations(StateValuations const& layout, uint64_t numberOfStates);
                 
+                /*!
+                 * Copies the valuation of the given state of the given state valuations (that need to have the same layout) to
+                 * the given state of these state valuations.
+                 */
+                void copyValuation(StateValuations const& source, storm::storage::sparse::state_type sourceState, storm::storage::sparse::state_type targetState);
+                
+                uint64_t getValuationOffset(storm::storage::sparse::state_type const& stateIndex) const;
+                bool getBooleanValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const;
+                int64_t getIntegerValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const;
+                storm::RationalNumber const& getRationalValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const;
+                int64_t getLabelValueAtIndex(storm::storage::sparse::state_type const& stateIndex, uint64_t index) const;
+                
+                // A mapping from the variables to their index among the variables of the same type.
                 std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
                 std::map<std::string, uint64_t> observationLabels;
-                // A mapping from state indices to their variable valuations.
-                std::vector<StateValuation> valuations;
                 
+                // The positions of the values of the boolean variables, integer variables and labels within the packed
+                // valuation of a state. Labels always occupy 64 bits.
+                std::vector<uint64_t> booleanBitOffsets;
+                std::vector<IntegerEncoding> integerEncodings;
+                std::vector<uint64_t> labelBitOffsets;
+                uint64_t numberOfRationalVariables;
+                
+                // The number of bits of the packed valuation of a state. The first bit of each valuation indicates whether
+                // the state has a valuation at all.
+                uint64_t bitsPerValuation;
+                
+                uint64_t numberOfStates;
+                
+                // The packed valuations of all states, one after another.
+                storm::storage::BitVector packedValuations;
+                
+                // The values of the rational variables of all states, one after another.
+                std::vector<storm::RationalNumber> rationalValues;
             };
             
             class StateValuationsBuilder {
@@ -152,6 +193,13 @@ namespace storm {
                  * All variables need to be added before adding new states.
                  */
                 void addVariable(storm::expressions::Variable const& variable);
+                
+                /*!
+                 * Adds a new integer variable whose values are known to lie in [lowerBound, lowerBound + 2^bitWidth - 1]
+                 * which allows to store them in the given number of bits.
+                 * All variables need to be added before adding new states.
+                 */
+                void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, uint64_t bitWidth);
 
                 void addObservationLabel(std::string const& label);
 
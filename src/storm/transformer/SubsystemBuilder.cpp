@@ -12,6 +12,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/builder.h"
 
@@ -35,6 +36,10 @@ namespace storm {
                 auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
                 components.exitRates = storm::utility::vector::filterVector(ctmc.getExitRateVector(), subsystem);
                 components.rateTransitions = true;
+            } else if (originalModel.isOfType(storm::models::ModelType::Pomdp)) {
+                auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+                components.observabilityClasses = storm::utility::vector::filterVector(pomdp.getObservations(), subsystem);
+                components.observationValuations = pomdp.getOptionalObservationValuations();
             } else {
                 STORM_LOG_THROW(originalModel.isOfType(storm::models::ModelType::Dtmc) || originalModel.isOfType(storm::models::ModelType::Mdp), storm::exceptions::UnexpectedException, "Unexpected model type.");
             }
@@ -974,6 +974,8 @@ namespace storm {
         template float round(float const& number);
         template float log(float const& number);
         template std::string to_string(float const& value);
+        template float convertNumber(double const& number);
+        template double convertNumber(float const& number);
 
         // int
         template int one();
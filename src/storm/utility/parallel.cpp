@@ -0,0 +1,166 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            ThreadPool::ThreadPool(uint64_t numberOfThreads) : busy(false), currentTask(nullptr), currentNumberOfTasks(0), nextTask(0), batch(0), activeWorkers(0), shutdown(false) {
+                STORM_LOG_ASSERT(numberOfThreads > 0, "Thread pool needs at least one thread.");
+                workers.reserve(numberOfThreads - 1);
+                for (uint64_t i = 1; i < numberOfThreads; ++i) {
+                    workers.emplace_back(&ThreadPool::work, this);
+                }
+            }
+
+            ThreadPool::~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shutdown = true;
+                }
+                workAvailable.notify_all();
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            uint64_t ThreadPool::getNumberOfThreads() const {
+                return workers.size() + 1;
+            }
+
+            void ThreadPool::execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+                bool expected = false;
+                if (workers.empty() || numberOfTasks <= 1 || !busy.compare_exchange_strong(expected, true)) {
+                    for (uint64_t i = 0; i < numberOfTasks; ++i) {
+                        task(i);
+                    }
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    currentTask = &task;
+                    currentNumberOfTasks = numberOfTasks;
+                    nextTask = 0;
+                    activeWorkers = workers.size();
+                    exception = nullptr;
+                    ++batch;
+                }
+                workAvailable.notify_all();
+
+                processTasks();
+
+                std::exception_ptr thrownException;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workDone.wait(lock, [this] { return activeWorkers == 0; });
+                    currentTask = nullptr;
+                    std::swap(thrownException, exception);
+                }
+                busy = false;
+
+                if (thrownException) {
+                    std::rethrow_exception(thrownException);
+                }
+            }
+
+            void ThreadPool::work() {
+                uint64_t lastBatch = 0;
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        workAvailable.wait(lock, [this, lastBatch] { return shutdown || batch != lastBatch; });
+                        if (shutdown) {
+                            return;
+                        }
+                        lastBatch = batch;
+                    }
+
+                    processTasks();
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (--activeWorkers == 0) {
+                        workDone.notify_one();
+                    }
+                }
+            }
+
+            void ThreadPool::processTasks() {
+                for (uint64_t i = nextTask++; i < currentNumberOfTasks; i = nextTask++) {
+                    try {
+                        (*currentTask)(i);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+
+            uint64_t getNumberOfHardwareThreads() {
+                return std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+            }
+
+            void execute(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+                if (numberOfThreads <= 1 || numberOfTasks <= 1) {
+                    for (uint64_t i = 0; i < numberOfTasks; ++i) {
+                        task(i);
+                    }
+                    return;
+                }
+
+                // The pool is shared by all callers. It is only replaced if a different number of threads is requested,
+                // in which case callers that still use the old pool keep it alive.
+                static std::mutex poolMutex;
+                static std::shared_ptr<ThreadPool> pool;
+                std::shared_ptr<ThreadPool> currentPool;
+                {
+                    std::lock_guard<std::mutex> lock(poolMutex);
+                    if (!pool || pool->getNumberOfThreads() != numberOfThreads) {
+                        pool = std::make_shared<ThreadPool>(numberOfThreads);
+                    }
+                    currentPool = pool;
+                }
+                currentPool->execute(numberOfTasks, task);
+            }
+
+            std::vector<uint64_t> getBalancedRanges(std::vector<uint64_t> const& rowIndications, std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfRanges) {
+                uint64_t const numberOfGroups = rowGroupIndices ? rowGroupIndices->size() - 1 : rowIndications.size() - 1;
+                auto weight = [&] (uint64_t group) {
+                    uint64_t row = rowGroupIndices ? (*rowGroupIndices)[group] : group;
+                    return rowIndications[row] + row;
+                };
+
+                std::vector<uint64_t> result;
+                result.reserve(numberOfRanges + 1);
+                result.push_back(0);
+                uint64_t const totalWeight = weight(numberOfGroups);
+                for (uint64_t range = 1; range < numberOfRanges; ++range) {
+                    // Find the first group whose weight reaches the desired share.
+                    uint64_t targetWeight = (totalWeight / numberOfRanges) * range + ((totalWeight % numberOfRanges) * range) / numberOfRanges;
+                    uint64_t low = result.back();
+                    uint64_t high = numberOfGroups;
+                    while (low < high) {
+                        uint64_t mid = low + (high - low) / 2;
+                        if (weight(mid) < targetWeight) {
+                            low = mid + 1;
+                        } else {
+                            high = mid;
+                        }
+                    }
+                    if (low != result.back() && low != numberOfGroups) {
+                        result.push_back(low);
+                    }
+                }
+                result.push_back(numberOfGroups);
+                return result;
+            }
+
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * A fixed-size pool of worker threads that executes batches of independent tasks (fork-join style).
+             * The thread that submits a batch participates in processing it, so a pool with n threads spawns n - 1
+             * workers.
+             */
+            class ThreadPool {
+            public:
+                /*!
+                 * Creates a pool with the given number of threads (including the calling thread).
+                 */
+                explicit ThreadPool(uint64_t numberOfThreads);
+
+                ~ThreadPool();
+
+                ThreadPool(ThreadPool const&) = delete;
+                ThreadPool& operator=(ThreadPool const&) = delete;
+
+                /*!
+                 * Retrieves the number of threads of this pool (including the calling thread).
+                 */
+                uint64_t getNumberOfThreads() const;
+
+                /*!
+                 * Executes task(i) for all i in {0, ..., numberOfTasks - 1} and returns once all tasks are done. If
+                 * the pool is already busy (e.g. because this method is called from within a task or concurrently
+                 * from another thread), the tasks are executed sequentially by the calling thread. If a task throws,
+                 * one of the thrown exceptions is rethrown after all tasks are finished.
+                 */
+                void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task);
+
+            private:
+                void work();
+                void processTasks();
+
+                // The worker threads.
+                std::vector<std::thread> workers;
+
+                // A flag that guards the pool against concurrent and nested batches.
+                std::atomic<bool> busy;
+
+                // Synchronizes the workers with the submitting thread.
+                std::mutex mutex;
+                std::condition_variable workAvailable;
+                std::condition_variable workDone;
+
+                // The current batch.
+                std::function<void(uint64_t)> const* currentTask;
+                uint64_t currentNumberOfTasks;
+                std::atomic<uint64_t> nextTask;
+                uint64_t batch;
+                uint64_t activeWorkers;
+                bool shutdown;
+                std::exception_ptr exception;
+            };
+
+            /*!
+             * Retrieves the number of hardware threads of this machine (at least one).
+             */
+            uint64_t getNumberOfHardwareThreads();
+
+            /*!
+             * Executes task(i) for all i in {0, ..., numberOfTasks - 1} using a process-wide pool with the given
+             * number of threads and returns once all tasks are done.
+             */
+            void execute(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void(uint64_t)> const& task);
+
+            /*!
+             * Splits the row groups of a matrix into consecutive ranges that contain roughly the same number of
+             * entries. Every row additionally counts as one entry, so ranges of empty rows are split as well.
+             *
+             * @param rowIndications The indices at which the rows of the matrix begin (including the end index).
+             * @param rowGroupIndices If given, the row groups of the matrix. Otherwise, each row is a group.
+             * @param numberOfRanges The (maximal) number of ranges.
+             * @return A vector of group indices where range i covers the groups from entry i to entry i + 1 (exclusive).
+             */
+            std::vector<uint64_t> getBalancedRanges(std::vector<uint64_t> const& rowIndications, std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfRanges);
+
+        }
+    }
+}
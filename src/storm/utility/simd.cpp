@@ -0,0 +1,49 @@
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            bool isSupported(InstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::Scalar:
+                        return true;
+#ifdef STORM_HAVE_SIMD_DISPATCH
+                    case InstructionSet::Avx2:
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                    case InstructionSet::Avx512:
+                        return __builtin_cpu_supports("avx512f");
+#endif
+                    default:
+                        return false;
+                }
+            }
+
+            InstructionSet getBestSupportedInstructionSet() {
+                if (isSupported(InstructionSet::Avx512)) {
+                    return InstructionSet::Avx512;
+                } else if (isSupported(InstructionSet::Avx2)) {
+                    return InstructionSet::Avx2;
+                }
+                return InstructionSet::Scalar;
+            }
+
+            std::string toString(InstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::Scalar:
+                        return "scalar";
+                    case InstructionSet::Avx2:
+                        return "avx2";
+                    case InstructionSet::Avx512:
+                        return "avx512";
+                }
+                return "unknown";
+            }
+
+            std::ostream& operator<<(std::ostream& out, InstructionSet const& instructionSet) {
+                return out << toString(instructionSet);
+            }
+
+        }
+    }
+}
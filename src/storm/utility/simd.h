@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+// Runtime dispatch to vectorized kernels is only available for x86 targets when compiling with gcc or clang.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define STORM_HAVE_SIMD_DISPATCH
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            /// The instruction sets for which vectorized kernels are available.
+            enum class InstructionSet {
+                Scalar, Avx2, Avx512
+            };
+
+            /*!
+             * Retrieves whether the processor that is currently executing supports the given instruction set.
+             */
+            bool isSupported(InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves the most capable instruction set that is supported by the processor that is currently executing.
+             */
+            InstructionSet getBestSupportedInstructionSet();
+
+            std::string toString(InstructionSet const& instructionSet);
+            std::ostream& operator<<(std::ostream& out, InstructionSet const& instructionSet);
+
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace test {
+        
+        /*!
+         * Checks that the given sparse models have the same type, transition matrix, state labeling and reward models
+         * and whether both or none of them have a choice labeling.
+         */
+        inline void checkEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+            ASSERT_EQ(expected.getType(), actual.getType());
+            EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+            EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+            ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+            for (auto const& rewardModel : expected.getRewardModels()) {
+                ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+                auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+                ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+                if (rewardModel.second.hasStateRewards()) {
+                    EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+                }
+                ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+                if (rewardModel.second.hasStateActionRewards()) {
+                    EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+                }
+                ASSERT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+                if (rewardModel.second.hasTransitionRewards()) {
+                    EXPECT_TRUE(rewardModel.second.getTransitionRewardMatrix() == actualRewardModel.getTransitionRewardMatrix());
+                }
+            }
+            EXPECT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+        }
+        
+    }
+}
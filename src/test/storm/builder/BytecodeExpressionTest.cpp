@@ -0,0 +1,120 @@
+#include "test/storm_gtest.h"
+
+#include "storm/generator/BytecodeExpression.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+namespace {
+    class BytecodeExpressionTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            manager = std::make_shared<storm::expressions::ExpressionManager>();
+            b = manager->declareBooleanVariable("b");
+            x = manager->declareIntegerVariable("x");
+            y = manager->declareIntegerVariable("y");
+
+            // The variables b in {false, true}, x in [0, 10] and y in [-3, 4] are packed into the states.
+            variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+            variableInformation.integerVariables.emplace_back(x, 0, 10, 1, 4, true);
+            variableInformation.integerVariables.emplace_back(y, -3, 4, 5, 3, true);
+            variableInformation.totalBitOffset = 8;
+
+            for (bool bValue : {false, true}) {
+                for (int64_t xValue = 0; xValue <= 10; ++xValue) {
+                    for (int64_t yValue = -3; yValue <= 4; ++yValue) {
+                        storm::generator::CompressedState state(64);
+                        state.set(0, bValue);
+                        state.setFromInt(1, 4, xValue);
+                        state.setFromInt(5, 3, yValue + 3);
+                        states.push_back(std::move(state));
+                    }
+                }
+            }
+        }
+
+        std::shared_ptr<storm::expressions::ExpressionManager> manager;
+        storm::expressions::Variable b, x, y;
+        storm::generator::VariableInformation variableInformation;
+        std::vector<storm::generator::CompressedState> states;
+    };
+
+    TEST_F(BytecodeExpressionTest, Evaluation) {
+        storm::expressions::Expression bExpr = b.getExpression();
+        storm::expressions::Expression xExpr = x.getExpression();
+        storm::expressions::Expression yExpr = y.getExpression();
+
+        std::vector<storm::expressions::Expression> booleanExpressions = {
+            bExpr && xExpr > 3,
+            !bExpr || yExpr < 0,
+            storm::expressions::implies(bExpr, xExpr == yExpr + 2),
+            storm::expressions::iff(bExpr, xExpr >= 5),
+            storm::expressions::xclusiveor(bExpr, yExpr != manager->integer(1)),
+            storm::expressions::ite(bExpr, xExpr, yExpr) <= 2,
+            xExpr * manager->rational(0.5) > yExpr,
+            storm::expressions::floor(xExpr * manager->rational(0.3)) == manager->integer(1),
+            xExpr / manager->integer(2) == manager->integer(1),
+            manager->boolean(true) && (bExpr || !bExpr)
+        };
+        std::vector<storm::expressions::Expression> integerExpressions = {
+            xExpr + yExpr * manager->integer(3) - 2,
+            storm::expressions::ite(bExpr, xExpr, yExpr + 1),
+            storm::expressions::minimum(xExpr, yExpr),
+            storm::expressions::maximum(xExpr, yExpr),
+            xExpr % manager->integer(3),
+            (xExpr / manager->integer(3)) * manager->integer(3),
+            -yExpr,
+            storm::expressions::abs(yExpr),
+            storm::expressions::ceil(xExpr / manager->integer(3)),
+            storm::expressions::pow(yExpr, manager->integer(2), true),
+            storm::expressions::pow(manager->integer(2), yExpr, true) * manager->integer(8)
+        };
+        std::vector<storm::expressions::Expression> rationalExpressions = {
+            xExpr / manager->integer(4) + manager->rational(0.25),
+            storm::expressions::ite(bExpr, xExpr * manager->rational(0.5), yExpr),
+            storm::expressions::floor(xExpr * manager->rational(0.7)) * manager->rational(1.5),
+            -(yExpr * manager->rational(0.1))
+        };
+
+        // The compiled expressions need to agree with the evaluator that is used by the next-state generators.
+        storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+        storm::generator::BytecodeExpressionCompiler compiler(variableInformation);
+        storm::generator::BytecodeExpression::Registers registers;
+        for (auto const& expression : booleanExpressions) {
+            auto compiled = compiler.compile(expression);
+            ASSERT_TRUE(compiled.is_initialized()) << expression;
+            for (auto const& state : states) {
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                EXPECT_EQ(evaluator.asBool(expression), compiled->evaluateAsBool(state, registers)) << expression;
+            }
+        }
+        for (auto const& expression : integerExpressions) {
+            auto compiled = compiler.compile(expression);
+            ASSERT_TRUE(compiled.is_initialized()) << expression;
+            for (auto const& state : states) {
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                EXPECT_EQ(evaluator.asInt(expression), compiled->evaluateAsInt(state, registers)) << expression;
+            }
+        }
+        for (auto const& expression : rationalExpressions) {
+            auto compiled = compiler.compile(expression);
+            ASSERT_TRUE(compiled.is_initialized()) << expression;
+            for (auto const& state : states) {
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                EXPECT_DOUBLE_EQ(evaluator.asRational(expression), compiled->evaluateAsDouble(state, registers)) << expression;
+            }
+        }
+    }
+
+    TEST_F(BytecodeExpressionTest, Unsupported) {
+        storm::expressions::Variable z = manager->declareIntegerVariable("z");
+        storm::generator::BytecodeExpressionCompiler compiler(variableInformation);
+
+        // Variables that are not stored in the states can not be compiled.
+        EXPECT_FALSE(compiler.compile(x.getExpression() + z.getExpression() > 2).is_initialized());
+        EXPECT_FALSE(compiler.compile(storm::expressions::ite(b.getExpression(), x.getExpression(), z.getExpression())).is_initialized());
+        EXPECT_TRUE(compiler.compile(x.getExpression() > 2).is_initialized());
+    }
+}
@@ -178,6 +178,45 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
 }
 
 
+TEST(ExplicitPrismModelBuilderTest, Parallel) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.numberOfThreads = 4;
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions = parallelOptions;
+    sequentialOptions.numberOfThreads = 1;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildStateValuations();
+
+    // The parallel exploration needs to yield exactly the same model (including the order of the states).
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        ASSERT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+            if (rewardModel.second.hasStateRewards() && parallelRewardModel.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            EXPECT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateActionRewards() && parallelRewardModel.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+        for (uint64_t state = 0; state < sequentialModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(sequentialModel->getStateValuations().toString(state), parallelModel->getStateValuations().toString(state));
+        }
+    }
+}
+
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
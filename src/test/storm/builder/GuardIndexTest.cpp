@@ -0,0 +1,113 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+namespace {
+    class GuardIndexTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            manager = std::make_shared<storm::expressions::ExpressionManager>();
+            b = manager->declareBooleanVariable("b");
+            x = manager->declareIntegerVariable("x");
+            y = manager->declareIntegerVariable("y");
+
+            // The variables b in {false, true}, x in [0, 10] and y in [-3, 4] are packed into the states.
+            variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+            variableInformation.integerVariables.emplace_back(x, 0, 10, 1, 4, true);
+            variableInformation.integerVariables.emplace_back(y, -3, 4, 5, 3, true);
+            variableInformation.totalBitOffset = 8;
+
+            for (bool bValue : {false, true}) {
+                for (int64_t xValue = 0; xValue <= 10; ++xValue) {
+                    for (int64_t yValue = -3; yValue <= 4; ++yValue) {
+                        storm::generator::CompressedState state(64);
+                        state.set(0, bValue);
+                        state.setFromInt(1, 4, xValue);
+                        state.setFromInt(5, 3, yValue + 3);
+                        states.push_back(std::move(state));
+                    }
+                }
+            }
+        }
+
+        // Checks that all guards that hold in some state are candidates in that state.
+        void checkIndex(storm::generator::GuardIndex const& index, std::vector<storm::expressions::Expression> const& guards) {
+            storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+            for (auto const& state : states) {
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                auto const& candidates = index.getCandidates(state);
+                EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+                for (uint64_t guard = 0; guard < guards.size(); ++guard) {
+                    bool isCandidate = std::find(candidates.begin(), candidates.end(), guard) != candidates.end();
+                    EXPECT_EQ(isCandidate, index.isCandidate(state, guard));
+                    if (evaluator.asBool(guards[guard])) {
+                        EXPECT_TRUE(isCandidate) << guards[guard];
+                    }
+                }
+            }
+        }
+
+        std::shared_ptr<storm::expressions::ExpressionManager> manager;
+        storm::expressions::Variable b, x, y;
+        storm::generator::VariableInformation variableInformation;
+        std::vector<storm::generator::CompressedState> states;
+    };
+
+    TEST_F(GuardIndexTest, Indexed) {
+        storm::expressions::Expression bExpr = b.getExpression();
+        storm::expressions::Expression xExpr = x.getExpression();
+        storm::expressions::Expression yExpr = y.getExpression();
+
+        std::vector<storm::expressions::Expression> guards = {
+            xExpr == manager->integer(3) && bExpr,
+            manager->integer(5) == xExpr,
+            bExpr || yExpr > 0,
+            !bExpr && yExpr == manager->integer(-2),
+            xExpr == manager->integer(4) && xExpr == manager->integer(5),
+            xExpr == manager->integer(20),
+            yExpr < 2 && xExpr == manager->integer(10) / manager->integer(4) * manager->integer(2),
+            xExpr == manager->integer(3) && yExpr >= 0
+        };
+
+        storm::generator::GuardIndex index(guards, variableInformation);
+        EXPECT_TRUE(index.isIndexed());
+        EXPECT_EQ(8ull, index.getNumberOfGuards());
+        checkIndex(index, guards);
+
+        // In states with x=3, only the guards that do not require a different value of x are candidates.
+        std::vector<uint64_t> expectedCandidates = {0, 2, 3, 7};
+        for (auto const& state : states) {
+            if (state.getAsInt(1, 4) == 3) {
+                EXPECT_EQ(expectedCandidates, index.getCandidates(state));
+            } else if (state.getAsInt(1, 4) == 5) {
+                EXPECT_EQ(std::vector<uint64_t>({1, 2, 3, 6}), index.getCandidates(state));
+            }
+        }
+    }
+
+    TEST_F(GuardIndexTest, NotIndexed) {
+        storm::expressions::Variable z = manager->declareIntegerVariable("z");
+        storm::expressions::Expression xExpr = x.getExpression();
+
+        // Neither disjunctions, inequalities nor variables that are not stored in the states can be indexed.
+        std::vector<storm::expressions::Expression> guards = {
+            xExpr == manager->integer(3) || xExpr == manager->integer(4),
+            xExpr != manager->integer(2),
+            z.getExpression() == manager->integer(1),
+            xExpr == y.getExpression()
+        };
+
+        storm::generator::GuardIndex index(guards, variableInformation);
+        EXPECT_FALSE(index.isIndexed());
+        for (auto const& state : states) {
+            EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, 3}), index.getCandidates(state));
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/builder/IncrementalModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+namespace {
+    void expectSameModel(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+        ASSERT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+        ASSERT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+        auto const& expectedMatrix = expected.getTransitionMatrix();
+        auto const& actualMatrix = actual.getTransitionMatrix();
+        for (uint64_t row = 0; row < expectedMatrix.getRowCount(); ++row) {
+            auto actualEntry = actualMatrix.begin(row);
+            for (auto const& expectedEntry : expectedMatrix.getRow(row)) {
+                EXPECT_EQ(expectedEntry.getColumn(), actualEntry->getColumn());
+                EXPECT_NEAR(expectedEntry.getValue(), actualEntry->getValue(), 1e-12);
+                ++actualEntry;
+            }
+        }
+        EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+        for (auto const& rewardModel : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actual.getRewardModel(rewardModel.first).getStateActionRewardVector());
+        }
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> buildModel(storm::storage::SymbolicModelDescription const& description, std::string const& constants, storm::builder::BuilderOptions const& options) {
+        storm::storage::SymbolicModelDescription preprocessedDescription = description.preprocess(constants);
+        return storm::builder::ExplicitModelBuilder<double>(preprocessedDescription.asPrismProgram(), options).build();
+    }
+}
+
+TEST(IncrementalModelBuilderTest, ReuseStructure) {
+    storm::storage::SymbolicModelDescription description(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm"));
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::IncrementalModelBuilder<double> builder(description, options);
+    EXPECT_TRUE(builder.isReusingStructure());
+
+    for (std::string const& constants : {"p=0.5", "p=0.3", "p=1/3"}) {
+        auto model = builder.build(description.parseConstantDefinitions(constants));
+        expectSameModel(*buildModel(description, constants, options), *model);
+    }
+
+    // Transitions that have probability zero are removed and so are the states that become unreachable.
+    auto model = builder.build(description.parseConstantDefinitions("p=0"));
+    EXPECT_EQ(4ull, model->getNumberOfStates());
+    EXPECT_EQ(4ull, model->getNumberOfTransitions());
+    EXPECT_EQ(1ull, model->getStates("six").getNumberOfSetBits());
+    EXPECT_TRUE(model->getStates("one").empty());
+    for (auto const& entry : model->getTransitionMatrix()) {
+        EXPECT_EQ(1.0, entry.getValue());
+    }
+}
+
+TEST(IncrementalModelBuilderTest, ChangingStructure) {
+    // The constant K determines the range of a variable, so the model needs to be built anew.
+    storm::storage::SymbolicModelDescription description(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2.nm"));
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::IncrementalModelBuilder<double> builder(description, options);
+    EXPECT_FALSE(builder.isReusingStructure());
+
+    for (std::string const& constants : {"K=1", "K=2"}) {
+        auto model = builder.build(description.parseConstantDefinitions(constants));
+        expectSameModel(*buildModel(description, constants, options), *model);
+    }
+}
+
+TEST(IncrementalModelBuilderTest, ConstantInRewardGuard) {
+    // The constant k determines which choices are rewarded, so the model needs to be built anew.
+    std::string programAsString = R"(dtmc
+const double p;
+const int k;
+module coin
+    s : [0..3] init 0;
+    [] s<3 -> p : (s'=s+1) + (1-p) : (s'=0);
+    [] s=3 -> 1 : (s'=3);
+endmodule
+rewards "steps"
+    [] s<k : 1;
+endrewards
+)";
+    storm::storage::SymbolicModelDescription description(storm::parser::PrismParser::parseFromString(programAsString, "ConstantInRewardGuard"));
+    EXPECT_FALSE(description.preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression>()).asPrismProgram().undefinedConstantsAreGraphPreserving());
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::IncrementalModelBuilder<double> builder(description, options);
+    EXPECT_FALSE(builder.isReusingStructure());
+
+    for (std::string const& constants : {"p=0.5,k=1", "p=0.5,k=3"}) {
+        auto model = builder.build(description.parseConstantDefinitions(constants));
+        expectSameModel(*buildModel(description, constants, options), *model);
+    }
+}
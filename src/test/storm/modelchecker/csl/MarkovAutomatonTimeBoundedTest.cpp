@@ -0,0 +1,97 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/properties.h"
+
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+    typedef storm::models::sparse::MarkovAutomaton<double> ModelType;
+
+    std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildPollingSystem(std::string const& constants, std::string const& formulasAsString) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/polling.ma");
+        program = storm::utility::prism::preprocess(program, constants);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+        return std::make_pair(storm::api::buildSparseModel<double>(program, formulas)->as<ModelType>(), formulas);
+    }
+
+    std::vector<double> check(storm::Environment const& env, ModelType const& model, storm::logic::Formula const& formula) {
+        storm::modelchecker::SparseMarkovAutomatonCslModelChecker<ModelType> checker(model);
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(formula));
+        return result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    }
+
+    storm::Environment createEnvironment(storm::solver::MaBoundedReachabilityMethod method, uint64_t numberOfThreads) {
+        storm::Environment env;
+        env.solver().timeBounded().setMaMethod(method);
+        env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-4));
+        env.solver().multiplier().setNumberOfThreads(numberOfThreads);
+        return env;
+    }
+    
+    std::vector<double> checkParallelMatchesSequential(ModelType const& model, storm::logic::Formula const& formula, storm::solver::MaBoundedReachabilityMethod method) {
+        std::vector<double> sequentialResult = check(createEnvironment(method, 1), model, formula);
+        std::vector<double> parallelResult = check(createEnvironment(method, 4), model, formula);
+        EXPECT_EQ(sequentialResult.size(), parallelResult.size());
+        for (uint64_t state = 0; state < std::min(sequentialResult.size(), parallelResult.size()); ++state) {
+            EXPECT_NEAR(sequentialResult[state], parallelResult[state], 1e-12);
+        }
+        return parallelResult;
+    }
+}
+
+TEST(MarkovAutomatonTimeBoundedTest, ParallelMatchesSequential) {
+    auto modelFormulas = buildPollingSystem("N=2,Q=2", "Pmax=? [F<=1 \"allqueuesfull\"]; Pmin=? [F<=0.5 \"q1full\"]");
+    auto const& model = *modelFormulas.first;
+    for (auto const& formula : modelFormulas.second) {
+        std::vector<std::vector<double>> results;
+        for (auto method : {storm::solver::MaBoundedReachabilityMethod::Imca, storm::solver::MaBoundedReachabilityMethod::UnifPlus}) {
+            results.push_back(checkParallelMatchesSequential(model, *formula, method));
+        }
+        // Both methods approximate the same values.
+        for (auto state : model.getInitialStates()) {
+            EXPECT_NEAR(results[0][state], results[1][state], 1e-3);
+        }
+    }
+}
+
+TEST(MarkovAutomatonTimeBoundedTest, UnifPlusParallelMatchesSequentialForSeveralBlocks) {
+    // Unif+ writes back the values of the maybe states in blocks of 4096 states, which are only processed in parallel
+    // if there are several of them. Imca needs too many steps for a model of this size.
+    auto modelFormulas = buildPollingSystem("N=3,Q=3", "Pmax=? [F<=1 \"allqueuesfull\"]; Pmin=? [F<=0.5 \"q1full\"]");
+    auto const& model = *modelFormulas.first;
+    ASSERT_GT(model.getNumberOfStates(), 2ull * 4096ull);
+    for (auto const& formula : modelFormulas.second) {
+        checkParallelMatchesSequential(model, *formula, storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+    }
+}
+
+// A benchmark of time-bounded reachability queries on Markov automata for both methods and increasing numbers of
+// threads. It is disabled by default and can be run via --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*.
+TEST(MarkovAutomatonTimeBoundedTest, DISABLED_Benchmark) {
+    auto modelFormulas = buildPollingSystem("N=3,Q=3", "Pmax=? [F<=2 \"allqueuesfull\"]; Pmin=? [F<=2 \"q1full\"]");
+    auto const& model = *modelFormulas.first;
+    std::cout << "Polling system with " << model.getNumberOfStates() << " states and " << model.getNumberOfTransitions() << " transitions." << std::endl;
+    for (auto method : {storm::solver::MaBoundedReachabilityMethod::Imca, storm::solver::MaBoundedReachabilityMethod::UnifPlus}) {
+        for (uint64_t numberOfThreads = 1; numberOfThreads <= storm::utility::parallel::getNumberOfHardwareThreads(); numberOfThreads *= 2) {
+            storm::Environment env = createEnvironment(method, numberOfThreads);
+            storm::utility::Stopwatch watch(true);
+            for (auto const& formula : modelFormulas.second) {
+                check(env, model, *formula);
+            }
+            watch.stop();
+            std::cout << storm::solver::toString(method) << " with " << numberOfThreads << " thread(s): " << watch << " for " << modelFormulas.second.size() << " queries." << std::endl;
+        }
+    }
+}
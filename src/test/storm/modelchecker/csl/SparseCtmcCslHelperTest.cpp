@@ -0,0 +1,226 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    // A CTMC with the rates 2 (from state 0 to state 1) and 3 (from state 1 to state 0), uniformized with rate 3.
+    storm::storage::SparseMatrix<double> getUniformizedMatrix() {
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2, 3);
+        builder.addNextValue(0, 0, 1.0 / 3.0);
+        builder.addNextValue(0, 1, 2.0 / 3.0);
+        builder.addNextValue(1, 0, 1.0);
+        return builder.build();
+    }
+    
+    // Many independent copies of the CTMC above such that the vectors are split into several blocks when adding them
+    // to the result (which are 4096 entries long).
+    uint64_t const numberOfCopies = 3 * 4096;
+    
+    storm::storage::SparseMatrix<double> getRateMatrixWithManyCopies() {
+        storm::storage::SparseMatrixBuilder<double> builder(2 * numberOfCopies, 2 * numberOfCopies, 2 * numberOfCopies);
+        for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+            builder.addNextValue(2 * copy, 2 * copy + 1, 2.0);
+            builder.addNextValue(2 * copy + 1, 2 * copy, 3.0);
+        }
+        return builder.build();
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, TransientProbabilities) {
+    storm::storage::SparseMatrix<double> matrix = getUniformizedMatrix();
+    for (uint64_t numberOfThreads : {1, 4}) {
+        storm::Environment env;
+        env.solver().multiplier().setNumberOfThreads(numberOfThreads);
+        // The large time bound lets the values stabilize long before the right truncation point.
+        for (double timeBound : {0.3, 100.0}) {
+            std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, matrix, nullptr, timeBound, 3.0, {0.0, 1.0}, 1e-8);
+            ASSERT_EQ(2ull, result.size());
+            EXPECT_NEAR(0.4 * (1.0 - std::exp(-5.0 * timeBound)), result[0], 1e-7);
+            EXPECT_NEAR(0.4 + 0.6 * std::exp(-5.0 * timeBound), result[1], 1e-7);
+        }
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, TransientProbabilitiesWithManyBlocks) {
+    storm::storage::SparseMatrix<double> rateMatrix = getRateMatrixWithManyCopies();
+    std::vector<double> exitRates(2 * numberOfCopies);
+    storm::storage::BitVector initialStates(2 * numberOfCopies, false);
+    for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+        exitRates[2 * copy] = 2.0;
+        exitRates[2 * copy + 1] = 3.0;
+        initialStates.set(2 * copy);
+    }
+    storm::storage::BitVector phiStates(2 * numberOfCopies, true);
+    storm::storage::BitVector psiStates(2 * numberOfCopies, false);
+    
+    // The uniformized matrix is stochastic, so the values are compared w.r.t. the largest difference.
+    std::vector<double> uniformizedValues(2 * numberOfCopies);
+    storm::storage::SparseMatrixBuilder<double> builder(2 * numberOfCopies, 2 * numberOfCopies, 3 * numberOfCopies);
+    for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+        builder.addNextValue(2 * copy, 2 * copy, 1.0 / 3.0);
+        builder.addNextValue(2 * copy, 2 * copy + 1, 2.0 / 3.0);
+        builder.addNextValue(2 * copy + 1, 2 * copy, 1.0);
+        uniformizedValues[2 * copy + 1] = 1.0;
+    }
+    storm::storage::SparseMatrix<double> uniformizedMatrix = builder.build();
+    
+    for (uint64_t numberOfThreads : {1, 4}) {
+        storm::Environment env;
+        env.solver().multiplier().setNumberOfThreads(numberOfThreads);
+        // The large time bound lets the values stabilize long before the right truncation point.
+        for (double timeBound : {0.3, 100.0}) {
+            std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, uniformizedMatrix, nullptr, timeBound, 3.0, uniformizedValues, 1e-8);
+            ASSERT_EQ(2 * numberOfCopies, result.size());
+            for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+                EXPECT_NEAR(0.4 * (1.0 - std::exp(-5.0 * timeBound)), result[2 * copy], 1e-7);
+                EXPECT_NEAR(0.4 + 0.6 * std::exp(-5.0 * timeBound), result[2 * copy + 1], 1e-7);
+            }
+            
+            // The distribution is propagated with the transposed uniformized matrix whose row sums exceed one, so the
+            // values are compared w.r.t. the sum of the differences. The distribution is spread over all copies.
+            std::vector<double> distribution = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities<double>(env, rateMatrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+            ASSERT_EQ(2 * numberOfCopies, distribution.size());
+            for (uint64_t copy = 0; copy < numberOfCopies; ++copy) {
+                EXPECT_NEAR(0.6 + 0.4 * std::exp(-5.0 * timeBound), distribution[2 * copy] * numberOfCopies, 1e-5);
+                EXPECT_NEAR(0.4 * (1.0 - std::exp(-5.0 * timeBound)), distribution[2 * copy + 1] * numberOfCopies, 1e-5);
+            }
+        }
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, MixedPoissonProbabilities) {
+    storm::storage::SparseMatrix<double> matrix = getUniformizedMatrix();
+    storm::Environment env;
+    for (double timeBound : {0.3, 100.0}) {
+        // The expected time spent in state 1 until the time bound.
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double, true>(env, matrix, nullptr, timeBound, 3.0, {0.0, 1.0}, 1e-8);
+        ASSERT_EQ(2ull, result.size());
+        double transientPart = (1.0 - std::exp(-5.0 * timeBound)) / 5.0;
+        EXPECT_NEAR(0.4 * (timeBound - transientPart), result[0], 1e-6 * timeBound);
+        EXPECT_NEAR(0.4 * timeBound + 0.6 * transientPart, result[1], 1e-6 * timeBound);
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, SeveralTimeBounds) {
+    storm::storage::SparseMatrix<double> matrix = getUniformizedMatrix();
+    storm::Environment env;
+    std::vector<double> timeBounds = {1.0, 0.0, 100.0, 0.3};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, matrix, nullptr, timeBounds, 3.0, {0.0, 1.0}, 1e-8);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        double timeBound = timeBounds[boundIndex];
+        ASSERT_EQ(2ull, results[boundIndex].size());
+        EXPECT_NEAR(0.4 * (1.0 - std::exp(-5.0 * timeBound)), results[boundIndex][0], 1e-7);
+        EXPECT_NEAR(0.4 + 0.6 * std::exp(-5.0 * timeBound), results[boundIndex][1], 1e-7);
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, SeveralTimeBoundsWithExpansiveMatrix) {
+    // Both the row and the column sums exceed one, so the iterations are never stopped early. The eigenvectors are
+    // (1, 1) and (1, -1) with the eigenvalues 1.25 and -0.25, respectively.
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 4);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.75);
+    builder.addNextValue(1, 0, 0.75);
+    builder.addNextValue(1, 1, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    
+    storm::Environment env;
+    std::vector<double> timeBounds = {1.0, 0.3};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, matrix, nullptr, timeBounds, 3.0, {1.0, 0.0}, 1e-8);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        double lambda = 3.0 * timeBounds[boundIndex];
+        ASSERT_EQ(2ull, results[boundIndex].size());
+        EXPECT_NEAR(0.5 * std::exp(0.25 * lambda) + 0.5 * std::exp(-1.25 * lambda), results[boundIndex][0], 1e-6);
+        EXPECT_NEAR(0.5 * std::exp(0.25 * lambda) - 0.5 * std::exp(-1.25 * lambda), results[boundIndex][1], 1e-6);
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, BoundedUntilForSeveralTimeBounds) {
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 2);
+    builder.addNextValue(0, 1, 2.0);
+    builder.addNextValue(1, 0, 3.0);
+    storm::storage::SparseMatrix<double> rateMatrix = builder.build();
+    storm::storage::BitVector phiStates(2, true);
+    storm::storage::BitVector psiStates(2, false);
+    psiStates.set(1);
+
+    storm::Environment env;
+    std::vector<double> timeBounds = {0.5, 0.0, storm::utility::infinity<double>(), 2.0, storm::utility::infinity<double>()};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<double>(env, storm::solver::SolveGoal<double>(), rateMatrix, rateMatrix.transpose(), phiStates, psiStates, {2.0, 3.0}, false, timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    EXPECT_NEAR(1.0 - std::exp(-1.0), results[0][0], 1e-6);
+    EXPECT_NEAR(0.0, results[1][0], 1e-6);
+    EXPECT_NEAR(1.0, results[2][0], 1e-6);
+    EXPECT_NEAR(1.0 - std::exp(-4.0), results[3][0], 1e-6);
+    EXPECT_EQ(results[2], results[4]);
+    for (auto const& result : results) {
+        EXPECT_EQ(1.0, result[1]);
+    }
+    
+    // Time bounds that are not numbers are rejected.
+    for (double invalidBound : {-1.0, std::nan(""), -storm::utility::infinity<double>()}) {
+        STORM_SILENT_EXPECT_THROW(storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<double>(env, storm::solver::SolveGoal<double>(), rateMatrix, rateMatrix.transpose(), phiStates, psiStates, {2.0, 3.0}, false, std::vector<double>({1.0, invalidBound})), storm::exceptions::InvalidArgumentException);
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, KrylovTransientProbabilities) {
+    storm::storage::SparseMatrix<double> matrix = getUniformizedMatrix();
+    storm::Environment env;
+    env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+    std::vector<double> timeBounds = {100.0, 0.0, 0.3};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, matrix, nullptr, timeBounds, 3.0, {0.0, 1.0}, 1e-8);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        double timeBound = timeBounds[boundIndex];
+        ASSERT_EQ(2ull, results[boundIndex].size());
+        EXPECT_NEAR(0.4 * (1.0 - std::exp(-5.0 * timeBound)), results[boundIndex][0], 1e-7);
+        EXPECT_NEAR(0.4 + 0.6 * std::exp(-5.0 * timeBound), results[boundIndex][1], 1e-7);
+    }
+    
+    for (double timeBound : {0.3, 100.0}) {
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double, true>(env, matrix, nullptr, timeBound, 3.0, {0.0, 1.0}, 1e-8);
+        ASSERT_EQ(2ull, result.size());
+        double transientPart = (1.0 - std::exp(-5.0 * timeBound)) / 5.0;
+        EXPECT_NEAR(0.4 * (timeBound - transientPart), result[0], 1e-6 * timeBound);
+        EXPECT_NEAR(0.4 * timeBound + 0.6 * transientPart, result[1], 1e-6 * timeBound);
+    }
+}
+
+TEST(SparseCtmcCslHelperTest, KrylovStiffBoundedUntil) {
+    // Reaching state 2 from state 0 requires passing the fast state 1, which usually returns to state 0.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 3);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 0, 1e4 - 1.0);
+    builder.addNextValue(1, 2, 1.0);
+    storm::storage::SparseMatrix<double> rateMatrix = builder.build();
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3, false);
+    psiStates.set(2);
+    std::vector<double> exitRates = {1.0, 1e4, 0.0};
+    std::vector<double> timeBounds = {10.0, 100.0};
+    
+    storm::Environment env;
+    std::vector<std::vector<double>> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<double>(env, storm::solver::SolveGoal<double>(), rateMatrix, rateMatrix.transpose(), phiStates, psiStates, exitRates, false, timeBounds);
+    env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<double>(env, storm::solver::SolveGoal<double>(), rateMatrix, rateMatrix.transpose(), phiStates, psiStates, exitRates, false, timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        // The fast state is left almost immediately, so the slow process leaves state 0 with rate 1e-4.
+        EXPECT_NEAR(1.0 - std::exp(-1e-4 * timeBounds[boundIndex]), results[boundIndex][0], 1e-5);
+        EXPECT_NEAR(expected[boundIndex][0], results[boundIndex][0], 1e-6);
+        EXPECT_NEAR(expected[boundIndex][1], results[boundIndex][1], 1e-6);
+    }
+}
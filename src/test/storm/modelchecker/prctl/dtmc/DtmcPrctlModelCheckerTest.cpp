@@ -19,6 +19,7 @@
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -329,6 +330,24 @@ namespace {
         }
     };
 
+    class SparseParallelTopologicalNativeJacobiEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // unused for sparse models
+        static const DtmcEngine engine = DtmcEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
     class HybridSylvanGmmxxGmresEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -575,6 +594,7 @@ namespace {
             SparseNativeIntervalIterationEnvironment,
             SparseNativeRationalSearchEnvironment,
             SparseTopologicalEigenLUEnvironment,
+            SparseParallelTopologicalNativeJacobiEnvironment,
             HybridSylvanGmmxxGmresEnvironment,
             HybridCuddNativeJacobiEnvironment,
             HybridCuddNativeSoundValueIterationEnvironment,
@@ -861,4 +881,51 @@ namespace {
 
     }
 
+    TEST(DtmcPrctlModelCheckerTest, ParallelTopologicalManySccs) {
+        // Builds 2000 independent two-state SCCs and 2000 trivial SCCs that depend on them such that the SCCs of one
+        // depth are split into several batches when solved concurrently.
+        uint64_t const numberOfSccs = 2000;
+        uint64_t const goal = 3 * numberOfSccs;
+        uint64_t const sink = goal + 1;
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+            double goalProbability = 0.1 * (scc % 5);
+            builder.addNextValue(2 * scc, 2 * scc + 1, 0.5);
+            builder.addNextValue(2 * scc, goal, goalProbability);
+            builder.addNextValue(2 * scc, sink, 0.5 - goalProbability);
+            builder.addNextValue(2 * scc + 1, 2 * scc, 0.5);
+            builder.addNextValue(2 * scc + 1, goal, 0.25);
+            builder.addNextValue(2 * scc + 1, sink, 0.25);
+        }
+        for (uint64_t state = 0; state < numberOfSccs; ++state) {
+            uint64_t first = 2 * state;
+            uint64_t second = 2 * ((state + 1) % numberOfSccs);
+            builder.addNextValue(2 * numberOfSccs + state, std::min(first, second), 0.5);
+            builder.addNextValue(2 * numberOfSccs + state, std::max(first, second), 0.5);
+        }
+        builder.addNextValue(goal, goal, 1.0);
+        builder.addNextValue(sink, sink, 1.0);
+        storm::models::sparse::StateLabeling labeling(sink + 1);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 2 * numberOfSccs);
+        labeling.addLabel("goal");
+        labeling.addLabelToState("goal", goal);
+        storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling);
+        
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F \"goal\"]"));
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+        std::vector<std::vector<double>> results;
+        for (uint64_t numberOfThreads : {1, 4}) {
+            storm::Environment env = SparseParallelTopologicalNativeJacobiEnvironment::createEnvironment();
+            env.solver().topological().setNumberOfThreads(numberOfThreads);
+            auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+            results.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+        }
+        for (uint64_t state = 0; state < results[0].size(); ++state) {
+            EXPECT_NEAR(results[0][state], results[1][state], 1e-6);
+        }
+        for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+            EXPECT_NEAR((0.125 + 0.1 * (scc % 5)) / 0.75, results[1][2 * scc], 1e-6);
+        }
+    }
 }
@@ -17,6 +17,8 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -336,4 +338,31 @@ namespace {
             EXPECT_NEAR(this->parseNumber("1/10"), quantitativeResult1[14], this->precision());
         }
     }
+    
+    TEST(LraDtmcPrctlModelCheckerTest, LRA_ManyBsccs) {
+        // Many BSCCs with three states each. The first state moves to one of the other states, which return.
+        uint64_t const numberOfBsccs = 3000;
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(3 * numberOfBsccs, 3 * numberOfBsccs, 4 * numberOfBsccs);
+        std::vector<double> stateRewards;
+        for (uint64_t bscc = 0; bscc < numberOfBsccs; ++bscc) {
+            matrixBuilder.addNextValue(3 * bscc, 3 * bscc + 1, 0.5);
+            matrixBuilder.addNextValue(3 * bscc, 3 * bscc + 2, 0.5);
+            matrixBuilder.addNextValue(3 * bscc + 1, 3 * bscc, 1.0);
+            matrixBuilder.addNextValue(3 * bscc + 2, 3 * bscc, 1.0);
+            stateRewards.push_back(bscc % 4);
+            stateRewards.push_back(1.0);
+            stateRewards.push_back(0.0);
+        }
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        
+        for (uint64_t numberOfThreads : {1, 4}) {
+            storm::Environment env;
+            env.solver().multiplier().setNumberOfThreads(numberOfThreads);
+            storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<double> helper(matrix);
+            std::vector<double> result = helper.computeLongRunAverageValues(env, &stateRewards);
+            for (uint64_t state = 0; state < result.size(); ++state) {
+                EXPECT_NEAR((state / 3 % 4) / 2.0 + 0.25, result[state], 1e-6);
+            }
+        }
+    }
 }
\ No newline at end of file
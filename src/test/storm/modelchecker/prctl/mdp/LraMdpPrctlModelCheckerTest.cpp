@@ -23,6 +23,8 @@
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 
 namespace {
     
@@ -478,4 +480,42 @@ namespace {
     
 
     
+    TEST(LraMdpPrctlModelCheckerTest, LRA_ManyMecs) {
+        // Many MECs with two states each. The first state can either stay or move to the second state, which returns.
+        uint64_t const numberOfMecs = 3000;
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(3 * numberOfMecs, 2 * numberOfMecs, 3 * numberOfMecs, true, true, 2 * numberOfMecs);
+        std::vector<double> stateRewards;
+        uint64_t row = 0;
+        for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+            matrixBuilder.newRowGroup(row);
+            matrixBuilder.addNextValue(row++, 2 * mec, 1.0);
+            matrixBuilder.addNextValue(row++, 2 * mec + 1, 1.0);
+            matrixBuilder.newRowGroup(row);
+            matrixBuilder.addNextValue(row++, 2 * mec, 1.0);
+            stateRewards.push_back(mec % 5);
+            stateRewards.push_back(2.0 * (mec % 3));
+        }
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        
+        std::vector<std::vector<double>> results;
+        std::vector<std::vector<uint64_t>> choices;
+        for (uint64_t numberOfThreads : {1, 4}) {
+            storm::Environment env;
+            env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+            env.solver().multiplier().setNumberOfThreads(numberOfThreads);
+            storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<double> helper(matrix);
+            helper.setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
+            helper.setProduceScheduler(true);
+            results.push_back(helper.computeLongRunAverageValues(env, &stateRewards));
+            choices.push_back(helper.getProducedOptimalChoices());
+        }
+        for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+            double expected = std::max<double>(stateRewards[2 * mec], (stateRewards[2 * mec] + stateRewards[2 * mec + 1]) / 2.0);
+            for (auto const& result : results) {
+                EXPECT_NEAR(expected, result[2 * mec], 1e-4);
+                EXPECT_NEAR(expected, result[2 * mec + 1], 1e-4);
+            }
+        }
+        EXPECT_EQ(choices[0], choices[1]);
+    }
 }
\ No newline at end of file
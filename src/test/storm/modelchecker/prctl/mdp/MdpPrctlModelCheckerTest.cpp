@@ -15,6 +15,7 @@
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -196,6 +197,24 @@ namespace {
         }
     };
     
+    class SparseDoubleParallelTopologicalValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const MdpEngine engine = MdpEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            return env;
+        }
+    };
+    
     class SparseDoubleTopologicalSoundValueIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
@@ -509,6 +528,7 @@ namespace {
             SparseDoubleSoundValueIterationEnvironment,
             SparseDoubleOptimisticValueIterationEnvironment,
             SparseDoubleTopologicalValueIterationEnvironment,
+            SparseDoubleParallelTopologicalValueIterationEnvironment,
             SparseDoubleTopologicalSoundValueIterationEnvironment,
             SparseRationalPolicyIterationEnvironment,
             SparseRationalViToPiEnvironment,
@@ -572,6 +592,72 @@ namespace {
         EXPECT_NEAR(this->parseNumber("22/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
     }
     
+    TYPED_TEST(MdpPrctlModelCheckerTest, DiceRepeatedQueries) {
+        // Checks the same and different properties alternately on one model checker such that data of previous queries can be reused.
+        std::string formulasString = "Pmin=? [F \"three\"]";
+                 formulasString += "; Pmax=? [F \"three\"]";
+                 formulasString += "; Pmin=? [F \"four\"]";
+                 formulasString += "; Rmin=? [F \"done\"]";
+                 formulasString += "; Rmax=? [F \"done\"]";
+        
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        
+        for (uint64_t round = 0; round < 2; ++round) {
+            result = checker->check(this->env(), tasks[0]);
+            EXPECT_NEAR(this->parseNumber("2/36"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[0]);
+            EXPECT_NEAR(this->parseNumber("2/36"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[1]);
+            EXPECT_NEAR(this->parseNumber("2/36"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[2]);
+            EXPECT_NEAR(this->parseNumber("3/36"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[3]);
+            EXPECT_NEAR(this->parseNumber("22/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[4]);
+            EXPECT_NEAR(this->parseNumber("22/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            
+            result = checker->check(this->env(), tasks[3]);
+            EXPECT_NEAR(this->parseNumber("22/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        }
+        
+        // Minimal until probabilities are always solved in the workspace of sparse model checkers, whose solver is
+        // reused if (and only if) the solver settings did not change.
+        if (TypeParam::engine == MdpEngine::PrismSparse || TypeParam::engine == MdpEngine::JaniSparse || TypeParam::engine == MdpEngine::JitSparse) {
+            auto const& workspace = std::dynamic_pointer_cast<storm::modelchecker::SparseMdpPrctlModelChecker<typename TestFixture::SparseModelType>>(checker)->getSolverWorkspace();
+            result = checker->check(this->env(), tasks[0]);
+            storm::Environment sameSettings = this->env();
+            EXPECT_TRUE(workspace.hasSolverFor(sameSettings));
+            
+            storm::Environment otherSettings = this->env();
+            otherSettings.solver().minMax().setPrecision(otherSettings.solver().minMax().getPrecision() / storm::utility::convertNumber<storm::RationalNumber>(2));
+            EXPECT_FALSE(workspace.hasSolverFor(otherSettings));
+            result = checker->check(otherSettings, tasks[0]);
+            EXPECT_NEAR(this->parseNumber("2/36"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+            EXPECT_TRUE(workspace.hasSolverFor(otherSettings));
+            EXPECT_FALSE(workspace.hasSolverFor(sameSettings));
+            
+            // The multiplier and the mixed precision mode are part of the settings as well.
+            storm::Environment otherMultiplier = otherSettings;
+            otherMultiplier.solver().multiplier().setType(otherSettings.solver().multiplier().getType() == storm::solver::MultiplierType::Native ? storm::solver::MultiplierType::Gmmxx : storm::solver::MultiplierType::Native);
+            EXPECT_FALSE(workspace.hasSolverFor(otherMultiplier));
+            storm::Environment otherThreads = otherSettings;
+            otherThreads.solver().multiplier().setNumberOfThreads(otherSettings.solver().multiplier().getNumberOfThreads() + 1);
+            EXPECT_FALSE(workspace.hasSolverFor(otherThreads));
+            storm::Environment otherMixedPrecision = otherSettings;
+            otherMixedPrecision.solver().minMax().setMixedPrecision(!otherSettings.solver().minMax().isMixedPrecisionSet());
+            EXPECT_FALSE(workspace.hasSolverFor(otherMixedPrecision));
+        }
+    }
+    
     TYPED_TEST(MdpPrctlModelCheckerTest, AsynchronousLeader) {
         std::string formulasString = "Pmin=? [F \"elected\"]";
                  formulasString += "; Pmax=? [F \"elected\"]";
@@ -815,5 +901,59 @@ namespace {
 
     }
 
-
+    TEST(MdpPrctlModelCheckerTest, ParallelTopologicalManySccs) {
+        // Builds 2000 independent two-state SCCs and 2000 trivial SCCs that depend on them such that the SCCs of one
+        // depth are split into several batches when solved concurrently.
+        uint64_t const numberOfSccs = 2000;
+        uint64_t const goal = 3 * numberOfSccs;
+        uint64_t const sink = goal + 1;
+        storm::storage::SparseMatrixBuilder<double> builder(0, sink + 1, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+            double goalProbability = 0.1 * (scc % 5);
+            builder.newRowGroup(row);
+            builder.addNextValue(row, 2 * scc + 1, 0.5);
+            builder.addNextValue(row, goal, goalProbability);
+            builder.addNextValue(row++, sink, 0.5 - goalProbability);
+            builder.addNextValue(row, goal, 0.3);
+            builder.addNextValue(row++, sink, 0.7);
+            builder.newRowGroup(row);
+            builder.addNextValue(row, 2 * scc, 0.5);
+            builder.addNextValue(row, goal, 0.25);
+            builder.addNextValue(row++, sink, 0.25);
+        }
+        for (uint64_t state = 0; state < numberOfSccs; ++state) {
+            uint64_t first = 2 * state;
+            uint64_t second = 2 * ((state + 1) % numberOfSccs);
+            builder.newRowGroup(row);
+            builder.addNextValue(row, std::min(first, second), 0.5);
+            builder.addNextValue(row++, std::max(first, second), 0.5);
+            builder.addNextValue(row++, 2 * state + 1, 1.0);
+        }
+        builder.newRowGroup(row);
+        builder.addNextValue(row++, goal, 1.0);
+        builder.newRowGroup(row);
+        builder.addNextValue(row++, sink, 1.0);
+        storm::models::sparse::StateLabeling labeling(sink + 1);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 2 * numberOfSccs);
+        labeling.addLabel("goal");
+        labeling.addLabelToState("goal", goal);
+        storm::models::sparse::Mdp<double> mdp(builder.build(), labeling);
+        
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F \"goal\"]; Pmax=? [F \"goal\"]"));
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp);
+        for (auto const& formula : formulas) {
+            std::vector<std::vector<double>> results;
+            for (uint64_t numberOfThreads : {1, 4}) {
+                storm::Environment env = SparseDoubleParallelTopologicalValueIterationEnvironment::createEnvironment();
+                env.solver().topological().setNumberOfThreads(numberOfThreads);
+                auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+                results.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+            }
+            for (uint64_t state = 0; state < results[0].size(); ++state) {
+                EXPECT_NEAR(results[0][state], results[1][state], 1e-6);
+            }
+        }
+    }
 }
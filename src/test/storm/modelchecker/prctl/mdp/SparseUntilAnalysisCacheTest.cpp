@@ -0,0 +1,154 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseModelCheckerCache.h"
+#include "storm/modelchecker/prctl/helper/SparseUntilAnalysisCache.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+
+namespace {
+
+    TEST(SparseUntilAnalysisCacheTest, Eviction) {
+        storm::storage::BitVector phiStates(64, true);
+        storm::storage::BitVector psiStates1(64), psiStates2(64), psiStates3(64), prob0(64), prob1(64);
+        psiStates1.set(1);
+        psiStates2.set(2);
+        psiStates3.set(3);
+        prob0.set(4);
+        prob0.set(5);
+        prob1.set(1);
+        prob1.set(2);
+        prob1.set(3);
+
+        // Each entry consists of five bit vectors with 64 bits, so two entries fit into the cache.
+        storm::modelchecker::helper::SparseUntilAnalysisCache<double> cache(100);
+        auto entry1 = cache.insert(phiStates, psiStates1, storm::solver::OptimizationDirection::Minimize, prob0, prob1);
+        cache.insert(phiStates, psiStates2, storm::solver::OptimizationDirection::Minimize, prob0, prob1);
+        EXPECT_EQ(2ull, cache.getNumberOfEntries());
+        EXPECT_EQ(~(prob0 | prob1), entry1->maybeStates);
+
+        // The direction is part of the key.
+        EXPECT_EQ(entry1, cache.find(phiStates, psiStates1, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_EQ(nullptr, cache.find(phiStates, psiStates1, storm::solver::OptimizationDirection::Maximize));
+        EXPECT_EQ(nullptr, cache.find(phiStates, psiStates1, boost::none));
+
+        // As the first entry was used more recently, the second one is evicted.
+        cache.insert(phiStates, psiStates3, storm::solver::OptimizationDirection::Minimize, prob0, prob1);
+        EXPECT_EQ(2ull, cache.getNumberOfEntries());
+        EXPECT_NE(nullptr, cache.find(phiStates, psiStates1, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_EQ(nullptr, cache.find(phiStates, psiStates2, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_NE(nullptr, cache.find(phiStates, psiStates3, storm::solver::OptimizationDirection::Minimize));
+
+        // Entries that grow are accounted for.
+        entry1->rightHandSide = std::vector<double>(64, 0.5);
+        cache.update(entry1);
+        EXPECT_EQ(1ull, cache.getNumberOfEntries());
+        EXPECT_EQ(nullptr, cache.find(phiStates, psiStates1, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_TRUE(entry1->rightHandSide.is_initialized());
+
+        cache.setMaximalSize(0);
+        EXPECT_EQ(0ull, cache.getNumberOfEntries());
+        EXPECT_EQ(0ull, cache.getSize());
+    }
+
+    TEST(SparseUntilAnalysisCacheTest, Dice) {
+        std::string formulasString = "Pmin=? [F \"two\"]";
+                 formulasString += "; Pmax=? [F \"two\"]";
+                 formulasString += "; Pmin=? [F \"three\"]";
+                 formulasString += "; Pmax=? [ !\"three\" U \"two\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+        std::vector<double> expected = {1.0 / 36.0, 1.0 / 36.0, 2.0 / 36.0, 1.0 / 36.0};
+
+        // Use the sound interval iteration, which requires eliminating end components for maximal probabilities.
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        storm::Environment envWithoutCache = env;
+        env.modelchecker().setAnalysisCacheSize(256);
+        envWithoutCache.modelchecker().setAnalysisCacheSize(0);
+
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*model);
+        for (uint64_t round = 0; round < 2; ++round) {
+            for (uint64_t i = 0; i < formulas.size(); ++i) {
+                storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[i]);
+                auto result = checker.check(env, task);
+                auto resultWithoutCache = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>(*model).check(envWithoutCache, task);
+                uint64_t initialState = *model->getInitialStates().begin();
+                EXPECT_NEAR(expected[i], result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+                EXPECT_NEAR(resultWithoutCache->asExplicitQuantitativeCheckResult<double>()[initialState], result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+            }
+        }
+    }
+
+    TEST(SparseUntilAnalysisCacheTest, Api) {
+        // Both properties have the same phi and psi states.
+        std::string formulasString = "Pmin=? [F \"two\"]";
+                 formulasString += "; Pmin=? [true U \"two\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas);
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        storm::Environment env;
+        env.modelchecker().setAnalysisCacheSize(256);
+        auto cache = std::make_shared<storm::modelchecker::helper::SparseModelCheckerCache<double>>();
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[0]), cache);
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        EXPECT_EQ(1ull, cache->getUntilAnalysisCache().getNumberOfEntries());
+        EXPECT_EQ(0ull, cache->getUntilAnalysisCache().getNumberOfHits());
+
+        // The second property is checked by another model checker, which finds the results of the first one.
+        result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[1]), cache);
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        EXPECT_EQ(1ull, cache->getUntilAnalysisCache().getNumberOfEntries());
+        EXPECT_EQ(1ull, cache->getUntilAnalysisCache().getNumberOfHits());
+
+        // Without the cache, nothing is shared.
+        result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[1]));
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        EXPECT_EQ(1ull, cache->getUntilAnalysisCache().getNumberOfHits());
+    }
+
+    TEST(SparseUntilAnalysisCacheTest, ApiSolverWorkspace) {
+        // Minimal until probabilities are solved in the workspace, which is reused if the maybe states coincide.
+        std::string formulasString = "Pmin=? [F \"two\"]";
+                 formulasString += "; Pmin=? [F \"two\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas);
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        // The until analysis cache is disabled, so only the workspace carries over.
+        storm::Environment env;
+        env.modelchecker().setAnalysisCacheSize(0);
+        auto cache = std::make_shared<storm::modelchecker::helper::SparseModelCheckerCache<double>>();
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[0]), cache);
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        auto const& workspace = cache->getSolverWorkspace();
+        EXPECT_TRUE(workspace.hasSolverFor(env));
+        auto const* submatrix = &workspace.getSubmatrix();
+
+        result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[1]), cache);
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        EXPECT_EQ(&cache->getSolverWorkspace(), &workspace);
+        EXPECT_EQ(submatrix, &workspace.getSubmatrix());
+        EXPECT_TRUE(workspace.hasSolverFor(env));
+    }
+}
@@ -0,0 +1,115 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "test/storm/ModelComparison.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+
+#include <boost/filesystem.hpp>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%.bin")).string();
+        storm::exporter::binaryExportSparseModel(filename, model);
+        auto result = storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+        boost::filesystem::remove(filename);
+        return result;
+    }
+    
+    // The offset of the row indications of the transition matrix in a file of a DTMC: the magic string, the byte order
+    // mark, the version, the (padded) model type and the dimensions of the matrix.
+    uint64_t const dtmcRowIndicationsOffset = 8 + 8 + 8 + (8 + 8) + 3 * 8;
+    
+    /*!
+     * Exports the model, applies the given modification to the bytes of the file and parses the modified file.
+     */
+    void exportModifyAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::function<void(std::string&)> const& modify) {
+        std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%.bin")).string();
+        storm::exporter::binaryExportSparseModel(filename, model);
+        std::string content;
+        {
+            std::ifstream stream(filename, std::ios::in | std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        }
+        modify(content);
+        {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+            stream.write(content.data(), content.size());
+        }
+        try {
+            storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+        } catch (...) {
+            boost::filesystem::remove(filename);
+            throw;
+        }
+        boost::filesystem::remove(filename);
+    }
+    
+    void setNumber(std::string& content, uint64_t offset, uint64_t value) {
+        std::memcpy(&content[offset], &value, sizeof(value));
+    }
+}
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto parsedModel = exportAndParse(model);
+    storm::test::checkEqualModels(*model, *parsedModel);
+    EXPECT_EQ(8607ul, parsedModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, parsedModel->getNumberOfTransitions());
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto parsedModel = exportAndParse(model);
+    storm::test::checkEqualModels(*model, *parsedModel);
+    EXPECT_EQ(254ul, parsedModel->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto parsedModel = exportAndParse(model);
+    storm::test::checkEqualModels(*model, *parsedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), parsedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryEncodingParserTest, MaRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto parsedModel = exportAndParse(model);
+    storm::test::checkEqualModels(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    // A file in the explicit format is rejected.
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn"), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryEncodingParserTest, CorruptFiles) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    uint64_t rowCount = model->getTransitionMatrix().getRowCount();
+    
+    // Truncated file
+    STORM_SILENT_EXPECT_THROW(exportModifyAndParse(model, [] (std::string& content) { content.resize(content.size() / 2); }), storm::exceptions::WrongFormatException);
+    // File written with the other byte order
+    STORM_SILENT_EXPECT_THROW(exportModifyAndParse(model, [] (std::string& content) { std::reverse(content.begin() + 8, content.begin() + 16); }), storm::exceptions::WrongFormatException);
+    // Decreasing row indications
+    STORM_SILENT_EXPECT_THROW(exportModifyAndParse(model, [] (std::string& content) { setNumber(content, dtmcRowIndicationsOffset + 8, 1ull << 40); }), storm::exceptions::WrongFormatException);
+    // Column out of range
+    STORM_SILENT_EXPECT_THROW(exportModifyAndParse(model, [rowCount] (std::string& content) { setNumber(content, dtmcRowIndicationsOffset + (rowCount + 1) * 8, rowCount); }), storm::exceptions::WrongFormatException);
+    // The unmodified file can be parsed.
+    EXPECT_NO_THROW(exportModifyAndParse(model, [] (std::string&) {}));
+}
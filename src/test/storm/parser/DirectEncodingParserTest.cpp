@@ -1,7 +1,11 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+#include "test/storm/ModelComparison.h"
+
+#include <boost/filesystem.hpp>
 
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/api/export.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -84,3 +88,38 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
 
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    storm::parser::DirectEncodingParserOptions parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::parser::DirectEncodingParserOptions sequentialOptions = parallelOptions;
+    sequentialOptions.numberOfThreads = 1;
+
+    // Parsing the states in chunks needs to yield the same model.
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn"}) {
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::parser::DirectEncodingParser<double>::parseModel(file, sequentialOptions);
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(file, parallelOptions);
+        storm::test::checkEqualModels(*sequentialModel, *parallelModel);
+    }
+}
+
+#ifdef STORM_HAVE_ZLIB
+TEST(DirectEncodingParserTest, CompressedRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%.drn.gz")).string();
+    storm::api::exportSparseModelAsDrn(model, filename, {}, true, 4);
+
+    // The compressed file is detected and decompressed while parsing.
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModel = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    storm::parser::DirectEncodingParserOptions parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    std::shared_ptr<storm::models::sparse::Model<double>> parallelParsedModel = storm::parser::DirectEncodingParser<double>::parseModel(filename, parallelOptions);
+    boost::filesystem::remove(filename);
+    storm::test::checkEqualModels(*parsedModel, *parallelParsedModel);
+    ASSERT_EQ(model->getType(), parsedModel->getType());
+    EXPECT_TRUE(model->getTransitionMatrix() == parsedModel->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == parsedModel->getStateLabeling());
+    ASSERT_TRUE(parsedModel->hasRewardModel("coinflips"));
+    EXPECT_EQ(model->getRewardModel("coinflips").getStateActionRewardVector(), parsedModel->getRewardModel("coinflips").getStateActionRewardVector());
+}
+#endif
@@ -24,6 +24,20 @@ namespace {
         }
     };
     
+    class NativeDoubleMixedPrecisionPowerEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            env.solver().native().setMixedPrecision(true);
+            return env;
+        }
+    };
+    
     class NativeDoubleSoundValueIterationEnvironment {
     public:
         typedef double ValueType;
@@ -69,6 +83,22 @@ namespace {
         }
     };
     
+    class NativeDoubleMixedPrecisionIntervalIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::IntervalIteration);
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            env.solver().native().setMixedPrecision(true);
+            return env;
+        }
+    };
+    
     class NativeDoubleJacobiEnvironment {
     public:
         typedef double ValueType;
@@ -308,9 +338,11 @@ namespace {
   
     typedef ::testing::Types<
             NativeDoublePowerEnvironment,
+            NativeDoubleMixedPrecisionPowerEnvironment,
             NativeDoubleSoundValueIterationEnvironment,
             NativeDoubleOptimisticValueIterationEnvironment,
             NativeDoubleIntervalIterationEnvironment,
+            NativeDoubleMixedPrecisionIntervalIterationEnvironment,
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
@@ -369,4 +401,45 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
+
+    TYPED_TEST(LinearEquationSolverTest, solveEquationSystemWithMultipleRightHandSides) {
+        typedef typename TestFixture::ValueType ValueType;
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        // The right-hand sides are multiples of each other, so the solutions are multiples of each other as well.
+        std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+        std::vector<ValueType> factors = {this->parseNumber("1"), this->parseNumber("1/2"), this->parseNumber("-1")};
+        std::vector<std::vector<ValueType>> x(factors.size(), std::vector<ValueType>(3));
+        std::vector<std::vector<ValueType>> bs;
+        for (auto const& factor : factors) {
+            bs.push_back(b);
+            storm::utility::vector::scaleVectorInPlace(bs.back(), factor);
+        }
+        
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            A.convertToEquationSystem();
+        }
+        
+        auto solver = factory.create(this->env(), A);
+        solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x, bs));
+        for (uint64_t index = 0; index < factors.size(); ++index) {
+            EXPECT_NEAR(x[index][0], factors[index] * this->parseNumber("481/9"), this->precision());
+            EXPECT_NEAR(x[index][1], factors[index] * this->parseNumber("457/9"), this->precision());
+            EXPECT_NEAR(x[index][2], factors[index] * this->parseNumber("875/18"), this->precision());
+        }
+    }
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/ParallelSccSchedule.h"
 
 namespace {
     
@@ -50,6 +52,33 @@ namespace {
         }
     };
 
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setMixedPrecision(true);
+            return env;
+        }
+    };
+    
+    class DoubleMixedPrecisionIntervalIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            env.solver().minMax().setMixedPrecision(true);
+            return env;
+        }
+    };
+
     class DoubleOptimisticViEnvironment {
     public:
         typedef double ValueType;
@@ -76,6 +105,20 @@ namespace {
         }
     };
     
+    class DoubleParallelTopologicalViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
     class DoubleTopologicalCudaViEnvironment {
     public:
         typedef double ValueType;
@@ -138,8 +181,11 @@ namespace {
             DoubleViEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
+            DoubleMixedPrecisionViEnvironment,
+            DoubleMixedPrecisionIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
+            DoubleParallelTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
             RationalPIEnvironment,
@@ -175,6 +221,92 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    TEST(MinMaxLinearEquationSolverTest, MixedPrecisionRespectsIterationLimit) {
+        // The solution of x = 0.999x + 0.001 is 1, but ten iterations starting from zero only reach 1 - 0.999^10 < 0.01.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.999);
+        storm::storage::SparseMatrix<double> A = builder.build();
+        std::vector<double> b = {0.001};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+        storm::Environment viEnv = DoubleMixedPrecisionViEnvironment::createEnvironment();
+        viEnv.solver().minMax().setMaximalNumberOfIterations(10);
+        auto solver = factory.create(viEnv, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        std::vector<double> x(1);
+        ASSERT_NO_THROW(solver->solveEquations(viEnv, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_LT(x[0], 0.01);
+        
+        // Interval iteration returns the mean of both bounds, where the upper bound 1 is already the solution.
+        storm::Environment iiEnv = DoubleMixedPrecisionIntervalIterationEnvironment::createEnvironment();
+        iiEnv.solver().minMax().setMaximalNumberOfIterations(10);
+        solver = factory.create(iiEnv, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        x.assign(1, 0.0);
+        ASSERT_NO_THROW(solver->solveEquations(iiEnv, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_LT(x[0], 0.51);
+    }
+    
+    TEST(MinMaxLinearEquationSolverTest, ParallelTopologicalManySccs) {
+        // Builds 2000 independent two-state SCCs and 2000 trivial SCCs that depend on them such that both levels of
+        // the SCC schedule consist of several batches.
+        uint64_t const numberOfSccs = 2000;
+        storm::storage::SparseMatrixBuilder<double> builder(0, 3 * numberOfSccs, 0, false, true);
+        std::vector<double> b;
+        uint64_t row = 0;
+        for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+            builder.newRowGroup(row);
+            builder.addNextValue(row++, 2 * scc + 1, 0.5);
+            b.push_back(0.1 * (scc % 5));
+            builder.addNextValue(row, 2 * scc, 0.2);
+            builder.addNextValue(row++, 2 * scc + 1, 0.3);
+            b.push_back(0.25);
+            builder.newRowGroup(row);
+            builder.addNextValue(row++, 2 * scc, 0.5);
+            b.push_back(0.25);
+        }
+        for (uint64_t state = 0; state < numberOfSccs; ++state) {
+            builder.newRowGroup(row);
+            uint64_t first = 2 * state;
+            uint64_t second = 2 * ((state + 1) % numberOfSccs);
+            builder.addNextValue(row, std::min(first, second), 0.5);
+            builder.addNextValue(row++, std::max(first, second), 0.5);
+            b.push_back(0.0);
+            builder.addNextValue(row++, 2 * state + 1, 0.9);
+            b.push_back(0.05);
+        }
+        storm::storage::SparseMatrix<double> A = builder.build();
+        
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths());
+        storm::solver::helper::ParallelSccSchedule schedule(decomposition, 1024);
+        ASSERT_EQ(2ul, schedule.getNumberOfLevels());
+        EXPECT_LT(1ul, schedule.getNumberOfBatches(0));
+        EXPECT_LT(1ul, schedule.getNumberOfBatches(1));
+        
+        storm::Environment sequentialEnv = DoubleTopologicalViEnvironment::createEnvironment();
+        storm::Environment parallelEnv = DoubleParallelTopologicalViEnvironment::createEnvironment();
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<std::vector<double>> results;
+            for (auto const& env : {sequentialEnv, parallelEnv}) {
+                auto solver = factory.create(env, A);
+                solver->setHasUniqueSolution(true);
+                solver->setHasNoEndComponents(true);
+                solver->setBounds(0.0, 1.0);
+                std::vector<double> x(A.getRowGroupCount());
+                ASSERT_NO_THROW(solver->solveEquations(env, dir, x, b));
+                results.push_back(std::move(x));
+            }
+            for (uint64_t state = 0; state < results[0].size(); ++state) {
+                EXPECT_NEAR(results[0][state], results[1][state], 1e-6);
+            }
+        }
+    }
 }
 
 
@@ -20,6 +20,42 @@ namespace {
         }
     };
     
+    class NativeSoaEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setStructureOfArrays(true);
+            return env;
+        }
+    };
+    
+    class NativeParallelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setNumberOfThreads(4);
+            return env;
+        }
+    };
+    
+    class NativeSimdEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setInstructionSet(storm::utility::simd::getBestSupportedInstructionSet());
+            return env;
+        }
+    };
+    
     class GmmxxEnvironment {
     public:
         typedef double ValueType;
@@ -45,6 +81,9 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
+            NativeSoaEnvironment,
+            NativeParallelEnvironment,
+            NativeSimdEnvironment,
             GmmxxEnvironment
     > TestingTypes;
     
@@ -120,4 +159,95 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
+    TEST(MultiplierTest, changingEnvironmentTest) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t row = 0; row < 100; ++row) {
+            builder.addNextValue(row, row, 0.25);
+            builder.addNextValue(row, (row * 7 + 3) % 100, 0.5);
+            builder.addNextValue(row, 99 - row / 2, 0.25);
+        }
+        storm::storage::SparseMatrix<double> A = builder.build();
+        std::vector<double> x(100);
+        for (uint64_t i = 0; i < x.size(); ++i) {
+            x[i] = static_cast<double>(i % 10);
+        }
+        
+        storm::Environment scalarEnv = NativeEnvironment::createEnvironment();
+        std::vector<double> expected(100);
+        storm::solver::MultiplierFactory<double>().create(scalarEnv, A)->multiply(scalarEnv, x, nullptr, expected);
+        
+        // A single multiplier is used with environments that request different layouts and instruction sets.
+        auto multiplier = storm::solver::MultiplierFactory<double>().create(scalarEnv, A);
+        for (auto const& env : {NativeSimdEnvironment::createEnvironment(), NativeEnvironment::createEnvironment(), NativeSoaEnvironment::createEnvironment(), NativeSimdEnvironment::createEnvironment()}) {
+            std::vector<double> result(100);
+            multiplier->multiply(env, x, nullptr, result);
+            for (uint64_t i = 0; i < result.size(); ++i) {
+                EXPECT_NEAR(expected[i], result[i], 1e-12);
+            }
+        }
+    }
+    
+    TEST(MultiplierTest, ownedMatrixTest) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        for (uint64_t row = 0; row < 100; ++row) {
+            if (row % 2 == 0) {
+                builder.newRowGroup(row);
+            }
+            builder.addNextValue(row, (row * 7 + 3) % 50, 0.5);
+            builder.addNextValue(row, 49 - row / 4, 0.5);
+        }
+        storm::storage::SparseMatrix<double> A = builder.build();
+        std::vector<double> initialX(50);
+        for (uint64_t i = 0; i < initialX.size(); ++i) {
+            initialX[i] = static_cast<double>(i % 10);
+        }
+        
+        storm::Environment scalarEnv = NativeEnvironment::createEnvironment();
+        std::vector<double> expected = initialX;
+        storm::solver::MultiplierFactory<double>().create(scalarEnv, A)->repeatedMultiplyAndReduce(scalarEnv, storm::OptimizationDirection::Maximize, expected, nullptr, 3);
+        
+        // The multiplier releases the entries of its copy of the matrix once they are held in SoA layout, so it
+        // still needs to multiply correctly if the environment no longer requests this layout.
+        auto multiplier = storm::solver::MultiplierFactory<double>().create(scalarEnv, storm::storage::SparseMatrix<double>(A));
+        for (auto const& env : {NativeSoaEnvironment::createEnvironment(), NativeEnvironment::createEnvironment()}) {
+            std::vector<double> x = initialX;
+            multiplier->repeatedMultiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, 3);
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                EXPECT_NEAR(expected[i], x[i], 1e-12);
+            }
+        }
+        double value = 0.0;
+        multiplier->multiplyRow(7, initialX, value);
+        EXPECT_NEAR(A.multiplyRowWithVector(7, initialX), value, 1e-12);
+    }
+    
+    TEST(MultiplierTest, multicolorOrderingForChangedRowGroupsTest) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        builder.addNextValue(0, 0, 0.5);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(1, 2, 1.0);
+        builder.addNextValue(2, 1, 0.5);
+        builder.addNextValue(2, 2, 0.5);
+        builder.addNextValue(3, 0, 1.0);
+        storm::storage::SparseMatrix<double> A = builder.build();
+        std::vector<double> initialX = {1.0, 2.0, 3.0};
+        
+        storm::Environment env = NativeEnvironment::createEnvironment();
+        env.solver().multiplier().setMulticolorGaussSeidel(true);
+        auto multiplier = storm::solver::MultiplierFactory<double>().create(env, A);
+        std::vector<uint64_t> rowGroupIndices = {0, 2, 3, 4};
+        std::vector<double> x = initialX;
+        multiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr);
+        
+        // The same vector now stores a different grouping, so the ordering needs to be recomputed.
+        rowGroupIndices = {0, 1, 3, 4};
+        x = initialX;
+        multiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr);
+        std::vector<double> expected = initialX;
+        storm::solver::MultiplierFactory<double>().create(env, A)->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Maximize, rowGroupIndices, expected, nullptr);
+        for (uint64_t i = 0; i < x.size(); ++i) {
+            EXPECT_NEAR(expected[i], x[i], 1e-12);
+        }
+    }
+    
 }
\ No newline at end of file
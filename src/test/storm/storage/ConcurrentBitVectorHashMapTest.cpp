@@ -0,0 +1,185 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+    // Creates keys with the given number of bits whose first 64-bit words are distinct.
+    std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys, uint64_t bitsPerKey) {
+        std::vector<storm::storage::BitVector> keys;
+        keys.reserve(numberOfKeys);
+        for (uint64_t i = 0; i < numberOfKeys; ++i) {
+            storm::storage::BitVector key(bitsPerKey);
+            key.setFromInt(0, 64, i * 0x9e3779b97f4a7c15ull);
+            key.setFromInt(bitsPerKey - 64, 64, i);
+            keys.push_back(std::move(key));
+        }
+        return keys;
+    }
+
+    // Runs the given task with the given number of threads, where each thread gets its index.
+    void runThreads(uint64_t numberOfThreads, std::function<void(uint64_t)> const& task) {
+        std::vector<std::thread> threads;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back(task, thread);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    // Start with a small map such that it needs to be resized several times.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3);
+    std::vector<storm::storage::BitVector> keys = createKeys(10000, 128);
+
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(i, map.findOrAdd(keys[i], i));
+    }
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_LE(keys.size(), map.capacity());
+
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(i, map.findOrAdd(keys[i], 0));
+        EXPECT_TRUE(map.contains(keys[i]));
+        EXPECT_EQ(i, map.getValue(keys[i]));
+    }
+    EXPECT_EQ(keys.size(), map.size());
+
+    storm::storage::BitVector unknownKey(128);
+    unknownKey.set(127);
+    EXPECT_FALSE(map.contains(unknownKey));
+
+    // The generator is only invoked for keys that are inserted.
+    uint64_t numberOfInvocations = 0;
+    auto valueInsertedPair = map.findOrAdd(keys[5], [&numberOfInvocations] () { return ++numberOfInvocations; });
+    EXPECT_EQ(5ul, valueInsertedPair.first);
+    EXPECT_FALSE(valueInsertedPair.second);
+    valueInsertedPair = map.findOrAdd(unknownKey, [&numberOfInvocations] () { return ++numberOfInvocations; });
+    EXPECT_EQ(1ul, valueInsertedPair.first);
+    EXPECT_TRUE(valueInsertedPair.second);
+    EXPECT_EQ(1ul, numberOfInvocations);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Concurrent) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(64, 10);
+    std::vector<storm::storage::BitVector> keys = createKeys(50000, 64);
+    uint64_t const numberOfThreads = 4;
+
+    // All threads insert all keys (in different orders), such that they compete for the same buckets. Every key needs
+    // to be inserted exactly once and all threads need to obtain the same value for it.
+    std::atomic<uint32_t> nextValue(0);
+    std::vector<std::vector<uint32_t>> obtainedValues(numberOfThreads, std::vector<uint32_t>(keys.size()));
+    std::vector<uint64_t> numberOfInsertions(numberOfThreads, 0);
+    runThreads(numberOfThreads, [&] (uint64_t thread) {
+        for (uint64_t j = 0; j < keys.size(); ++j) {
+            uint64_t i = (thread % 2 == 0) ? j : keys.size() - 1 - j;
+            auto valueInsertedPair = map.findOrAdd(keys[i], [&nextValue] () { return nextValue++; });
+            obtainedValues[thread][i] = valueInsertedPair.first;
+            if (valueInsertedPair.second) {
+                ++numberOfInsertions[thread];
+            }
+        }
+    });
+
+    uint64_t totalNumberOfInsertions = 0;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        totalNumberOfInsertions += numberOfInsertions[thread];
+        EXPECT_EQ(obtainedValues.front(), obtainedValues[thread]);
+    }
+    EXPECT_EQ(keys.size(), totalNumberOfInsertions);
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_EQ(keys.size(), nextValue.load());
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(obtainedValues.front()[i], map.getValue(keys[i]));
+    }
+}
+
+// A microbenchmark that compares the insertion and lookup throughput of the concurrent map to the one of the
+// BitVectorHashMap (which is used sequentially and, for several threads, guarded by a single mutex). It is disabled by
+// default and can be run via --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*.
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    uint64_t const bitsPerKey = 128;
+    std::vector<storm::storage::BitVector> keys = createKeys(4000000, bitsPerKey);
+    auto printThroughput = [&keys] (std::string const& name, uint64_t numberOfThreads, storm::utility::Stopwatch const& insertWatch, storm::utility::Stopwatch const& lookupWatch) {
+        std::cout << name << " with " << numberOfThreads << " threads: " << (keys.size() / std::max<uint64_t>(1, insertWatch.getTimeInMilliseconds())) << " insertions/ms, " << (keys.size() / std::max<uint64_t>(1, lookupWatch.getTimeInMilliseconds())) << " lookups/ms." << std::endl;
+    };
+
+    {
+        storm::storage::BitVectorHashMap<uint64_t> map(bitsPerKey, 1000);
+        storm::utility::Stopwatch insertWatch(true);
+        for (uint64_t i = 0; i < keys.size(); ++i) {
+            map.findOrAdd(keys[i], i);
+        }
+        insertWatch.stop();
+        storm::utility::Stopwatch lookupWatch(true);
+        uint64_t sum = 0;
+        for (uint64_t i = 0; i < keys.size(); ++i) {
+            sum += map.getValue(keys[i]);
+        }
+        lookupWatch.stop();
+        EXPECT_EQ(keys.size() * (keys.size() - 1) / 2, sum);
+        printThroughput("BitVectorHashMap", 1, insertWatch, lookupWatch);
+    }
+
+    for (uint64_t numberOfThreads : {1, 2, 4, 8, 16, 32}) {
+        // Each thread inserts and looks up an interleaved share of the keys.
+        auto forEachKeyOfThread = [&keys, numberOfThreads] (uint64_t thread, std::function<void(uint64_t)> const& function) {
+            for (uint64_t i = thread; i < keys.size(); i += numberOfThreads) {
+                function(i);
+            }
+        };
+
+        {
+            storm::storage::BitVectorHashMap<uint64_t> map(bitsPerKey, 1000);
+            std::mutex mutex;
+            storm::utility::Stopwatch insertWatch(true);
+            runThreads(numberOfThreads, [&] (uint64_t thread) {
+                forEachKeyOfThread(thread, [&] (uint64_t i) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    map.findOrAdd(keys[i], i);
+                });
+            });
+            insertWatch.stop();
+            storm::utility::Stopwatch lookupWatch(true);
+            runThreads(numberOfThreads, [&] (uint64_t thread) {
+                forEachKeyOfThread(thread, [&] (uint64_t i) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    EXPECT_EQ(i, map.getValue(keys[i]));
+                });
+            });
+            lookupWatch.stop();
+            printThroughput("BitVectorHashMap (mutex)", numberOfThreads, insertWatch, lookupWatch);
+        }
+
+        {
+            storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(bitsPerKey, 1000);
+            storm::utility::Stopwatch insertWatch(true);
+            runThreads(numberOfThreads, [&] (uint64_t thread) {
+                forEachKeyOfThread(thread, [&] (uint64_t i) {
+                    map.findOrAdd(keys[i], i);
+                });
+            });
+            insertWatch.stop();
+            storm::utility::Stopwatch lookupWatch(true);
+            runThreads(numberOfThreads, [&] (uint64_t thread) {
+                forEachKeyOfThread(thread, [&] (uint64_t i) {
+                    EXPECT_EQ(i, map.getValue(keys[i]));
+                });
+            });
+            lookupWatch.stop();
+            EXPECT_EQ(keys.size(), map.size());
+            printThroughput("ConcurrentBitVectorHashMap", numberOfThreads, insertWatch, lookupWatch);
+        }
+    }
+}
@@ -0,0 +1,158 @@
+#include "test/storm_gtest.h"
+
+#include "storm/storage/MulticolorOrdering.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    // Builds a substochastic matrix with the given number of row groups (each having one to three rows) such that the
+    // entries of every row sum up to 0.9.
+    storm::storage::SparseMatrix<double> buildContractingMatrix(uint64_t numberOfGroups, bool nondeterministic) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, nondeterministic);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            if (nondeterministic) {
+                matrixBuilder.newRowGroup(row);
+            }
+            uint64_t numberOfChoices = nondeterministic ? 1 + (group * 7) % 3 : 1;
+            for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                std::vector<uint64_t> columns = {group, (group * 31 + choice * 17) % numberOfGroups, (group + 1) % numberOfGroups, (group * 13 + 5) % numberOfGroups};
+                std::sort(columns.begin(), columns.end());
+                columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+                for (auto const& column : columns) {
+                    matrixBuilder.addNextValue(row, column, 0.9 / columns.size());
+                }
+            }
+        }
+        return matrixBuilder.build();
+    }
+
+    std::vector<double> buildVector(uint64_t size, uint64_t modulus) {
+        std::vector<double> result(size);
+        for (uint64_t index = 0; index < size; ++index) {
+            result[index] = static_cast<double>(index % modulus) / (2.0 * modulus);
+        }
+        return result;
+    }
+
+    void expectNear(std::vector<double> const& expected, std::vector<double> const& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (uint64_t index = 0; index < expected.size(); ++index) {
+            EXPECT_NEAR(expected[index], actual[index], 1e-12);
+        }
+    }
+}
+
+TEST(MulticolorOrdering, Coloring) {
+    storm::storage::SparseMatrix<double> matrix = buildContractingMatrix(20000, true);
+    storm::storage::MulticolorOrdering ordering(matrix, &matrix.getRowGroupIndices());
+
+    EXPECT_TRUE(ordering.isComputedFor(&matrix.getRowGroupIndices()));
+    EXPECT_FALSE(ordering.isComputedFor(nullptr));
+    ASSERT_EQ(20000ull, ordering.getNumberOfGroups());
+    ASSERT_EQ(ordering.getNumberOfColors() + 1, ordering.getColorIndications().size());
+    EXPECT_GT(ordering.getNumberOfColors(), 1ull);
+
+    // Every group is colored exactly once.
+    std::vector<uint64_t> colors(ordering.getNumberOfGroups(), ordering.getNumberOfColors());
+    for (uint64_t color = 0; color < ordering.getNumberOfColors(); ++color) {
+        for (uint64_t index = ordering.getColorIndications()[color]; index < ordering.getColorIndications()[color + 1]; ++index) {
+            uint64_t group = ordering.getOrderedGroups()[index];
+            ASSERT_EQ(ordering.getNumberOfColors(), colors[group]);
+            colors[group] = color;
+        }
+    }
+
+    // Groups of the same color do not depend on each other.
+    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (entry.getColumn() != group) {
+                EXPECT_NE(colors[group], colors[entry.getColumn()]);
+            }
+        }
+    }
+
+    storm::storage::SparseMatrix<double> rectangularMatrix = buildContractingMatrix(10, true);
+    STORM_SILENT_EXPECT_THROW(storm::storage::MulticolorOrdering rowOrdering(rectangularMatrix), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(MulticolorOrdering, MultiplyGaussSeidel) {
+    storm::storage::SparseMatrix<double> matrix = buildContractingMatrix(20000, false);
+    storm::storage::MulticolorOrdering ordering(matrix);
+    std::vector<double> b = buildVector(matrix.getRowCount(), 7);
+
+    // A multicolor sweep is a Gauss-Seidel sweep wrt. the ordered groups.
+    std::vector<double> expected = buildVector(matrix.getColumnCount(), 5);
+    for (auto const& row : ordering.getOrderedGroups()) {
+        expected[row] = matrix.multiplyRowWithVector(row, expected) + b[row];
+    }
+    std::vector<double> x = buildVector(matrix.getColumnCount(), 5);
+    matrix.multiplyWithVectorMulticolor(ordering, x, &b, false, 1);
+    expectNear(expected, x);
+    
+    // Groups of the same color are independent, so the result does not depend on the number of threads.
+    std::vector<double> parallelX = buildVector(matrix.getColumnCount(), 5);
+    matrix.multiplyWithVectorMulticolor(ordering, parallelX, &b, false, 4);
+    EXPECT_EQ(x, parallelX);
+
+    // Backward sweeps visit the colors in reverse order.
+    std::vector<double> forward = buildVector(matrix.getColumnCount(), 5);
+    std::vector<double> backward = forward;
+    matrix.multiplyWithVectorMulticolor(ordering, forward, &b, false, 4);
+    matrix.multiplyWithVectorMulticolor(ordering, backward, &b, true, 4);
+    if (ordering.getNumberOfColors() > 1) {
+        EXPECT_NE(forward, backward);
+    }
+}
+
+TEST(MulticolorOrdering, MultiplyAndReduceGaussSeidel) {
+    storm::storage::SparseMatrix<double> matrix = buildContractingMatrix(20000, true);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    storm::storage::MulticolorOrdering ordering(matrix, &rowGroupIndices);
+    std::vector<double> b = buildVector(matrix.getRowCount(), 7);
+
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expected = buildVector(matrix.getColumnCount(), 5);
+        for (auto const& group : ordering.getOrderedGroups()) {
+            double best = matrix.multiplyRowWithVector(rowGroupIndices[group], expected) + b[rowGroupIndices[group]];
+            for (uint64_t row = rowGroupIndices[group] + 1; row < rowGroupIndices[group + 1]; ++row) {
+                double value = matrix.multiplyRowWithVector(row, expected) + b[row];
+                best = storm::solver::minimize(dir) ? std::min(best, value) : std::max(best, value);
+            }
+            expected[group] = best;
+        }
+        std::vector<double> x = buildVector(matrix.getColumnCount(), 5);
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduceMulticolor(dir, rowGroupIndices, ordering, x, &b, &choices, false, 1);
+        expectNear(expected, x);
+        
+        std::vector<double> parallelX = buildVector(matrix.getColumnCount(), 5);
+        std::vector<uint64_t> parallelChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduceMulticolor(dir, rowGroupIndices, ordering, parallelX, &b, &parallelChoices, false, 4);
+        EXPECT_EQ(x, parallelX);
+        EXPECT_EQ(choices, parallelChoices);
+    }
+}
+
+TEST(MulticolorOrdering, SuccessiveOverRelaxation) {
+    // Solve (I - A) x = b, where A is a contracting matrix (with self-loops, so every row has a diagonal entry).
+    storm::storage::SparseMatrix<double> matrix = buildContractingMatrix(20000, false);
+    matrix.convertToEquationSystem();
+    storm::storage::MulticolorOrdering ordering(matrix);
+    std::vector<double> b = buildVector(matrix.getRowCount(), 7);
+
+    std::vector<double> x(matrix.getColumnCount(), 0.0);
+    std::vector<double> multicolorX(matrix.getColumnCount(), 0.0);
+    for (uint64_t iteration = 0; iteration < 200; ++iteration) {
+        matrix.performSuccessiveOverRelaxationStep(0.9, x, b);
+        matrix.performSuccessiveOverRelaxationStep(0.9, multicolorX, b, ordering, 4);
+    }
+
+    std::vector<double> residual(matrix.getRowCount());
+    matrix.multiplyWithVector(multicolorX, residual);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_NEAR(b[row], residual[row], 1e-9);
+        EXPECT_NEAR(x[row], multicolorX[row], 1e-9);
+    }
+}
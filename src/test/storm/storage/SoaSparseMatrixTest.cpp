@@ -0,0 +1,307 @@
+#include "test/storm_gtest.h"
+
+#include <iostream>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/SoaSparseMatrixKernels.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> buildNondeterministicMatrix() {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 0, 0.9);
+        matrixBuilder.addNextValue(0, 1, 0.099);
+        matrixBuilder.addNextValue(0, 2, 0.001);
+        matrixBuilder.addNextValue(1, 1, 0.5);
+        matrixBuilder.addNextValue(1, 2, 0.5);
+        matrixBuilder.addNextValue(2, 0, 0.2);
+        matrixBuilder.addNextValue(2, 2, 0.8);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 1, 1.0);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.addNextValue(4, 0, 0.3);
+        matrixBuilder.addNextValue(4, 3, 0.7);
+        matrixBuilder.addNextValue(5, 2, 1.0);
+        return matrixBuilder.build();
+    }
+
+    // Builds a matrix with the given number of row groups whose rows have between one and maxRowLength entries.
+    storm::storage::SparseMatrix<double> buildRandomLikeMatrix(uint64_t numberOfGroups, uint64_t maxRowLength) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            matrixBuilder.newRowGroup(row);
+            uint64_t numberOfChoices = 1 + (group * 7) % 3;
+            for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                uint64_t rowLength = 1 + (group + 3 * choice) % maxRowLength;
+                uint64_t column = (group * 31 + choice * 17) % numberOfGroups;
+                for (uint64_t entry = 0; entry < rowLength && column < numberOfGroups; ++entry, column += 1 + (entry * 13) % 5) {
+                    matrixBuilder.addNextValue(row, column, 1.0 / (rowLength + entry));
+                }
+            }
+        }
+        return matrixBuilder.build();
+    }
+
+    std::vector<storm::utility::simd::InstructionSet> getSupportedVectorizedInstructionSets() {
+        std::vector<storm::utility::simd::InstructionSet> result;
+        for (auto instructionSet : {storm::utility::simd::InstructionSet::Avx2, storm::utility::simd::InstructionSet::Avx512}) {
+            if (storm::utility::simd::isSupported(instructionSet)) {
+                result.push_back(instructionSet);
+            }
+        }
+        return result;
+    }
+}
+
+TEST(SoaSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = buildNondeterministicMatrix();
+
+    storm::storage::SoaSparseMatrix<double> narrowMatrix(matrix);
+    EXPECT_TRUE(narrowMatrix.hasNarrowColumnIndices());
+    EXPECT_EQ(matrix.getRowCount(), narrowMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), narrowMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), narrowMatrix.getEntryCount());
+
+    storm::storage::SoaSparseMatrix<double> wideMatrix(matrix, false);
+    EXPECT_FALSE(wideMatrix.hasNarrowColumnIndices());
+    EXPECT_EQ(matrix.getEntryCount(), wideMatrix.getEntryCount());
+    EXPECT_EQ(narrowMatrix.getRowIndications(), wideMatrix.getRowIndications());
+}
+
+TEST(SoaSparseMatrix, MatrixVectorMultiply) {
+    storm::storage::SparseMatrix<double> matrix = buildNondeterministicMatrix();
+    std::vector<double> x = {0.1, 0.4, 0.7, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05, 0.06};
+
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+
+    for (bool narrow : {true, false}) {
+        storm::storage::SoaSparseMatrix<double> soaMatrix(matrix, narrow);
+        std::vector<double> result(matrix.getRowCount());
+        ASSERT_NO_THROW(soaMatrix.multiplyWithVector(x, result, &b));
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_EQ(expected[row], result[row]);
+            EXPECT_EQ(matrix.multiplyRowWithVector(row, x), soaMatrix.multiplyRowWithVector(row, x));
+            double value1 = 1.0;
+            double value2 = 2.0;
+            soaMatrix.multiplyRowWithVectors(row, x, value1, b, value2);
+            EXPECT_EQ(1.0 + matrix.multiplyRowWithVector(row, x), value1);
+            EXPECT_EQ(2.0 + matrix.multiplyRowWithVector(row, b), value2);
+        }
+    }
+}
+
+TEST(SoaSparseMatrix, GaussSeidelMultiply) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 3, 5);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 0, 0.25);
+    matrixBuilder.addNextValue(1, 2, 0.75);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SoaSparseMatrix<double> soaMatrix(matrix);
+
+    std::vector<double> expected = {0.0, 0.5, 1.0};
+    std::vector<double> x = expected;
+    matrix.multiplyWithVectorForward(expected, expected);
+    soaMatrix.multiplyWithVectorForward(x, x);
+    EXPECT_EQ(expected, x);
+
+    matrix.multiplyWithVectorBackward(expected, expected);
+    soaMatrix.multiplyWithVectorBackward(x, x);
+    for (uint64_t row = 0; row < x.size(); ++row) {
+        EXPECT_NEAR(expected[row], x[row], 1e-12);
+    }
+}
+
+TEST(SoaSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = buildNondeterministicMatrix();
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = {0.1, 0.4, 0.7, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05, 0.06};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expected, &expectedChoices);
+
+        std::vector<double> expectedBackward(x);
+        std::vector<uint_fast64_t> expectedBackwardChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduceBackward(dir, rowGroupIndices, expectedBackward, &b, expectedBackward, &expectedBackwardChoices);
+
+        for (bool narrow : {true, false}) {
+            storm::storage::SoaSparseMatrix<double> soaMatrix(matrix, narrow);
+            std::vector<double> result(matrix.getRowGroupCount());
+            std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+            ASSERT_NO_THROW(soaMatrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, result, &choices));
+            EXPECT_EQ(expected, result);
+            EXPECT_EQ(expectedChoices, choices);
+
+            std::vector<double> backward(x);
+            std::vector<uint_fast64_t> backwardChoices(matrix.getRowGroupCount(), 0);
+            ASSERT_NO_THROW(soaMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, backward, &b, backward, &backwardChoices));
+            for (uint64_t group = 0; group < backward.size(); ++group) {
+                EXPECT_NEAR(expectedBackward[group], backward[group], 1e-12);
+            }
+            EXPECT_EQ(expectedBackwardChoices, backwardChoices);
+        }
+    }
+}
+
+TEST(SoaSparseMatrix, Parallel) {
+    storm::storage::SparseMatrix<double> matrix = buildNondeterministicMatrix();
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = {0.1, 0.4, 0.7, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05, 0.06};
+    storm::storage::SoaSparseMatrix<double> soaMatrix(matrix);
+
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    std::vector<double> result(matrix.getRowCount());
+    ASSERT_NO_THROW(soaMatrix.multiplyWithVectorParallel(x, result, &b, 3));
+    EXPECT_EQ(expected, result);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expectedReduced, &expectedChoices);
+
+        std::vector<double> reduced(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+        ASSERT_NO_THROW(soaMatrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, &b, reduced, &choices, 3));
+        EXPECT_EQ(expectedReduced, reduced);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(SoaSparseMatrix, Vectorized) {
+    storm::storage::SparseMatrix<double> matrix = buildRandomLikeMatrix(300, 19);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x(matrix.getColumnCount());
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t index = 0; index < x.size(); ++index) {
+        x[index] = static_cast<double>(index % 5) / 4.0;
+    }
+    for (uint64_t index = 0; index < b.size(); ++index) {
+        b[index] = static_cast<double>(index % 3) / 8.0;
+    }
+
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+
+    for (auto instructionSet : getSupportedVectorizedInstructionSets()) {
+        for (bool narrow : {true, false}) {
+            storm::storage::SoaSparseMatrix<double> soaMatrix(matrix, narrow);
+            EXPECT_EQ(narrow, soaMatrix.hasNarrowColumnIndices());
+            ASSERT_NO_THROW(soaMatrix.setInstructionSet(instructionSet));
+            EXPECT_EQ(instructionSet, soaMatrix.getInstructionSet());
+
+            std::vector<double> result(matrix.getRowCount());
+            ASSERT_NO_THROW(soaMatrix.multiplyWithVector(x, result, &b));
+            for (uint64_t row = 0; row < result.size(); ++row) {
+                EXPECT_NEAR(expected[row], result[row], 1e-12);
+            }
+
+            for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+                std::vector<double> expectedReduced(matrix.getRowGroupCount());
+                std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+                matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expectedReduced, &expectedChoices);
+
+                std::vector<double> reduced(matrix.getRowGroupCount());
+                std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+                ASSERT_NO_THROW(soaMatrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, reduced, &choices));
+                for (uint64_t group = 0; group < reduced.size(); ++group) {
+                    EXPECT_NEAR(expectedReduced[group], reduced[group], 1e-12);
+                }
+                EXPECT_EQ(expectedChoices, choices);
+            }
+        }
+    }
+}
+
+TEST(SoaSparseMatrix, VectorizedKernelsWithLargeColumnIndices) {
+    // The kernels are called with column indices above 2^31 that refer to a small vector through a shifted pointer.
+    // This ensures that the indices are not interpreted as (negative) signed 32-bit integers.
+    uint64_t const offset = (1ull << 31) + 3;
+    std::vector<double> vector(16);
+    for (uint64_t index = 0; index < vector.size(); ++index) {
+        vector[index] = static_cast<double>(index + 1) / 8.0;
+    }
+    double const* shiftedVector = reinterpret_cast<double const*>(reinterpret_cast<uintptr_t>(vector.data()) - offset * sizeof(double));
+
+    // Rows of length 0 to 11 cover full and partial gathers for both instruction sets.
+    std::vector<uint64_t> rowIndications = {0};
+    std::vector<uint64_t> columns;
+    std::vector<double> values;
+    std::vector<double> expected;
+    for (uint64_t rowLength = 0; rowLength < 12; ++rowLength) {
+        double rowValue = 0.0;
+        for (uint64_t entry = 0; entry < rowLength; ++entry) {
+            uint64_t column = (rowLength * 5 + entry * 3) % vector.size();
+            columns.push_back(offset + column);
+            values.push_back(1.0 / static_cast<double>(entry + 2));
+            rowValue += values.back() * vector[column];
+        }
+        rowIndications.push_back(values.size());
+        expected.push_back(rowValue);
+    }
+    std::vector<uint64_t> rowGroupIndices = {0, 1, 4, 8, 12};
+
+    for (auto instructionSet : getSupportedVectorizedInstructionSets()) {
+        std::vector<double> result(expected.size());
+        storm::storage::soa::KernelArguments<uint64_t> arguments = {rowIndications.data(), columns.data(), values.data(), shiftedVector, nullptr, result.data()};
+        storm::storage::soa::multiplyRows(instructionSet, arguments, 0, expected.size());
+        for (uint64_t row = 0; row < expected.size(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-12);
+        }
+
+        std::vector<uint_fast64_t> choices(rowGroupIndices.size() - 1, 0);
+        storm::storage::soa::multiplyAndReduceRowGroups(instructionSet, false, arguments, rowGroupIndices.data(), choices.data(), 0, rowGroupIndices.size() - 1);
+        for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+            uint64_t bestRow = rowGroupIndices[group];
+            for (uint64_t row = bestRow + 1; row < rowGroupIndices[group + 1]; ++row) {
+                if (expected[row] > expected[bestRow]) {
+                    bestRow = row;
+                }
+            }
+            EXPECT_NEAR(expected[bestRow], result[group], 1e-12);
+            EXPECT_EQ(bestRow - rowGroupIndices[group], choices[group]);
+        }
+    }
+}
+
+// A microbenchmark that compares the vectorized kernels to the scalar ones. It is disabled by default and can be run
+// via --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*.
+TEST(SoaSparseMatrix, DISABLED_VectorizationBenchmark) {
+    storm::storage::SparseMatrix<double> matrix = buildRandomLikeMatrix(2000000, 4);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> result(matrix.getRowGroupCount());
+    std::vector<uint_fast64_t> choices(matrix.getRowGroupCount(), 0);
+    uint64_t const iterations = 20;
+
+    storm::utility::Stopwatch sparseWatch(true);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, result, &choices);
+    }
+    sparseWatch.stop();
+    std::cout << "sparse matrix (scalar): " << sparseWatch << std::endl;
+
+    std::vector<storm::utility::simd::InstructionSet> instructionSets = getSupportedVectorizedInstructionSets();
+    instructionSets.insert(instructionSets.begin(), storm::utility::simd::InstructionSet::Scalar);
+    for (auto instructionSet : instructionSets) {
+        storm::storage::SoaSparseMatrix<double> soaMatrix(matrix);
+        soaMatrix.setInstructionSet(instructionSet);
+        storm::utility::Stopwatch watch(true);
+        for (uint64_t i = 0; i < iterations; ++i) {
+            soaMatrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, result, &choices);
+        }
+        watch.stop();
+        std::cout << "structure of arrays (" << instructionSet << "): " << watch << std::endl;
+    }
+}
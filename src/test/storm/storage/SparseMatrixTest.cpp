@@ -675,6 +675,122 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, MatrixVectorMultiplyParallel) {
+    uint64_t const size = 1000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        // Give the rows varying lengths such that the partitioning is not trivial.
+        for (uint64_t column = row; column < size && column < row + (row % 17); ++column) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, column, 1.0 / (column + 1)));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build(size, size));
+    
+    std::vector<double> x(size);
+    std::vector<double> b(size);
+    for (uint64_t index = 0; index < size; ++index) {
+        x[index] = static_cast<double>(index % 7);
+        b[index] = 1.0 / (index + 1);
+    }
+    
+    std::vector<double> expected(size);
+    matrix.multiplyWithVector(x, expected, &b);
+    for (uint64_t numberOfThreads : {1, 2, 3, 8}) {
+        std::vector<double> result(size);
+        ASSERT_NO_THROW(matrix.multiplyWithVectorParallel(x, result, &b, numberOfThreads));
+        EXPECT_EQ(expected, result);
+    }
+}
+
+TEST(SparseMatrix, MatrixVectorMultiplyInterleaved) {
+    uint64_t const size = 300;
+    uint64_t const numberOfVectors = 3;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        for (uint64_t column = row; column < size && column < row + (row % 13); ++column) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, column, 1.0 / (column + 2)));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build(size, size));
+    
+    std::vector<std::vector<double>> x(numberOfVectors, std::vector<double>(size));
+    std::vector<std::vector<double>> b(numberOfVectors, std::vector<double>(size));
+    std::vector<double> interleavedX(size * numberOfVectors);
+    std::vector<double> interleavedB(size * numberOfVectors);
+    for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+        for (uint64_t index = 0; index < size; ++index) {
+            x[vector][index] = static_cast<double>((index + vector) % 7);
+            b[vector][index] = 1.0 / (index + vector + 1);
+            interleavedX[index * numberOfVectors + vector] = x[vector][index];
+            interleavedB[index * numberOfVectors + vector] = b[vector][index];
+        }
+    }
+    
+    for (uint64_t numberOfThreads : {1, 4}) {
+        std::vector<double> result(size * numberOfVectors);
+        ASSERT_NO_THROW(matrix.multiplyWithInterleavedVectors(interleavedX, result, &interleavedB, numberOfVectors, numberOfThreads));
+        for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+            std::vector<double> expected(size);
+            matrix.multiplyWithVector(x[vector], expected, &b[vector]);
+            for (uint64_t index = 0; index < size; ++index) {
+                EXPECT_EQ(expected[index], result[index * numberOfVectors + vector]);
+            }
+        }
+    }
+    
+    for (bool backward : {true, false}) {
+        std::vector<double> result = interleavedX;
+        ASSERT_NO_THROW(matrix.multiplyWithInterleavedVectorsGaussSeidel(result, &interleavedB, numberOfVectors, backward));
+        for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+            std::vector<double> expected = x[vector];
+            if (backward) {
+                matrix.multiplyWithVectorBackward(expected, expected, &b[vector]);
+            } else {
+                matrix.multiplyWithVectorForward(expected, expected, &b[vector]);
+            }
+            // The entries of a row may be summed up in a different order.
+            for (uint64_t index = 0; index < size; ++index) {
+                EXPECT_NEAR(expected[index], result[index * numberOfVectors + vector], 1e-12);
+            }
+        }
+    }
+}
+
+TEST(SparseMatrix, MultiplyAndReduceParallel) {
+    uint64_t const numberOfGroups = 500;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < group % 4; ++choice, ++row) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, (group + choice) % numberOfGroups, 0.5));
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, (group * choice + 1) % numberOfGroups, 0.5));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t index = 0; index < numberOfGroups; ++index) {
+        x[index] = static_cast<double>(index % 11);
+    }
+    
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(numberOfGroups);
+        std::vector<uint_fast64_t> expectedChoices(numberOfGroups, 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, expected, &expectedChoices);
+        for (uint64_t numberOfThreads : {2, 5}) {
+            std::vector<double> result(numberOfGroups);
+            std::vector<uint_fast64_t> choices(numberOfGroups, 0);
+            ASSERT_NO_THROW(matrix.multiplyAndReduceParallel(dir, matrix.getRowGroupIndices(), x, nullptr, result, &choices, numberOfThreads));
+            EXPECT_EQ(expected, result);
+            EXPECT_EQ(expectedChoices, choices);
+        }
+    }
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+    class StateValuationsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            manager = std::make_shared<storm::expressions::ExpressionManager>();
+            b = manager->declareBooleanVariable("b");
+            x = manager->declareIntegerVariable("x");
+            y = manager->declareIntegerVariable("y");
+            r = manager->declareRationalVariable("r");
+
+            // The values of x are known to lie in [-3, 4] while y can have any value.
+            storm::storage::sparse::StateValuationsBuilder builder;
+            builder.addVariable(b);
+            builder.addVariable(x, -3, 3);
+            builder.addVariable(y);
+            builder.addVariable(r);
+            builder.addObservationLabel("l");
+
+            // The states are added in a different order and state 3 is left out.
+            for (uint64_t state : {2, 0, 4, 1}) {
+                int64_t value = static_cast<int64_t>(state);
+                builder.addState(state, {state % 2 == 0}, {value - 3, -value * 1000000000000}, {storm::utility::convertNumber<storm::RationalNumber>(0.5 * value)}, {value - 2});
+            }
+            valuations = builder.build(5);
+        }
+
+        void checkState(storm::storage::sparse::StateValuations const& stateValuations, uint64_t state, int64_t value) {
+            EXPECT_FALSE(stateValuations.isEmpty(state));
+            EXPECT_EQ(value % 2 == 0, stateValuations.getBooleanValue(state, b));
+            EXPECT_EQ(value - 3, stateValuations.getIntegerValue(state, x));
+            EXPECT_EQ(-value * 1000000000000, stateValuations.getIntegerValue(state, y));
+            EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(0.5 * value), stateValuations.getRationalValue(state, r));
+            auto json = stateValuations.toJson<double>(state);
+            EXPECT_EQ(value - 2, json["l"].get<int64_t>());
+            EXPECT_EQ(value - 3, json["x"].get<int64_t>());
+        }
+
+        std::shared_ptr<storm::expressions::ExpressionManager> manager;
+        storm::expressions::Variable b, x, y, r;
+        storm::storage::sparse::StateValuations valuations;
+    };
+
+    TEST_F(StateValuationsTest, Build) {
+        ASSERT_EQ(5ull, valuations.getNumberOfStates());
+        for (int64_t state : {0, 1, 2, 4}) {
+            checkState(valuations, state, state);
+        }
+        EXPECT_TRUE(valuations.isEmpty(3));
+        EXPECT_EQ("[!b\t& x=-2\t& y=-1000000000000\t& r=1/2\t& l=-1]", valuations.toString(1));
+    }
+
+    TEST_F(StateValuationsTest, SelectStates) {
+        storm::storage::BitVector selectedStates(5);
+        selectedStates.set(1);
+        selectedStates.set(4);
+        auto selected = valuations.selectStates(selectedStates);
+        ASSERT_EQ(2ull, selected.getNumberOfStates());
+        checkState(selected, 0, 1);
+        checkState(selected, 1, 4);
+
+        auto reordered = valuations.selectStates(std::vector<storm::storage::sparse::state_type>({4, 7, 0}));
+        ASSERT_EQ(3ull, reordered.getNumberOfStates());
+        checkState(reordered, 0, 4);
+        EXPECT_TRUE(reordered.isEmpty(1));
+        checkState(reordered, 2, 0);
+    }
+
+    TEST_F(StateValuationsTest, Blowup) {
+        auto blownUp = valuations.blowup({2, 2, 0, 4});
+        ASSERT_EQ(4ull, blownUp.getNumberOfStates());
+        checkState(blownUp, 0, 2);
+        checkState(blownUp, 1, 2);
+        checkState(blownUp, 2, 0);
+        checkState(blownUp, 3, 4);
+    }
+}
@@ -6,6 +6,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include <random>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
 	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -86,3 +88,79 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, Parallel) {
+    // Create a large system with a big cycle, many smaller SCCs and trivial SCCs such that the parallel parts of the algorithm are used.
+    uint64_t const numberOfStates = 200000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<uint64_t> successors;
+        if (state < 50000) {
+            successors.push_back((state + 1) % 50000);
+        } else if (state % 37 != 0) {
+            successors.push_back(state - (generator() % (state % 37 + 1)));
+        }
+        if (generator() % 2 == 0) {
+            successors.push_back(std::min<uint64_t>(numberOfStates - 1, state + 1 + generator() % 5000));
+        }
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto successor : successors) {
+            matrixBuilder.addNextValue(state, successor, 1.0 / successors.size());
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.forceTopologicalSort().computeSccDepths();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+    storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options.numberOfThreads(4));
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    EXPECT_EQ(sequentialDecomposition.getMaxSccDepth(), parallelDecomposition.getMaxSccDepth());
+    
+    // Both decompositions need to induce the same partition and depths, SCCs may only reach SCCs with a smaller index.
+    std::vector<uint64_t> sequentialSccs(numberOfStates), parallelSccs(numberOfStates);
+    for (uint64_t scc = 0; scc < sequentialDecomposition.size(); ++scc) {
+        for (auto state : sequentialDecomposition[scc]) {
+            sequentialSccs[state] = scc;
+        }
+        for (auto state : parallelDecomposition[scc]) {
+            parallelSccs[state] = scc;
+        }
+    }
+    for (uint64_t scc = 0; scc < parallelDecomposition.size(); ++scc) {
+        auto const& sequentialScc = sequentialDecomposition[sequentialSccs[*parallelDecomposition[scc].begin()]];
+        ASSERT_EQ(sequentialScc, parallelDecomposition[scc]);
+        EXPECT_EQ(sequentialDecomposition.getSccDepth(sequentialSccs[*sequentialScc.begin()]), parallelDecomposition.getSccDepth(scc));
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : matrix.getRow(state)) {
+            EXPECT_LE(parallelSccs[entry.getColumn()], parallelSccs[state]);
+        }
+    }
+    
+    // The result is deterministic.
+    storm::storage::StronglyConnectedComponentDecomposition<double> otherParallelDecomposition(matrix, options);
+    for (uint64_t scc = 0; scc < parallelDecomposition.size(); ++scc) {
+        EXPECT_EQ(parallelDecomposition[scc], otherParallelDecomposition[scc]);
+    }
+    
+    // Consider a subsystem and only bottom SCCs.
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 3) {
+        subsystem.set(state, false);
+    }
+    options.subsystem(&subsystem).onlyBottomSccs();
+    sequentialDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options.numberOfThreads(1));
+    parallelDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options.numberOfThreads(4));
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    std::vector<storm::storage::StronglyConnectedComponent> sequentialBottomSccs(sequentialDecomposition.begin(), sequentialDecomposition.end());
+    std::vector<storm::storage::StronglyConnectedComponent> parallelBottomSccs(parallelDecomposition.begin(), parallelDecomposition.end());
+    auto compareSccs = [] (storm::storage::StronglyConnectedComponent const& first, storm::storage::StronglyConnectedComponent const& second) { return *first.begin() < *second.begin(); };
+    std::sort(sequentialBottomSccs.begin(), sequentialBottomSccs.end(), compareSccs);
+    std::sort(parallelBottomSccs.begin(), parallelBottomSccs.end(), compareSccs);
+    for (uint64_t scc = 0; scc < sequentialBottomSccs.size(); ++scc) {
+        EXPECT_EQ(sequentialBottomSccs[scc], parallelBottomSccs[scc]);
+    }
+}
@@ -0,0 +1,57 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+#include <sstream>
+#include <boost/filesystem.hpp>
+
+#include "storm/io/compression.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+TEST(CompressionTest, Filename) {
+    EXPECT_TRUE(storm::utility::isGzipFilename("model.drn.gz"));
+    EXPECT_FALSE(storm::utility::isGzipFilename("model.drn"));
+    EXPECT_FALSE(storm::utility::isGzipFilename(".gz"));
+    EXPECT_EQ("model.drn", storm::utility::removeGzipExtension("model.drn.gz"));
+    EXPECT_EQ("model.drn", storm::utility::removeGzipExtension("model.drn"));
+}
+
+#ifdef STORM_HAVE_ZLIB
+TEST(CompressionTest, CompressAndDecompress) {
+    std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%.gz")).string();
+    std::string content;
+    for (uint64_t line = 0; line < 100000; ++line) {
+        content += "line " + std::to_string(line) + "\n";
+    }
+    storm::utility::GzipOutputFileStream stream(filename);
+    stream << "header" << std::endl;
+    stream.write(content.data(), content.size());
+    stream << 42;
+    stream.close();
+
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    std::stringstream fileContent;
+    fileContent << file.rdbuf();
+    file.close();
+    std::string compressed = fileContent.str();
+    char const* begin = compressed.data();
+    char const* end = begin + compressed.size();
+    ASSERT_TRUE(storm::utility::isGzipCompressed(begin, end));
+    EXPECT_FALSE(storm::utility::isGzipCompressed(content.data(), content.data() + content.size()));
+    EXPECT_LT(compressed.size(), content.size());
+
+    storm::utility::GzipInputFileStream inputStream(filename);
+    std::stringstream decompressed;
+    decompressed << inputStream.rdbuf();
+    EXPECT_EQ("header\n" + content + "42", decompressed.str());
+
+    // Incomplete data is rejected.
+    std::ofstream truncatedFile(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    truncatedFile.write(begin, compressed.size() / 2);
+    truncatedFile.close();
+    storm::utility::GzipInputFileStream truncatedStream(filename);
+    std::string line;
+    STORM_SILENT_EXPECT_THROW(while (std::getline(truncatedStream, line)) {}, storm::exceptions::WrongFormatException);
+    boost::filesystem::remove(filename);
+}
+#endif
@@ -0,0 +1,45 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+
+#include "storm/utility/parallel.h"
+
+TEST(ParallelTest, Execute) {
+    std::vector<uint64_t> values(1000, 0);
+    storm::utility::parallel::ThreadPool pool(4);
+    EXPECT_EQ(4ull, pool.getNumberOfThreads());
+    for (uint64_t round = 1; round <= 3; ++round) {
+        pool.execute(values.size(), [&] (uint64_t index) { values[index] += index; });
+    }
+    for (uint64_t index = 0; index < values.size(); ++index) {
+        EXPECT_EQ(3 * index, values[index]);
+    }
+
+    // Nested batches are processed sequentially.
+    std::atomic<uint64_t> counter(0);
+    pool.execute(4, [&] (uint64_t) { pool.execute(5, [&] (uint64_t) { ++counter; }); });
+    EXPECT_EQ(20ull, counter.load());
+
+    EXPECT_THROW(pool.execute(10, [] (uint64_t index) { if (index == 7) { throw std::runtime_error("test"); } }), std::runtime_error);
+}
+
+TEST(ParallelTest, BalancedRanges) {
+    // Five rows with 0, 10, 0, 0 and 2 entries, respectively.
+    std::vector<uint64_t> rowIndications = {0, 0, 10, 10, 10, 12};
+    std::vector<uint64_t> ranges = storm::utility::parallel::getBalancedRanges(rowIndications, nullptr, 2);
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 5}), ranges);
+
+    // Never more ranges than groups.
+    ranges = storm::utility::parallel::getBalancedRanges(rowIndications, nullptr, 16);
+    EXPECT_EQ(0ull, ranges.front());
+    EXPECT_EQ(5ull, ranges.back());
+    EXPECT_LE(ranges.size(), 6ull);
+    for (uint64_t index = 1; index < ranges.size(); ++index) {
+        EXPECT_LT(ranges[index - 1], ranges[index]);
+    }
+
+    // Row groups are never split.
+    std::vector<uint64_t> rowGroupIndices = {0, 3, 5};
+    ranges = storm::utility::parallel::getBalancedRanges(rowIndications, &rowGroupIndices, 4);
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), ranges);
+}